@@ -0,0 +1,359 @@
+// Offscreen render benchmark.
+//
+// Renders a synthetic scene of N sprites, shapes and particle emitters into an offscreen
+// render target and reports per-frame CPU time and draw statistics. The scene layout is
+// generated from a fixed seed, so two runs with the same arguments draw the same thing.
+//
+// Usage:
+//   render_benchmark [--sprites=N] [--shapes=N] [--static=N] [--tiles=N] [--emitters=N] [--frames=N]
+//                    [--warmup=N] [--width=PX] [--height=PX] [--seed=N] [--dump=frame.png]
+//
+// --static adds N background shapes marked CRenderable::isStatic, drawn from a cached layer.
+// --tiles adds an N x N tilemap centred on the camera, so large N exercises chunk culling.
+//
+// On a headless Linux machine, run under a virtual display with software GL, e.g.:
+//   LIBGL_ALWAYS_SOFTWARE=1 xvfb-run -a ./render_benchmark --sprites=5000
+//
+// Particle spawning is seeded from --seed as well, so frames with emitters are reproducible.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <CCamera.h>
+#include <CParticleEmitter.h>
+#include <CRenderable.h>
+#include <CTexture.h>
+#include <CTilemap.h>
+#include <CTransform.h>
+#include <SParticle.h>
+#include <SRenderer.h>
+#include <World.h>
+
+namespace
+{
+
+struct Options
+{
+    unsigned int  sprites  = 1000;
+    unsigned int  shapes   = 1000;
+    unsigned int  statics  = 0;
+    unsigned int  tiles    = 0;
+    unsigned int  emitters = 10;
+    unsigned int  frames   = 300;
+    unsigned int  warmup   = 30;
+    unsigned int  width    = 1280;
+    unsigned int  height   = 720;
+    std::uint32_t seed     = 1;
+    std::string   dumpPath;
+};
+
+/// Small LCG so the layout does not depend on the standard library's distributions.
+class SceneRandom
+{
+public:
+    explicit SceneRandom(std::uint32_t seed) : m_state(seed) {}
+
+    float next(float min, float max)
+    {
+        m_state = m_state * 1664525u + 1013904223u;
+        return min + (max - min) * static_cast<float>(m_state >> 8) / static_cast<float>(1u << 24);
+    }
+
+private:
+    std::uint32_t m_state;
+};
+
+bool parseUnsigned(const char* arg, const char* name, unsigned int& out)
+{
+    const std::size_t nameLen = std::strlen(name);
+    if (std::strncmp(arg, name, nameLen) != 0 || arg[nameLen] != '=')
+    {
+        return false;
+    }
+    out = static_cast<unsigned int>(std::strtoul(arg + nameLen + 1, nullptr, 10));
+    return true;
+}
+
+bool parseOptions(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if (parseUnsigned(arg, "--sprites", options.sprites) || parseUnsigned(arg, "--shapes", options.shapes)
+            || parseUnsigned(arg, "--static", options.statics) || parseUnsigned(arg, "--tiles", options.tiles)
+            || parseUnsigned(arg, "--emitters", options.emitters)
+            || parseUnsigned(arg, "--frames", options.frames) || parseUnsigned(arg, "--warmup", options.warmup)
+            || parseUnsigned(arg, "--width", options.width) || parseUnsigned(arg, "--height", options.height)
+            || parseUnsigned(arg, "--seed", options.seed))
+        {
+            continue;
+        }
+        if (std::strncmp(arg, "--dump=", 7) == 0)
+        {
+            options.dumpPath = arg + 7;
+            continue;
+        }
+
+        std::fprintf(stderr,
+                     "usage: %s [--sprites=N] [--shapes=N] [--static=N] [--tiles=N] [--emitters=N] [--frames=N]\n"
+                     "          [--warmup=N] [--width=PX] [--height=PX] [--seed=N] [--dump=frame.png]\n",
+                     argv[0]);
+        return false;
+    }
+    return options.frames > 0 && options.width > 0 && options.height > 0;
+}
+
+/// Writes a small checkerboard texture so the benchmark has no asset dependencies.
+std::string writeSpriteTexture()
+{
+    constexpr unsigned int kSize = 32;
+    sf::Image              image(sf::Vector2u{kSize, kSize}, sf::Color::White);
+    for (unsigned int y = 0; y < kSize; ++y)
+    {
+        for (unsigned int x = 0; x < kSize; ++x)
+        {
+            if (((x / 8) + (y / 8)) % 2 == 0)
+            {
+                image.setPixel(sf::Vector2u{x, y}, sf::Color(200, 120, 40));
+            }
+        }
+    }
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "entityforge_bench_sprite.png";
+    if (!image.saveToFile(path))
+    {
+        return std::string{};
+    }
+    return path.string();
+}
+
+void buildScene(World& world, const Options& options, const std::string& texturePath)
+{
+    SceneRandom random(options.seed);
+    auto        components = world.components();
+
+    Components::CCamera camera;
+    camera.worldHeight = 20.0f;
+    components.add<Components::CCamera>(world.createEntity(), camera);
+
+    const float halfHeight = camera.worldHeight * 0.5f;
+    const float halfWidth  = halfHeight * static_cast<float>(options.width) / static_cast<float>(options.height);
+
+    // Random draws are sequenced explicitly; argument evaluation order differs between compilers.
+    auto randomPosition = [&random, halfWidth, halfHeight]()
+    {
+        const float x = random.next(-halfWidth, halfWidth);
+        const float y = random.next(-halfHeight, halfHeight);
+        return Vec2(x, y);
+    };
+
+    for (unsigned int i = 0; i < options.sprites; ++i)
+    {
+        Entity     entity = world.createEntity();
+        const Vec2 pos    = randomPosition();
+        components.add<Components::CTransform>(entity, pos, Vec2(1.0f, 1.0f), random.next(0.0f, 6.2831853f));
+        components.add<Components::CRenderable>(
+            entity, Components::VisualType::Sprite, Color::White, static_cast<int>(i % 4));
+        components.add<Components::CTexture>(entity)->setTexturePath(texturePath);
+    }
+
+    const Components::VisualType shapeTypes[] = {
+        Components::VisualType::Rectangle, Components::VisualType::Circle, Components::VisualType::Line};
+    for (unsigned int i = 0; i < options.shapes; ++i)
+    {
+        Entity      entity = world.createEntity();
+        const Vec2  pos    = randomPosition();
+        const float size   = random.next(0.1f, 0.5f);
+        components.add<Components::CTransform>(entity, pos, Vec2(size, size), random.next(0.0f, 6.2831853f));
+        const auto r = static_cast<uint8_t>(random.next(64.0f, 255.0f));
+        const auto g = static_cast<uint8_t>(random.next(64.0f, 255.0f));
+        const auto b = static_cast<uint8_t>(random.next(64.0f, 255.0f));
+        components.add<Components::CRenderable>(entity, shapeTypes[i % 3], Color(r, g, b), static_cast<int>(i % 4));
+    }
+
+    for (unsigned int i = 0; i < options.statics; ++i)
+    {
+        Entity      entity = world.createEntity();
+        const Vec2  pos    = randomPosition();
+        const float size   = random.next(0.2f, 1.0f);
+        components.add<Components::CTransform>(entity, pos, Vec2(size, size), 0.0f);
+        const auto grey       = static_cast<uint8_t>(random.next(32.0f, 96.0f));
+        auto*      renderable = components.add<Components::CRenderable>(
+            entity, shapeTypes[i % 2], Color(grey, grey, grey), -1);
+        renderable->setStatic(true);
+    }
+
+    if (options.tiles > 0)
+    {
+        // The 32px checkerboard doubles as a 2x2 atlas of 16px tiles.
+        constexpr float kTileSize = 0.5f;
+        const float     origin    = -0.5f * kTileSize * static_cast<float>(options.tiles);
+        Entity          entity    = world.createEntity();
+        components.add<Components::CTransform>(entity, Vec2(origin, origin), Vec2(1.0f, 1.0f), 0.0f);
+        auto*           tilemap   = components.add<Components::CTilemap>(
+            entity, options.tiles, options.tiles, kTileSize, texturePath);
+        tilemap->setTilePixelSize(16, 16);
+        tilemap->zIndex = -2;
+        for (unsigned int y = 0; y < options.tiles; ++y)
+        {
+            for (unsigned int x = 0; x < options.tiles; ++x)
+            {
+                tilemap->setTile(x, y, static_cast<std::int32_t>((x + 2 * y) % 4));
+            }
+        }
+    }
+
+    for (unsigned int i = 0; i < options.emitters; ++i)
+    {
+        Entity entity = world.createEntity();
+        components.add<Components::CTransform>(entity, randomPosition(), Vec2(1.0f, 1.0f), 0.0f);
+        auto* emitter = components.add<Components::CParticleEmitter>(entity);
+        emitter->setEmissionRate(200.0f);
+        emitter->setMaxParticles(500);
+        emitter->setMinLifetime(1.0f);
+        emitter->setMaxLifetime(2.0f);
+        emitter->setZIndex(5);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 2;
+    }
+
+    Systems::WindowConfig config;
+    config.width     = options.width;
+    config.height    = options.height;
+    config.offscreen = true;
+    config.vsync     = false;
+
+    Systems::SRenderer renderer;
+    if (!renderer.initialize(config))
+    {
+        std::fprintf(stderr, "render_benchmark: could not create an offscreen render target\n");
+        return 1;
+    }
+
+    Systems::SParticle particles;
+    particles.initialize(renderer.getRenderTarget());
+    particles.setSeed(options.seed);
+    particles.setTextureLoader(&renderer.getTextureLoader());
+    renderer.setParticleSystem(&particles);
+
+    const std::string texturePath = writeSpriteTexture();
+    if (texturePath.empty() || !renderer.loadTexture(texturePath))
+    {
+        std::fprintf(stderr, "render_benchmark: could not create the sprite texture\n");
+        return 1;
+    }
+
+    World world;
+    buildScene(world, options, texturePath);
+
+    // Fixed simulation step so every run advances the scene identically.
+    constexpr float kStep = 1.0f / 60.0f;
+
+    std::vector<float>   frameMs;
+    Systems::RenderStats totals;
+    frameMs.reserve(options.frames);
+
+    for (unsigned int frame = 0; frame < options.warmup + options.frames; ++frame)
+    {
+        particles.update(kStep, world);
+
+        const auto frameStart = std::chrono::steady_clock::now();
+        renderer.clear(Color::Black);
+        renderer.render(world);
+        renderer.display();
+        const float elapsedMs =
+            std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+
+        if (frame < options.warmup)
+        {
+            continue;
+        }
+
+        const Systems::RenderStats& stats = renderer.getRenderStats();
+        frameMs.push_back(elapsedMs);
+        totals.drawCalls += stats.drawCalls;
+        totals.vertices += stats.vertices;
+        totals.textureBinds += stats.textureBinds;
+        totals.shaderSwitches += stats.shaderSwitches;
+        totals.particles += stats.particles;
+        totals.culledItems += stats.culledItems;
+        totals.staticRebuilds += stats.staticRebuilds;
+        totals.tileChunks += stats.tileChunks;
+        totals.tileChunksCulled += stats.tileChunksCulled;
+        totals.tileChunkBuilds += stats.tileChunkBuilds;
+    }
+
+    std::vector<float> sorted = frameMs;
+    std::sort(sorted.begin(), sorted.end());
+    float sum = 0.0f;
+    for (float ms : frameMs)
+    {
+        sum += ms;
+    }
+
+    const std::size_t n   = frameMs.size();
+    const auto        avg = [n](std::size_t total) { return static_cast<double>(total) / static_cast<double>(n); };
+
+    std::printf("scene:           %u sprites, %u shapes, %u static, %ux%u tiles, %u emitters @ %ux%u (seed %u)\n",
+                options.sprites,
+                options.shapes,
+                options.statics,
+                options.tiles,
+                options.tiles,
+                options.emitters,
+                options.width,
+                options.height,
+                options.seed);
+    std::printf("frames:          %zu (after %u warmup)\n", n, options.warmup);
+    std::printf("frame ms:        avg %.3f  min %.3f  p50 %.3f  p95 %.3f  max %.3f\n",
+                static_cast<double>(sum) / static_cast<double>(n),
+                static_cast<double>(sorted.front()),
+                static_cast<double>(sorted[n / 2]),
+                static_cast<double>(sorted[std::min(n - 1, (n * 95) / 100)]),
+                static_cast<double>(sorted.back()));
+    std::printf("draw calls:      %.1f / frame\n", avg(totals.drawCalls));
+    std::printf("vertices:        %.1f / frame\n", avg(totals.vertices));
+    std::printf("texture binds:   %.1f / frame\n", avg(totals.textureBinds));
+    std::printf("shader switches: %.1f / frame\n", avg(totals.shaderSwitches));
+    std::printf("particles:       %.1f / frame\n", avg(totals.particles));
+    std::printf("culled items:    %.1f / frame\n", avg(totals.culledItems));
+    std::printf("static rebuilds: %zu\n", totals.staticRebuilds);
+    std::printf("tile chunks:     %.1f drawn, %.1f culled / frame (%zu rebuilt)\n",
+                avg(totals.tileChunks),
+                avg(totals.tileChunksCulled),
+                totals.tileChunkBuilds);
+
+    if (!options.dumpPath.empty())
+    {
+        const sf::Image image = renderer.captureFrame();
+        if (!image.saveToFile(options.dumpPath))
+        {
+            std::fprintf(stderr, "render_benchmark: failed to write '%s'\n", options.dumpPath.c_str());
+            return 1;
+        }
+        std::printf("frame image:     %s\n", options.dumpPath.c_str());
+    }
+
+    renderer.setParticleSystem(nullptr);
+    particles.shutdown();
+    renderer.shutdown();
+    return 0;
+}
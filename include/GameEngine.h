@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 
+#include <SFML/System/Clock.hpp>
+
 // Include ECS core
 #include <Entity.h>
 #include <Vec2.h>
@@ -12,6 +14,7 @@
 
 // Include system and manager headers
 #include <S2DPhysics.h>
+#include <SAnimation.h>
 #include <SAudio.h>
 #include <SCamera.h>
 #include <SInput.h>
@@ -115,6 +118,20 @@ public:
         return m_uiContext;
     }
 
+    /**
+     * @brief Shows or hides the Systems::RenderStatsOverlay window
+     *
+     * The first enable initializes ImGui-SFML on the render window and starts forwarding input to
+     * ImGui. While enabled, render() runs an ImGui frame after the world and UI and draws the overlay
+     * before presenting.
+     */
+    void setStatsOverlayEnabled(bool enabled);
+
+    bool isStatsOverlayEnabled() const
+    {
+        return m_statsOverlayEnabled;
+    }
+
     /**
      * @brief Checks if the game is still running
      * @return true if the game is running, false otherwise
@@ -147,12 +164,24 @@ public:
      */
     Systems::SRenderer& getRenderer();
 
+    /**
+     * @brief Gets per-system update times from the last update() call, in update order
+     *
+     * Pair with SRenderer::getRenderStats() (e.g. in Systems::RenderStatsOverlay).
+     */
+    const std::vector<Systems::SystemTiming>& getSystemTimings() const;
+
     /**
      * @brief Gets the particle system instance
      * @return Reference to the SParticle singleton
      */
     Systems::SParticle& getParticleSystem();
 
+    /**
+     * @brief Gets the sprite animation system instance
+     */
+    Systems::SAnimation& getAnimationSystem();
+
     /**
      * @brief Gets the objectives system instance
      */
@@ -193,6 +222,7 @@ private:
     std::unique_ptr<Systems::SScript>     m_script;      ///< Script system owned by engine
     std::unique_ptr<Systems::S2DPhysics>  m_physics;     ///< Physics system owned by engine
     std::unique_ptr<Systems::SCamera>     m_camera;      ///< Camera system owned by engine
+    std::unique_ptr<Systems::SAnimation>  m_animation;   ///< Sprite animation system owned by engine
     std::unique_ptr<Systems::SParticle>   m_particle;    ///< Particle system owned by engine
     std::unique_ptr<Systems::SAudio>      m_audio;       ///< Audio system owned by engine
     std::unique_ptr<Systems::SObjectives> m_objectives;  ///< Objectives system owned by engine
@@ -200,10 +230,15 @@ private:
     UI::UIContext*                  m_uiContext = nullptr;  ///< Optional UI overlay (non-owning)
     std::unique_ptr<UI::UIRenderer> m_uiRenderer;           ///< Renders UI overlay when set
 
-    std::vector<Systems::ISystem*> m_systemOrder;   ///< Ordered system update list
-    World                          m_world;         ///< Central world (registry + lifecycle)
-    const uint8_t                  m_subStepCount;  ///< Number of physics sub-steps per update
-    const float                    m_timeStep;      ///< Fixed time step for physics updates
+    bool      m_statsOverlayEnabled = false;  ///< Draw RenderStatsOverlay in render()
+    bool      m_imguiInitialized    = false;  ///< ImGui::SFML::Init succeeded on the render window
+    sf::Clock m_imguiClock;                   ///< Frame time fed to ImGui::SFML::Update
+
+    std::vector<Systems::ISystem*>     m_systemOrder;    ///< Ordered system update list
+    std::vector<Systems::SystemTiming> m_systemTimings;  ///< Update times parallel to m_systemOrder
+    World                              m_world;          ///< Central world (registry + lifecycle)
+    const uint8_t                      m_subStepCount;   ///< Number of physics sub-steps per update
+    const float                        m_timeStep;       ///< Fixed time step for physics updates
 
     bool  m_gameRunning = false;  ///< Flag indicating if the game is running
     float m_accumulator = 0.0f;   ///< Accumulator for fixed timestep updates
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <Entity.h>
 #include "KeyCode.h"
 #include "MouseButton.h"
 #include "Vec2i.h"
@@ -66,10 +67,12 @@ enum class ActionState
     Released
 };
 
+// Sent every frame while an action is not None, for global and CInputController actions alike.
 struct ActionEvent
 {
     std::string actionName;
-    ActionState state = ActionState::None;
+    ActionState state  = ActionState::None;
+    Entity      entity = Entity::null();  ///< CInputController owner; null for global actions
 };
 
 struct InputEvent
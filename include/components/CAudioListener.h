@@ -6,10 +6,17 @@
 namespace Components
 {
 
+/**
+ * @brief Ears of the scene for spatial audio
+ *
+ * The entity's CTransform is the listening position. The volumes are a legacy
+ * fallback used only when the world has no CAudioSettings.
+ */
 struct CAudioListener
 {
     float masterVolume = AudioConstants::DEFAULT_MASTER_VOLUME;
     float musicVolume  = AudioConstants::DEFAULT_MUSIC_VOLUME;
+    float panDistance  = AudioConstants::DEFAULT_PAN_DISTANCE;  ///< Horizontal offset that pans a source fully aside
 };
 
 }  // namespace Components
@@ -7,13 +7,25 @@
 namespace Components
 {
 
+/**
+ * @brief Sound effect emitted by an entity
+ *
+ * Spatial sources are attenuated by their distance to the audio listener (the
+ * first entity with CAudioListener and CTransform) and panned by the horizontal
+ * offset; without a CTransform on this entity they stay at the last known position.
+ *
+ * Playback is started and stopped by emitting Systems::AudioPlayRequest and
+ * Systems::AudioStopRequest on the world's EventBus.
+ */
 struct CAudioSource
 {
     std::string clipId{};
-    float       volume        = AudioConstants::DEFAULT_SFX_VOLUME;
-    bool        loop          = false;
-    bool        playRequested = false;
-    bool        stopRequested = false;
+    float       volume      = AudioConstants::DEFAULT_SFX_VOLUME;
+    int         priority    = AudioConstants::DEFAULT_SFX_PRIORITY;  ///< Higher wins when the voice pool is full
+    bool        loop        = false;
+    bool        spatial     = false;                                 ///< Position by this entity's CTransform
+    float       minDistance = AudioConstants::DEFAULT_MIN_DISTANCE;  ///< Full volume up to this distance
+    float       maxDistance = AudioConstants::DEFAULT_MAX_DISTANCE;  ///< Inaudible from this distance on
 };
 
 }  // namespace Components
@@ -1,9 +1,11 @@
 #ifndef CCAMERA_H
 #define CCAMERA_H
 
+#include <cstdint>
 #include <string>
 
 #include "Entity.h"
+#include "RenderLayers.h"
 #include "Vec2.h"
 
 namespace Components
@@ -36,6 +38,9 @@ struct CCamera
 
     int renderOrder = 0;
 
+    // Render layers this camera draws; items whose layer mask shares no bit with it are skipped.
+    std::uint32_t cullingMask = kRenderLayersAll;
+
     Entity followTarget  = Entity::null();
     bool   followEnabled = false;
     Vec2   followOffset  = Vec2(0.0f, 0.0f);
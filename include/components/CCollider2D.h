@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <vector>
 #include "Vec2.h"
@@ -72,6 +73,11 @@ struct CCollider2D
     float friction{0.3f};
     float restitution{0.0f};
 
+    // Collision filtering (Box2D semantics): two shapes collide when each one's category
+    // is in the other's mask. Queries such as particle collision match against categoryBits.
+    std::uint64_t categoryBits{0x0001};
+    std::uint64_t maskBits{~0ull};
+
     inline void clear()
     {
         fixtures.clear();
@@ -1,8 +1,11 @@
 #ifndef CMATERIAL_H
 #define CMATERIAL_H
 
+#include <cstdint>
 #include <string>
+#include <vector>
 #include "Color.h"
+#include "Vec2.h"
 
 namespace Components
 {
@@ -18,6 +21,29 @@ enum class BlendMode
     None       ///< No blending (replace)
 };
 
+/**
+ * @brief Value type of a per-material shader uniform
+ */
+enum class UniformType
+{
+    Float,  ///< float
+    Vec2,   ///< vec2
+    Color   ///< vec4, normalized from Color
+};
+
+/**
+ * @brief A named shader uniform owned by a material
+ */
+struct MaterialUniform
+{
+    std::string name;                       ///< Uniform name in the shader
+    UniformType type = UniformType::Float;  ///< Value type
+    float       x    = 0.0f;                ///< First component
+    float       y    = 0.0f;                ///< Second component (Vec2/Color)
+    float       z    = 0.0f;                ///< Third component (Color)
+    float       w    = 0.0f;                ///< Fourth component (Color)
+};
+
 /**
  * @brief Component for material properties
  *
@@ -27,6 +53,11 @@ enum class BlendMode
  * texture and shader resources while storing immediate material properties.
  * The rendering system uses this component to apply the correct visual
  * styling to entities.
+ *
+ * A material may also carry a uniform set for its entity's shader. The set is
+ * only reachable through the setters and is fingerprinted on every change so the renderer can skip uploads when the
+ * shader already holds the same values, and can group entities that share a
+ * uniform set next to each other in the draw order.
  */
 struct CMaterial
 {
@@ -61,9 +92,129 @@ struct CMaterial
         opacity = newOpacity;
     }
 
+    /**
+     * @brief Sets (or adds) a float uniform
+     */
+    inline void setUniform(const std::string& name, float value)
+    {
+        setUniformValue(name, UniformType::Float, value, 0.0f, 0.0f, 0.0f);
+    }
+    /**
+     * @brief Sets (or adds) a vec2 uniform
+     */
+    inline void setUniform(const std::string& name, const Vec2& value)
+    {
+        setUniformValue(name, UniformType::Vec2, value.x, value.y, 0.0f, 0.0f);
+    }
+    /**
+     * @brief Sets (or adds) a vec4 uniform from a color (components normalized to 0..1)
+     */
+    inline void setUniform(const std::string& name, const Color& value)
+    {
+        setUniformValue(name,
+                        UniformType::Color,
+                        static_cast<float>(value.r) / 255.0f,
+                        static_cast<float>(value.g) / 255.0f,
+                        static_cast<float>(value.b) / 255.0f,
+                        static_cast<float>(value.a) / 255.0f);
+    }
+    /**
+     * @brief Removes a uniform from the set
+     * @return true if the uniform existed
+     */
+    inline bool removeUniform(const std::string& name)
+    {
+        for (auto it = m_uniforms.begin(); it != m_uniforms.end(); ++it)
+        {
+            if (it->name == name)
+            {
+                m_uniforms.erase(it);
+                updateUniformsHash();
+                return true;
+            }
+        }
+        return false;
+    }
+    inline const std::vector<MaterialUniform>& getUniforms() const
+    {
+        return m_uniforms;
+    }
+    /**
+     * @brief Fingerprint of the uniform set (0 when the set is empty)
+     */
+    inline std::uint64_t getUniformsHash() const
+    {
+        return m_uniformsHash;
+    }
+
     Color     tint      = Color::White;
     BlendMode blendMode = BlendMode::Alpha;
     float     opacity   = 1.0f;
+
+private:
+    // Private so the fingerprint cannot drift from the set: every change goes through the setters.
+    std::vector<MaterialUniform> m_uniforms;          ///< Per-material shader uniforms
+    std::uint64_t                m_uniformsHash = 0;  ///< Fingerprint of m_uniforms
+
+    inline void setUniformValue(const std::string& name, UniformType type, float x, float y, float z, float w)
+    {
+        MaterialUniform* target = nullptr;
+        for (MaterialUniform& uniform : m_uniforms)
+        {
+            if (uniform.name == name)
+            {
+                target = &uniform;
+                break;
+            }
+        }
+        if (!target)
+        {
+            m_uniforms.push_back(MaterialUniform{name});
+            target = &m_uniforms.back();
+        }
+        else if (target->type == type && target->x == x && target->y == y && target->z == z && target->w == w)
+        {
+            return;
+        }
+
+        target->type = type;
+        target->x    = x;
+        target->y    = y;
+        target->z    = z;
+        target->w    = w;
+        updateUniformsHash();
+    }
+
+    inline void updateUniformsHash()
+    {
+        if (m_uniforms.empty())
+        {
+            m_uniformsHash = 0;
+            return;
+        }
+
+        // FNV-1a over names, types and raw value bits.
+        std::uint64_t hash    = 14695981039346656037ull;
+        auto          combine = [&hash](const void* data, std::size_t size)
+        {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+        };
+        for (const MaterialUniform& uniform : m_uniforms)
+        {
+            combine(uniform.name.data(), uniform.name.size());
+            const auto  type      = static_cast<std::uint8_t>(uniform.type);
+            const float values[4] = {uniform.x, uniform.y, uniform.z, uniform.w};
+            combine(&type, sizeof(type));
+            combine(values, sizeof(values));
+        }
+        // Reserve 0 for "no uniforms".
+        m_uniformsHash = hash == 0 ? 1 : hash;
+    }
 };
 
 }  // namespace Components
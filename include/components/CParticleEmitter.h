@@ -3,9 +3,15 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
+#include "AssetHandle.h"
 #include "Color.h"
+#include "ParticleBuffer.h"
+#include "ParticleCurve.h"
+#include "Random.h"
+#include "RenderLayers.h"
 #include "Vec2.h"
 
 namespace Components
@@ -31,22 +37,14 @@ enum class EmissionShape
 };
 
 /**
- * @brief Individual particle data structure
+ * @brief What a particle does when it hits a physics shape
  */
-struct Particle
+enum class ParticleCollision
 {
-    Vec2  position{0.0f, 0.0f};      ///< Current position in world space (meters)
-    Vec2  velocity{0.0f, 0.0f};      ///< Current velocity (meters/second)
-    Vec2  acceleration{0.0f, 0.0f};  ///< Current acceleration (meters/second²)
-    Color color{Color::White};       ///< Particle color
-    float alpha{1.0f};               ///< Alpha transparency (0.0 to 1.0)
-    float lifetime{1.0f};            ///< Total lifetime in seconds
-    float age{0.0f};                 ///< Current age in seconds
-    float size{0.5f};                ///< Particle size (radius in meters)
-    float initialSize{0.5f};         ///< Initial size for shrink effect
-    float rotation{0.0f};            ///< Current rotation in radians
-    float rotationSpeed{0.0f};       ///< Rotation speed in radians/second
-    bool  alive{false};              ///< Is particle still alive?
+    None,    ///< Particles pass through shapes (default)
+    Bounce,  ///< Reflect off the surface (see collision restitution/friction)
+    Die,     ///< Expire on contact
+    Stick    ///< Stop at the contact point for the rest of their lifetime
 };
 
 /**
@@ -67,8 +65,7 @@ public:
      */
     inline size_t getAliveCount() const
     {
-        return static_cast<size_t>(
-            std::count_if(m_particles.begin(), m_particles.end(), [](const Particle& p) { return p.alive; }));
+        return m_particles.count();
     }
 
     bool isActive() const
@@ -161,6 +158,33 @@ public:
     {
         m_burstCount = count;
     }
+
+    /**
+     * @brief Queues particles to spawn together on the next update
+     * @param count Particles to spawn (clamped to the room left under maxParticles)
+     *
+     * Bursts accumulate until SParticle spawns them; an inactive emitter keeps them queued.
+     */
+    inline void burst(int count)
+    {
+        if (count > 0)
+        {
+            m_pendingBurst += count;
+        }
+    }
+    /// Queues a burst of getBurstCount() particles
+    inline void triggerBurst()
+    {
+        burst(static_cast<int>(m_burstCount));
+    }
+    inline int getPendingBurst() const
+    {
+        return m_pendingBurst;
+    }
+    inline void clearPendingBurst()
+    {
+        m_pendingBurst = 0;
+    }
     inline Color getStartColor() const
     {
         return m_startColor;
@@ -241,6 +265,120 @@ public:
     {
         m_shrinkEndScale = scale;
     }
+
+    /**
+     * @brief Lifetime curves (sampled into lookup tables when set; an empty curve clears it)
+     *
+     * - Color gradient: replaces the start/end color blend
+     * - Alpha curve: replaces the start/end alpha fade (applies regardless of fadeOut)
+     * - Size curve: multiplier of the spawn size; replaces shrink
+     * - Speed curve: multiplier of the velocity when moving the particle
+     */
+    inline const ColorGradient& getColorGradient() const
+    {
+        return m_colorGradient;
+    }
+    inline void setColorGradient(const ColorGradient& gradient)
+    {
+        m_colorGradient = gradient;
+        m_curveTables.bakeColor(m_colorGradient);
+    }
+    inline const FloatCurve& getAlphaCurve() const
+    {
+        return m_alphaCurve;
+    }
+    inline void setAlphaCurve(const FloatCurve& curve)
+    {
+        m_alphaCurve = curve;
+        m_curveTables.bakeAlpha(m_alphaCurve);
+    }
+    inline const FloatCurve& getSizeCurve() const
+    {
+        return m_sizeCurve;
+    }
+    inline void setSizeCurve(const FloatCurve& curve)
+    {
+        m_sizeCurve = curve;
+        m_curveTables.bakeSize(m_sizeCurve);
+    }
+    inline const FloatCurve& getSpeedCurve() const
+    {
+        return m_speedCurve;
+    }
+    inline void setSpeedCurve(const FloatCurve& curve)
+    {
+        m_speedCurve = curve;
+        m_curveTables.bakeSpeed(m_speedCurve);
+    }
+    /// Baked lookup tables for the curves above
+    inline const ParticleCurveTables& getCurveTables() const
+    {
+        return m_curveTables;
+    }
+
+    /**
+     * @brief Weight of this emitter when SParticle thins emission to stay under its budget
+     *
+     * Higher keeps more of the emitter's spawns; 0 lets it be starved first. Default 1.
+     */
+    inline float getImportance() const
+    {
+        return m_importance;
+    }
+    inline void setImportance(float importance)
+    {
+        m_importance = std::max(importance, 0.0f);
+    }
+
+    /**
+     * @brief Collision against S2DPhysics shapes (requires SParticle::setPhysics())
+     *
+     * Particles are tested as the segment they moved along in an update. Category and
+     * mask follow Box2D filtering against the shapes' CCollider2D::categoryBits/maskBits.
+     * Restitution scales the bounced normal speed; friction removes that fraction of the
+     * tangential speed on each bounce.
+     */
+    inline ParticleCollision getCollisionMode() const
+    {
+        return m_collisionMode;
+    }
+    inline void setCollisionMode(ParticleCollision mode)
+    {
+        m_collisionMode = mode;
+    }
+    inline std::uint64_t getCollisionCategory() const
+    {
+        return m_collisionCategory;
+    }
+    inline void setCollisionCategory(std::uint64_t category)
+    {
+        m_collisionCategory = category;
+    }
+    inline std::uint64_t getCollisionMask() const
+    {
+        return m_collisionMask;
+    }
+    inline void setCollisionMask(std::uint64_t mask)
+    {
+        m_collisionMask = mask;
+    }
+    inline float getCollisionRestitution() const
+    {
+        return m_collisionRestitution;
+    }
+    inline void setCollisionRestitution(float restitution)
+    {
+        m_collisionRestitution = restitution;
+    }
+    inline float getCollisionFriction() const
+    {
+        return m_collisionFriction;
+    }
+    inline void setCollisionFriction(float friction)
+    {
+        m_collisionFriction = std::clamp(friction, 0.0f, 1.0f);
+    }
+
     inline int getMaxParticles() const
     {
         return m_maxParticles;
@@ -341,7 +479,17 @@ public:
     }
     inline void setTexturePath(const std::string& path)
     {
-        m_texturePath = path;
+        m_texturePath   = path;
+        m_textureHandle = kInvalidAssetHandle;
+    }
+    /// Loader handle cached by SParticle (runtime only, reset when the path changes)
+    inline AssetHandle getTextureHandle() const
+    {
+        return m_textureHandle;
+    }
+    inline void setTextureHandle(AssetHandle handle)
+    {
+        m_textureHandle = handle;
     }
 
     // Z-index for render ordering
@@ -354,12 +502,22 @@ public:
         m_zIndex = zIndex;
     }
 
+    // Render layers matched against CCamera::cullingMask (see RenderLayers.h)
+    inline std::uint32_t getRenderLayers() const
+    {
+        return m_renderLayers;
+    }
+    inline void setRenderLayers(std::uint32_t layers)
+    {
+        m_renderLayers = layers;
+    }
+
     // Runtime state access
-    inline std::vector<Particle>& getParticles()
+    inline ParticleBuffer& getParticles()
     {
         return m_particles;
     }
-    inline const std::vector<Particle>& getParticles() const
+    inline const ParticleBuffer& getParticles() const
     {
         return m_particles;
     }
@@ -372,6 +530,26 @@ public:
         m_emissionTimer = timer;
     }
 
+    /**
+     * @brief Seeds the stream this emitter samples spawns from
+     *
+     * SParticle seeds an unseeded emitter from its own seed and the entity on the
+     * emitter's first update; call this to pin an emitter to a specific sequence.
+     */
+    inline void setRandomSeed(std::uint64_t seed)
+    {
+        m_random.seed(seed);
+        m_randomSeeded = true;
+    }
+    inline bool hasRandomSeed() const
+    {
+        return m_randomSeeded;
+    }
+    inline Random& getRandom()
+    {
+        return m_random;
+    }
+
 private:
     bool m_enabled = true;  ///< Whether the emitter is active
 
@@ -397,9 +575,26 @@ private:
     bool  m_shrink           = true;              ///< Should particles shrink over lifetime?
     float m_shrinkEndScale   = 0.1f;              ///< Final size scale when fully shrunk
     int   m_maxParticles     = 200;               ///< Maximum number of particles
+    float m_importance       = 1.0f;              ///< Budget weight (see SParticle::setParticleBudget)
     int   m_zIndex           = 0;                 ///< Render layer (lower = behind)
     Vec2  m_positionOffset   = Vec2(0.0f, 0.0f);  ///< Offset from entity position
 
+    std::uint32_t m_renderLayers = kRenderLayerDefault;  ///< Layer mask matched against CCamera::cullingMask
+
+    // Collision against physics shapes
+    ParticleCollision m_collisionMode        = ParticleCollision::None;  ///< Response on contact
+    std::uint64_t     m_collisionCategory    = 0x0001;                   ///< Box2D category of the particles
+    std::uint64_t     m_collisionMask        = ~0ull;                    ///< Shape categories particles hit
+    float             m_collisionRestitution = 0.5f;                     ///< Bounced fraction of normal speed
+    float             m_collisionFriction    = 0.1f;                     ///< Tangential speed lost per bounce
+
+    // Lifetime curves and their baked tables
+    ColorGradient       m_colorGradient;  ///< Color over lifetime (empty: start/end color)
+    FloatCurve          m_alphaCurve;     ///< Alpha over lifetime (empty: start/end alpha)
+    FloatCurve          m_sizeCurve;      ///< Size multiplier over lifetime (empty: shrink settings)
+    FloatCurve          m_speedCurve;     ///< Speed multiplier over lifetime (empty: constant)
+    ParticleCurveTables m_curveTables;    ///< Curves above sampled by normalized age
+
     // Emission shape configuration
     EmissionShape     m_emissionShape = EmissionShape::Point;  ///< Shape for emission distribution
     float             m_shapeRadius   = 1.0f;                  ///< Radius for circle shape (meters)
@@ -411,11 +606,15 @@ private:
     bool              m_emitOutward  = false;                  ///< Emit in direction away from shape center
 
     // Resources (by reference)
-    std::string m_texturePath;  ///< Optional texture path for particles
+    std::string m_texturePath;                         ///< Optional texture path for particles
+    AssetHandle m_textureHandle = kInvalidAssetHandle;  ///< Resolved texture handle (runtime only)
 
     // Runtime state
-    std::vector<Particle> m_particles;             ///< All particles (alive and dead)
-    float                 m_emissionTimer = 0.0f;  ///< Time accumulator for continuous emission
+    ParticleBuffer m_particles;              ///< SoA particle storage (alive prefix)
+    float          m_emissionTimer = 0.0f;   ///< Time accumulator for continuous emission
+    int            m_pendingBurst  = 0;      ///< Particles queued by burst() (runtime only)
+    Random         m_random;                 ///< Spawn sampling stream (runtime only)
+    bool           m_randomSeeded  = false;  ///< Whether m_random has been seeded (runtime only)
 };
 
 }  // namespace Components
@@ -1,8 +1,10 @@
 #ifndef CRENDERABLE_H
 #define CRENDERABLE_H
 
+#include <cstdint>
 #include <string>
 #include "Color.h"
+#include "RenderLayers.h"
 #include "Vec2.h"
 
 namespace Components
@@ -21,6 +23,16 @@ enum class VisualType
     Custom      ///< Custom rendering (via shader/material)
 };
 
+/**
+ * @brief End cap style for thick lines
+ */
+enum class LineCap
+{
+    Butt,    ///< Line ends exactly at its endpoints (default)
+    Square,  ///< Extended by half the thickness past each endpoint
+    Round    ///< Semicircular ends
+};
+
 /**
  * @brief Component for rendering visual representation of entities
  *
@@ -98,15 +110,55 @@ struct CRenderable
     {
         lineThickness = thickness;
     }
+    inline LineCap getLineCap() const
+    {
+        return lineCap;
+    }
+    inline void setLineCap(LineCap cap)
+    {
+        lineCap = cap;
+    }
+
+    /**
+     * @brief Whether the entity is static scenery
+     *
+     * Static entities sharing a zIndex are drawn once into a cached layer texture per camera
+     * and re-rendered only when one of them changes or the camera moves past the cache margin.
+     * Only alpha-blended entities without a CShader are cached; others are drawn every frame,
+     * since shaders receive u_time and the layer is composited with a single blend mode.
+     */
+    inline bool isStatic() const
+    {
+        return staticLayer;
+    }
+    inline void setStatic(bool isStatic)
+    {
+        staticLayer = isStatic;
+    }
+
+    /**
+     * @brief Render layers the entity belongs to (see RenderLayers.h)
+     */
+    inline std::uint32_t getRenderLayers() const
+    {
+        return renderLayers;
+    }
+    inline void setRenderLayers(std::uint32_t layers)
+    {
+        renderLayers = layers;
+    }
 
-    VisualType visualType = VisualType::None;
-    Color      color      = Color::White;
-    int        zIndex     = 0;
-    bool       visible    = true;
+    VisualType    visualType   = VisualType::None;
+    Color         color        = Color::White;
+    int           zIndex       = 0;
+    bool          visible      = true;
+    bool          staticLayer  = false;                ///< Drawn from a cached layer texture (see isStatic())
+    std::uint32_t renderLayers = kRenderLayerDefault;  ///< Layer mask matched against CCamera::cullingMask
 
-    Vec2  lineStart     = Vec2(0.0f, 0.0f);
-    Vec2  lineEnd       = Vec2(1.0f, 0.0f);
-    float lineThickness = 2.0f;
+    Vec2    lineStart     = Vec2(0.0f, 0.0f);
+    Vec2    lineEnd       = Vec2(1.0f, 0.0f);
+    float   lineThickness = 2.0f;           ///< Line width in pixels (at the engine's 100 px/m scale)
+    LineCap lineCap       = LineCap::Butt;  ///< End cap style for lines
 };
 
 }  // namespace Components
@@ -2,6 +2,7 @@
 #define CSHADER_H
 
 #include <string>
+#include "AssetHandle.h"
 
 namespace Components
 {
@@ -14,34 +15,53 @@ namespace Components
  * paths to vertex and fragment shader files and acts as a reference for the
  * rendering system. The actual shader loading and compilation is handled by
  * the rendering system to avoid duplicate shader loads and improve performance.
+ *
+ * The renderer resolves the path pair to a handle the first time the entity is
+ * drawn and caches it in shaderHandle. The paths are private: the setters are the
+ * only way to change them, so the cached handle cannot go stale.
  */
 struct CShader
 {
+public:
     CShader() = default;
     CShader(const std::string& vertexPath, const std::string& fragmentPath)
-        : vertexShaderPath(vertexPath), fragmentShaderPath(fragmentPath)
+        : m_vertexShaderPath(vertexPath), m_fragmentShaderPath(fragmentPath)
     {
     }
 
-    inline std::string getVertexShaderPath() const
+    inline const std::string& getVertexShaderPath() const
     {
-        return vertexShaderPath;
+        return m_vertexShaderPath;
     }
     inline void setVertexShaderPath(const std::string& vertexPath)
     {
-        vertexShaderPath = vertexPath;
+        if (vertexPath == m_vertexShaderPath)
+        {
+            return;
+        }
+        m_vertexShaderPath = vertexPath;
+        shaderHandle       = kInvalidAssetHandle;
     }
-    inline std::string getFragmentShaderPath() const
+    inline const std::string& getFragmentShaderPath() const
     {
-        return fragmentShaderPath;
+        return m_fragmentShaderPath;
     }
     inline void setFragmentShaderPath(const std::string& fragmentPath)
     {
-        fragmentShaderPath = fragmentPath;
+        if (fragmentPath == m_fragmentShaderPath)
+        {
+            return;
+        }
+        m_fragmentShaderPath = fragmentPath;
+        shaderHandle         = kInvalidAssetHandle;
     }
 
-    std::string vertexShaderPath;
-    std::string fragmentShaderPath;
+    AssetHandle shaderHandle = kInvalidAssetHandle;  ///< Renderer-resolved handle (runtime only, not serialized)
+
+private:
+    // Only changed through the setters, which drop the cached handle
+    std::string m_vertexShaderPath;
+    std::string m_fragmentShaderPath;
 };
 
 }  // namespace Components
@@ -0,0 +1,133 @@
+#ifndef CSPRITEANIMATION_H
+#define CSPRITEANIMATION_H
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "CTexture.h"
+
+namespace Components
+{
+
+/**
+ * @brief One frame of a sprite animation
+ */
+struct SpriteFrame
+{
+    TextureRect rect;             ///< Atlas region in pixels
+    float       duration = 0.1f;  ///< Seconds the frame is shown at speed 1
+    std::string event;            ///< Emitted as SpriteAnimationEvent when the frame is entered (empty = none)
+};
+
+/**
+ * @brief Frame-table sprite animation over a texture atlas
+ *
+ * @description
+ * SAnimation advances every animation once per frame and writes the current frame's
+ * rect into the entity's CTexture::textureRect; the texture itself never changes, so
+ * frames switch without path lookups and sprites sharing the atlas still batch.
+ *
+ * Playback state (currentFrame, frameTime, finished) is runtime only; a loaded
+ * animation starts from its first frame.
+ */
+struct CSpriteAnimation
+{
+    CSpriteAnimation() = default;
+
+    /**
+     * @brief Appends a frame
+     */
+    inline void addFrame(const TextureRect& rect, float duration, const std::string& event = std::string{})
+    {
+        frames.push_back(SpriteFrame{rect, duration, event});
+    }
+
+    /**
+     * @brief Appends frames cut from a uniform grid
+     * @param cellWidth Cell width in pixels
+     * @param cellHeight Cell height in pixels
+     * @param columns Cells per atlas row
+     * @param first Index of the first cell (row-major)
+     * @param count Number of consecutive cells to append
+     * @param duration Seconds each frame is shown at speed 1
+     */
+    inline void addGridFrames(std::int32_t  cellWidth,
+                              std::int32_t  cellHeight,
+                              std::uint32_t columns,
+                              std::uint32_t first,
+                              std::uint32_t count,
+                              float         duration)
+    {
+        if (columns == 0)
+        {
+            return;
+        }
+        for (std::uint32_t cell = first; cell < first + count; ++cell)
+        {
+            TextureRect rect;
+            rect.left   = static_cast<std::int32_t>(cell % columns) * cellWidth;
+            rect.top    = static_cast<std::int32_t>(cell / columns) * cellHeight;
+            rect.width  = cellWidth;
+            rect.height = cellHeight;
+            addFrame(rect, duration);
+        }
+    }
+
+    /**
+     * @brief Resumes playback (restarting a finished one-shot animation)
+     */
+    inline void play()
+    {
+        if (finished)
+        {
+            setFrame(0);
+        }
+        playing = true;
+    }
+
+    /**
+     * @brief Pauses on the current frame
+     */
+    inline void pause()
+    {
+        playing = false;
+    }
+
+    /**
+     * @brief Jumps to a frame (clamped to the table) and restarts its timer
+     */
+    inline void setFrame(std::uint32_t index)
+    {
+        currentFrame = frames.empty() ? 0u : std::min(index, static_cast<std::uint32_t>(frames.size() - 1));
+        frameTime    = 0.0f;
+        finished     = false;
+        rectDirty    = true;
+        eventPending = true;
+    }
+
+    inline std::uint32_t getCurrentFrame() const
+    {
+        return currentFrame;
+    }
+    inline bool isFinished() const
+    {
+        return finished;
+    }
+
+    std::vector<SpriteFrame> frames;          ///< Frame table, played in order
+    float                    speed   = 1.0f;  ///< Playback rate multiplier (0 holds the current frame)
+    bool                     loop    = true;  ///< Wrap to the first frame after the last
+    bool                     playing = true;  ///< Whether time advances
+
+    std::uint32_t currentFrame = 0;      ///< Frame being shown (runtime only)
+    float         frameTime    = 0.0f;   ///< Seconds spent on the current frame (runtime only)
+    bool          finished     = false;  ///< A non-looping animation reached its last frame (runtime only)
+    bool          rectDirty    = true;   ///< CTexture::textureRect needs the current frame (runtime only)
+    bool          eventPending = true;   ///< The current frame's event is not emitted yet (runtime only)
+};
+
+}  // namespace Components
+
+#endif  // CSPRITEANIMATION_H
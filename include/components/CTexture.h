@@ -1,11 +1,38 @@
 #ifndef CTEXTURE_H
 #define CTEXTURE_H
 
+#include <cstdint>
 #include <string>
+#include "AssetHandle.h"
 
 namespace Components
 {
 
+/**
+ * @brief Rectangle inside a texture, in pixels (origin at the top-left)
+ */
+struct TextureRect
+{
+    std::int32_t left   = 0;
+    std::int32_t top    = 0;
+    std::int32_t width  = 0;
+    std::int32_t height = 0;
+
+    inline bool isEmpty() const
+    {
+        return width <= 0 || height <= 0;
+    }
+
+    inline bool operator==(const TextureRect& other) const
+    {
+        return left == other.left && top == other.top && width == other.width && height == other.height;
+    }
+    inline bool operator!=(const TextureRect& other) const
+    {
+        return !(*this == other);
+    }
+};
+
 /**
  * @brief Component for texture resources
  *
@@ -14,22 +41,49 @@ namespace Components
  * path to the texture file and acts as a reference for the rendering system.
  * The actual texture loading and caching is handled by the rendering system
  * to avoid duplicate texture loads and improve performance.
+ *
+ * The renderer resolves the path to a handle the first time the entity is drawn
+ * and caches it in textureHandle. The path is private: setTexturePath() is the only
+ * way to change it, so the cached handle cannot go stale.
+ *
+ * textureRect selects a region of the texture (e.g. one frame of an atlas, set by
+ * SAnimation); an empty rect draws the whole texture. Changing the rect costs no
+ * lookup, so switch frames through it rather than through the path.
  */
 struct CTexture
 {
+public:
     CTexture() = default;
-    explicit CTexture(const std::string& texturePath) : texturePath(texturePath) {}
+    explicit CTexture(const std::string& texturePath) : m_texturePath(texturePath) {}
 
-    inline std::string getTexturePath() const
+    inline const std::string& getTexturePath() const
     {
-        return texturePath;
+        return m_texturePath;
     }
     inline void setTexturePath(const std::string& newTexturePath)
     {
-        texturePath = newTexturePath;
+        if (newTexturePath == m_texturePath)
+        {
+            return;
+        }
+        m_texturePath = newTexturePath;
+        textureHandle = kInvalidAssetHandle;
+    }
+
+    inline const TextureRect& getTextureRect() const
+    {
+        return textureRect;
     }
+    inline void setTextureRect(const TextureRect& rect)
+    {
+        textureRect = rect;
+    }
+
+    TextureRect textureRect;                          ///< Region to draw in pixels; empty draws the whole texture
+    AssetHandle textureHandle = kInvalidAssetHandle;  ///< Renderer-resolved handle (runtime only, not serialized)
 
-    std::string texturePath;
+private:
+    std::string m_texturePath;  ///< Only changed through setTexturePath(), which drops the cached handle
 };
 
 }  // namespace Components
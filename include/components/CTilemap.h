@@ -0,0 +1,213 @@
+#ifndef CTILEMAP_H
+#define CTILEMAP_H
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "AssetHandle.h"
+#include "RenderLayers.h"
+
+namespace Components
+{
+
+/**
+ * @brief Grid of atlas tiles drawn in chunks
+ *
+ * @description
+ * Tiles are stored row-major, with tile (0, 0) at the entity's CTransform position
+ * and rows growing along +Y (world up). Each tile is an index into a texture atlas
+ * laid out left-to-right, top-to-bottom in cells of tilePixelWidth x tilePixelHeight;
+ * kEmptyTile leaves the cell blank.
+ *
+ * The renderer builds one vertex buffer per chunk of kChunkSize x kChunkSize tiles
+ * and draws only chunks that intersect the camera view. The tiles, map size, atlas and
+ * cell sizes are private so every change goes through a setter that invalidates the
+ * renderer's meshes: setTile() bumps only the containing chunk's revision, while
+ * resize(), fill(), setTiles() and the atlas/size setters rebuild every chunk.
+ */
+struct CTilemap
+{
+public:
+    static constexpr std::int32_t  kEmptyTile = -1;  ///< Tile index for an empty cell
+    static constexpr std::uint32_t kChunkSize = 32;  ///< Chunk edge length in tiles
+
+    CTilemap() = default;
+    CTilemap(std::uint32_t widthTiles, std::uint32_t heightTiles, float tileWorldSize, const std::string& atlas)
+        : m_atlasPath(atlas), m_tileSize(tileWorldSize)
+    {
+        resize(widthTiles, heightTiles);
+    }
+
+    /**
+     * @brief Resizes the map, clearing every tile to the fill value
+     */
+    inline void resize(std::uint32_t widthTiles, std::uint32_t heightTiles, std::int32_t fill = kEmptyTile)
+    {
+        m_width  = widthTiles;
+        m_height = heightTiles;
+        m_tiles.assign(static_cast<std::size_t>(m_width) * m_height, fill);
+        m_chunkRevisions.assign(static_cast<std::size_t>(getChunksX()) * getChunksY(), 1u);
+        ++layoutRevision;
+    }
+
+    inline std::uint32_t getWidth() const
+    {
+        return m_width;
+    }
+    inline std::uint32_t getHeight() const
+    {
+        return m_height;
+    }
+
+    /**
+     * @brief Gets a tile index, or kEmptyTile outside the map
+     */
+    inline std::int32_t getTile(std::uint32_t x, std::uint32_t y) const
+    {
+        if (x >= m_width || y >= m_height)
+        {
+            return kEmptyTile;
+        }
+        return m_tiles[static_cast<std::size_t>(y) * m_width + x];
+    }
+
+    /**
+     * @brief Sets a tile index and marks its chunk for rebuild (no-op outside the map or if unchanged)
+     */
+    inline void setTile(std::uint32_t x, std::uint32_t y, std::int32_t tile)
+    {
+        if (x >= m_width || y >= m_height)
+        {
+            return;
+        }
+        std::int32_t& cell = m_tiles[static_cast<std::size_t>(y) * m_width + x];
+        if (cell == tile)
+        {
+            return;
+        }
+        cell = tile;
+        ++m_chunkRevisions[static_cast<std::size_t>(y / kChunkSize) * getChunksX() + x / kChunkSize];
+    }
+
+    /**
+     * @brief Row-major tile indices (width * height)
+     */
+    inline const std::vector<std::int32_t>& getTiles() const
+    {
+        return m_tiles;
+    }
+
+    /**
+     * @brief Replaces every tile at once (e.g. when loading a map)
+     * @return False, leaving the map unchanged, if tiles does not hold width * height entries
+     */
+    inline bool setTiles(const std::vector<std::int32_t>& tiles)
+    {
+        if (tiles.size() != m_tiles.size())
+        {
+            return false;
+        }
+        m_tiles = tiles;
+        markAllDirty();
+        return true;
+    }
+
+    /**
+     * @brief Sets every tile to the given index
+     */
+    inline void fill(std::int32_t tile)
+    {
+        std::fill(m_tiles.begin(), m_tiles.end(), tile);
+        markAllDirty();
+    }
+
+    /**
+     * @brief Forces every chunk to rebuild
+     */
+    inline void markAllDirty()
+    {
+        ++layoutRevision;
+    }
+
+    inline std::uint32_t getChunksX() const
+    {
+        return (m_width + kChunkSize - 1) / kChunkSize;
+    }
+    inline std::uint32_t getChunksY() const
+    {
+        return (m_height + kChunkSize - 1) / kChunkSize;
+    }
+
+    /**
+     * @brief Revision of a chunk's tiles; changes whenever a tile in the chunk changes
+     */
+    inline std::uint32_t getChunkRevision(std::uint32_t chunkX, std::uint32_t chunkY) const
+    {
+        return m_chunkRevisions[static_cast<std::size_t>(chunkY) * getChunksX() + chunkX];
+    }
+
+    inline const std::string& getAtlasPath() const
+    {
+        return m_atlasPath;
+    }
+    inline void setAtlasPath(const std::string& path)
+    {
+        if (path == m_atlasPath)
+        {
+            return;
+        }
+        m_atlasPath = path;
+        atlasHandle = kInvalidAssetHandle;
+        markAllDirty();
+    }
+
+    inline std::uint32_t getTilePixelWidth() const
+    {
+        return m_tilePixelWidth;
+    }
+    inline std::uint32_t getTilePixelHeight() const
+    {
+        return m_tilePixelHeight;
+    }
+    inline void setTilePixelSize(std::uint32_t widthPx, std::uint32_t heightPx)
+    {
+        m_tilePixelWidth  = widthPx;
+        m_tilePixelHeight = heightPx;
+        markAllDirty();
+    }
+
+    inline float getTileSize() const
+    {
+        return m_tileSize;
+    }
+    inline void setTileSize(float worldSize)
+    {
+        m_tileSize = worldSize;
+        markAllDirty();
+    }
+
+    int           zIndex       = 0;                    ///< Draw order relative to other renderables
+    bool          visible      = true;                 ///< Whether the map is drawn
+    std::uint32_t renderLayers = kRenderLayerDefault;  ///< Layer mask matched against CCamera::cullingMask
+
+    std::uint32_t layoutRevision = 0;                    ///< Bumped to rebuild every chunk (runtime only)
+    AssetHandle   atlasHandle    = kInvalidAssetHandle;  ///< Renderer-resolved atlas (runtime only)
+
+private:
+    std::string   m_atlasPath;               ///< Atlas texture path; setAtlasPath() drops atlasHandle
+    std::uint32_t m_tilePixelWidth  = 32;    ///< Atlas cell width in pixels
+    std::uint32_t m_tilePixelHeight = 32;    ///< Atlas cell height in pixels
+    float         m_tileSize        = 1.0f;  ///< Tile edge length in world units (meters)
+
+    std::uint32_t             m_width  = 0;  ///< Map width in tiles
+    std::uint32_t             m_height = 0;  ///< Map height in tiles
+    std::vector<std::int32_t> m_tiles;       ///< Row-major tile indices (width * height)
+
+    std::vector<std::uint32_t> m_chunkRevisions;  ///< Per-chunk edit counters (runtime only)
+};
+
+}  // namespace Components
+
+#endif  // CTILEMAP_H
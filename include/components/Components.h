@@ -30,6 +30,8 @@
 #include "CName.h"
 #include "CObjectives.h"
 #include "CShader.h"
+#include "CSpriteAnimation.h"
 #include "CTexture.h"
+#include "CTilemap.h"
 
 #endif  // COMPONENTS_H
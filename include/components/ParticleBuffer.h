@@ -0,0 +1,226 @@
+#ifndef PARTICLEBUFFER_H
+#define PARTICLEBUFFER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "Color.h"
+#include "Vec2.h"
+
+namespace Components
+{
+
+/**
+ * @brief Individual particle values, used to spawn into and read from a ParticleBuffer
+ */
+struct Particle
+{
+    Vec2  position{0.0f, 0.0f};      ///< Current position in world space (meters)
+    Vec2  velocity{0.0f, 0.0f};      ///< Current velocity (meters/second)
+    Vec2  acceleration{0.0f, 0.0f};  ///< Current acceleration (meters/second²)
+    Color color{Color::White};       ///< Particle color
+    float alpha{1.0f};               ///< Alpha transparency (0.0 to 1.0)
+    float lifetime{1.0f};            ///< Total lifetime in seconds
+    float age{0.0f};                 ///< Current age in seconds
+    float size{0.5f};                ///< Particle size (radius in meters)
+    float initialSize{0.5f};         ///< Initial size for shrink effect
+    float rotation{0.0f};            ///< Current rotation in radians
+    float rotationSpeed{0.0f};       ///< Rotation speed in radians/second
+};
+
+/**
+ * @brief Structure-of-arrays particle storage
+ *
+ * @description
+ * Each particle attribute lives in its own array so the update kernel can stream
+ * positions, velocities and ages with SIMD loads. Alive particles are always the
+ * contiguous prefix [0, count()); kill() moves the last alive particle into the
+ * freed slot, so particle order is not stable across deaths.
+ *
+ * The arrays are sized to capacity(); entries past count() are stale.
+ */
+struct ParticleBuffer
+{
+    /**
+     * @brief Number of alive particles
+     */
+    inline std::size_t count() const
+    {
+        return m_count;
+    }
+
+    inline bool empty() const
+    {
+        return m_count == 0;
+    }
+
+    /**
+     * @brief Number of particles the arrays can hold without growing
+     */
+    inline std::size_t capacity() const
+    {
+        return age.size();
+    }
+
+    /**
+     * @brief Grows every array to hold at least n particles
+     */
+    inline void reserve(std::size_t n)
+    {
+        if (n > capacity())
+        {
+            resizeArrays(n);
+        }
+    }
+
+    /**
+     * @brief Kills every particle (capacity is kept)
+     */
+    inline void clear()
+    {
+        m_count = 0;
+    }
+
+    /**
+     * @brief Appends a particle to the alive prefix
+     * @return Index of the new particle
+     */
+    inline std::size_t push(const Particle& particle)
+    {
+        if (m_count == capacity())
+        {
+            resizeArrays(std::max<std::size_t>(16, capacity() * 2));
+        }
+        set(m_count, particle);
+        return m_count++;
+    }
+
+    /**
+     * @brief Kills the particle at index by moving the last alive particle into its slot
+     */
+    inline void kill(std::size_t index)
+    {
+        const std::size_t last = m_count - 1;
+        if (index != last)
+        {
+            positionX[index]     = positionX[last];
+            positionY[index]     = positionY[last];
+            velocityX[index]     = velocityX[last];
+            velocityY[index]     = velocityY[last];
+            accelerationX[index] = accelerationX[last];
+            accelerationY[index] = accelerationY[last];
+            age[index]           = age[last];
+            lifetime[index]      = lifetime[last];
+            size[index]          = size[last];
+            initialSize[index]   = initialSize[last];
+            rotation[index]      = rotation[last];
+            rotationSpeed[index] = rotationSpeed[last];
+            alpha[index]         = alpha[last];
+            color[index]         = color[last];
+        }
+        --m_count;
+    }
+
+    /**
+     * @brief Kills every particle whose age has reached its lifetime
+     * @return Number of particles removed
+     */
+    inline std::size_t removeExpired()
+    {
+        const std::size_t before = m_count;
+        std::size_t       i      = 0;
+        while (i < m_count)
+        {
+            if (age[i] >= lifetime[i])
+            {
+                kill(i);  // Re-test i: it now holds the former last particle.
+            }
+            else
+            {
+                ++i;
+            }
+        }
+        return before - m_count;
+    }
+
+    /**
+     * @brief Gathers the particle at index into a value
+     */
+    inline Particle get(std::size_t index) const
+    {
+        Particle particle;
+        particle.position      = Vec2(positionX[index], positionY[index]);
+        particle.velocity      = Vec2(velocityX[index], velocityY[index]);
+        particle.acceleration  = Vec2(accelerationX[index], accelerationY[index]);
+        particle.color         = color[index];
+        particle.alpha         = alpha[index];
+        particle.lifetime      = lifetime[index];
+        particle.age           = age[index];
+        particle.size          = size[index];
+        particle.initialSize   = initialSize[index];
+        particle.rotation      = rotation[index];
+        particle.rotationSpeed = rotationSpeed[index];
+        return particle;
+    }
+
+    /**
+     * @brief Scatters a particle value into the slot at index
+     */
+    inline void set(std::size_t index, const Particle& particle)
+    {
+        positionX[index]     = particle.position.x;
+        positionY[index]     = particle.position.y;
+        velocityX[index]     = particle.velocity.x;
+        velocityY[index]     = particle.velocity.y;
+        accelerationX[index] = particle.acceleration.x;
+        accelerationY[index] = particle.acceleration.y;
+        age[index]           = particle.age;
+        lifetime[index]      = particle.lifetime;
+        size[index]          = particle.size;
+        initialSize[index]   = particle.initialSize;
+        rotation[index]      = particle.rotation;
+        rotationSpeed[index] = particle.rotationSpeed;
+        alpha[index]         = particle.alpha;
+        color[index]         = particle.color;
+    }
+
+    std::vector<float> positionX;      ///< World-space X (meters)
+    std::vector<float> positionY;      ///< World-space Y (meters)
+    std::vector<float> velocityX;      ///< Velocity X (meters/second)
+    std::vector<float> velocityY;      ///< Velocity Y (meters/second)
+    std::vector<float> accelerationX;  ///< Acceleration X (meters/second²)
+    std::vector<float> accelerationY;  ///< Acceleration Y (meters/second²)
+    std::vector<float> age;            ///< Seconds since spawn
+    std::vector<float> lifetime;       ///< Total lifetime in seconds
+    std::vector<float> size;           ///< Current half-size (meters)
+    std::vector<float> initialSize;    ///< Half-size at spawn, for shrink
+    std::vector<float> rotation;       ///< Rotation in radians
+    std::vector<float> rotationSpeed;  ///< Rotation speed in radians/second
+    std::vector<float> alpha;          ///< Alpha transparency (0.0 to 1.0)
+    std::vector<Color> color;          ///< Tint
+
+private:
+    inline void resizeArrays(std::size_t n)
+    {
+        positionX.resize(n);
+        positionY.resize(n);
+        velocityX.resize(n);
+        velocityY.resize(n);
+        accelerationX.resize(n);
+        accelerationY.resize(n);
+        age.resize(n);
+        lifetime.resize(n);
+        size.resize(n);
+        initialSize.resize(n);
+        rotation.resize(n);
+        rotationSpeed.resize(n);
+        alpha.resize(n);
+        color.resize(n);
+    }
+
+    std::size_t m_count = 0;  ///< Alive particles (the prefix of every array)
+};
+
+}  // namespace Components
+
+#endif  // PARTICLEBUFFER_H
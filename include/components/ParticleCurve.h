@@ -0,0 +1,215 @@
+#ifndef PARTICLECURVE_H
+#define PARTICLECURVE_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Color.h"
+
+namespace Components
+{
+
+/// Samples per baked lifetime table (index 0 is birth, the last index is death)
+constexpr std::size_t kParticleCurveSamples = 64;
+
+/**
+ * @brief One key of a FloatCurve
+ */
+struct CurveKey
+{
+    float time  = 0.0f;  ///< Normalized lifetime in [0, 1]
+    float value = 0.0f;  ///< Value at that time
+};
+
+/**
+ * @brief One key of a ColorGradient
+ */
+struct GradientKey
+{
+    float time  = 0.0f;          ///< Normalized lifetime in [0, 1]
+    Color color = Color::White;  ///< Color at that time
+};
+
+/**
+ * @brief Piecewise-linear float curve over normalized particle lifetime
+ *
+ * Keys are kept sorted by time. Before the first key and after the last one the
+ * curve holds that key's value. An empty curve means "not set".
+ */
+struct FloatCurve
+{
+    std::vector<CurveKey> keys;  ///< Sorted by time
+
+    /// Inserts a key, keeping keys sorted (returns *this for chaining)
+    FloatCurve& addKey(float time, float value)
+    {
+        const auto it = std::upper_bound(
+            keys.begin(), keys.end(), time, [](float t, const CurveKey& key) { return t < key.time; });
+        keys.insert(it, CurveKey{time, value});
+        return *this;
+    }
+
+    bool empty() const
+    {
+        return keys.empty();
+    }
+
+    float evaluate(float t) const
+    {
+        if (keys.empty())
+        {
+            return 0.0f;
+        }
+        if (t <= keys.front().time)
+        {
+            return keys.front().value;
+        }
+        for (std::size_t i = 1; i < keys.size(); ++i)
+        {
+            if (t <= keys[i].time)
+            {
+                const CurveKey& a    = keys[i - 1];
+                const CurveKey& b    = keys[i];
+                const float     span = b.time - a.time;
+                const float     f    = span > 0.0f ? (t - a.time) / span : 1.0f;
+                return a.value + (b.value - a.value) * f;
+            }
+        }
+        return keys.back().value;
+    }
+};
+
+/**
+ * @brief Piecewise-linear color gradient over normalized particle lifetime
+ *
+ * Same key rules as FloatCurve; channels are interpolated independently.
+ */
+struct ColorGradient
+{
+    std::vector<GradientKey> keys;  ///< Sorted by time
+
+    /// Inserts a key, keeping keys sorted (returns *this for chaining)
+    ColorGradient& addKey(float time, const Color& color)
+    {
+        const auto it = std::upper_bound(
+            keys.begin(), keys.end(), time, [](float t, const GradientKey& key) { return t < key.time; });
+        keys.insert(it, GradientKey{time, color});
+        return *this;
+    }
+
+    bool empty() const
+    {
+        return keys.empty();
+    }
+
+    Color evaluate(float t) const
+    {
+        if (keys.empty())
+        {
+            return Color::White;
+        }
+        if (t <= keys.front().time)
+        {
+            return keys.front().color;
+        }
+        for (std::size_t i = 1; i < keys.size(); ++i)
+        {
+            if (t <= keys[i].time)
+            {
+                const GradientKey& a    = keys[i - 1];
+                const GradientKey& b    = keys[i];
+                const float        span = b.time - a.time;
+                const float        f    = span > 0.0f ? (t - a.time) / span : 1.0f;
+                auto lerp = [f](std::uint8_t from, std::uint8_t to)
+                {
+                    const float fromF = from;
+                    return static_cast<std::uint8_t>(fromF + (static_cast<float>(to) - fromF) * f);
+                };
+                return Color(lerp(a.color.r, b.color.r),
+                             lerp(a.color.g, b.color.g),
+                             lerp(a.color.b, b.color.b),
+                             lerp(a.color.a, b.color.a));
+            }
+        }
+        return keys.back().color;
+    }
+};
+
+/**
+ * @brief Lifetime curves of one emitter, sampled into fixed-size tables
+ *
+ * Baked whenever a curve is edited, so the particle update looks values up by
+ * normalized age instead of walking keys. Tables without a curve are unused and
+ * their has* flag is false.
+ */
+struct ParticleCurveTables
+{
+    std::array<Color, kParticleCurveSamples> color{};  ///< Color over lifetime
+    std::array<float, kParticleCurveSamples> alpha{};  ///< Alpha over lifetime
+    std::array<float, kParticleCurveSamples> size{};   ///< Size multiplier (of the spawn size) over lifetime
+    std::array<float, kParticleCurveSamples> speed{};  ///< Speed multiplier over lifetime
+
+    bool hasColor = false;
+    bool hasAlpha = false;
+    bool hasSize  = false;
+    bool hasSpeed = false;
+
+    bool any() const
+    {
+        return hasColor || hasAlpha || hasSize || hasSpeed;
+    }
+
+    /// Table index for normalized age t (clamped to [0, 1]; NaN maps to the last sample)
+    static std::size_t index(float t)
+    {
+        t = t < 1.0f ? t : 1.0f;  // Also catches NaN (0 / 0 for a zero lifetime), which has expired
+        t = t >= 0.0f ? t : 0.0f;
+        return static_cast<std::size_t>(t * static_cast<float>(kParticleCurveSamples - 1) + 0.5f);
+    }
+
+    /// Sample time of table entry i
+    static float sampleTime(std::size_t i)
+    {
+        return static_cast<float>(i) / static_cast<float>(kParticleCurveSamples - 1);
+    }
+
+    void bakeColor(const ColorGradient& gradient)
+    {
+        hasColor = !gradient.empty();
+        for (std::size_t i = 0; hasColor && i < kParticleCurveSamples; ++i)
+        {
+            color[i] = gradient.evaluate(sampleTime(i));
+        }
+    }
+
+    void bakeAlpha(const FloatCurve& curve)
+    {
+        hasAlpha = bake(curve, alpha);
+    }
+
+    void bakeSize(const FloatCurve& curve)
+    {
+        hasSize = bake(curve, size);
+    }
+
+    void bakeSpeed(const FloatCurve& curve)
+    {
+        hasSpeed = bake(curve, speed);
+    }
+
+private:
+    static bool bake(const FloatCurve& curve, std::array<float, kParticleCurveSamples>& table)
+    {
+        for (std::size_t i = 0; !curve.empty() && i < kParticleCurveSamples; ++i)
+        {
+            table[i] = curve.evaluate(sampleTime(i));
+        }
+        return !curve.empty();
+    }
+};
+
+}  // namespace Components
+
+#endif  // PARTICLECURVE_H
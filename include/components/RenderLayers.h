@@ -0,0 +1,23 @@
+#ifndef RENDERLAYERS_H
+#define RENDERLAYERS_H
+
+#include <cstdint>
+
+namespace Components
+{
+
+/**
+ * @brief Render layer bits
+ *
+ * @description
+ * CRenderable, CParticleEmitter and CTilemap carry a mask of the layers they belong to;
+ * CCamera::cullingMask selects the layers a camera draws. An item is drawn by a camera
+ * when the two masks share at least one bit. Layer meanings are up to the game
+ * (e.g. bit 1 for world, bit 2 for minimap markers).
+ */
+constexpr std::uint32_t kRenderLayerDefault = 1u << 0;     ///< Layer new items belong to
+constexpr std::uint32_t kRenderLayersAll    = 0xFFFFFFFFu;  ///< Mask matching every layer
+
+}  // namespace Components
+
+#endif  // RENDERLAYERS_H
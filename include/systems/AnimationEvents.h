@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <Entity.h>
+
+namespace Systems
+{
+
+// Emitted by SAnimation when a frame with a non-empty SpriteFrame::event is entered.
+struct SpriteAnimationEvent
+{
+    Entity        entity{};
+    std::string   event;
+    std::uint32_t frame{0};
+};
+
+// Emitted once when a non-looping animation reaches its last frame.
+struct SpriteAnimationFinished
+{
+    Entity entity{};
+};
+
+}  // namespace Systems
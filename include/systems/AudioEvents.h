@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+
+#include <Entity.h>
+
+namespace Systems
+{
+
+// Starts the entity's CAudioSource (replacing whatever the entity was playing).
+// A non-empty clipId plays that clip with the source's other settings instead.
+struct AudioPlayRequest
+{
+    Entity      entity{};
+    std::string clipId;
+};
+
+// Stops the sound the entity is playing (or waiting to play).
+struct AudioStopRequest
+{
+    Entity entity{};
+};
+
+}  // namespace Systems
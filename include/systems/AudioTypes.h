@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
 
 /**
  * @brief Audio system type definitions and constants
@@ -21,6 +22,24 @@ enum class AudioType
     Music
 };
 
+/**
+ * @brief What playSfx() does with a clip whose asynchronous load has not finished
+ */
+enum class LoadingPlayPolicy
+{
+    Skip,  ///< Refuse the request (playSfx returns false)
+    Queue  ///< Start the sound as soon as the clip is loaded
+};
+
+/**
+ * @brief One sound of a bank passed to SAudio::loadSoundBankAsync()
+ */
+struct SoundBankEntry
+{
+    std::string id;        ///< Sound id used by playSfx()
+    std::string filepath;  ///< Path to the sound file
+};
+
 /**
  * @brief Audio system constants
  */
@@ -32,6 +51,11 @@ constexpr float  DEFAULT_SFX_VOLUME    = 1.0f;
 constexpr float  DEFAULT_MUSIC_VOLUME  = 1.0f;
 constexpr float  MIN_VOLUME            = 0.0f;
 constexpr float  MAX_VOLUME            = 1.0f;
+constexpr int    DEFAULT_SFX_PRIORITY  = 0;      ///< Higher priorities win when voices compete for pool slots
+constexpr size_t MAX_VIRTUAL_VOICES    = 64;     ///< Voices tracked without a pool slot before new ones are refused
+constexpr float  DEFAULT_MIN_DISTANCE  = 2.0f;   ///< Spatial sources play at full volume within this distance
+constexpr float  DEFAULT_MAX_DISTANCE  = 30.0f;  ///< Spatial sources are silent (and culled) beyond this distance
+constexpr float  DEFAULT_PAN_DISTANCE  = 15.0f;  ///< Horizontal offset at which a source is panned fully aside
 }  // namespace AudioConstants
 
 #endif  // AUDIOTYPES_H
@@ -15,10 +15,16 @@ public:
 
     virtual bool loadSound(const std::string& id, const std::string& filepath, AudioType type) = 0;
     virtual void unloadSound(const std::string& id)                                            = 0;
-
-    virtual bool playSfx(Entity entity, const std::string& id, bool loop = false, float volume = 1.0f) = 0;
-    virtual void stopSfx(Entity entity)                                                                = 0;
-    virtual void setSfxVolume(Entity entity, float volume)                                             = 0;
+    virtual bool loadSoundAsync(const std::string& id, const std::string& filepath)            = 0;
+    virtual bool isSoundLoading(const std::string& id) const                                   = 0;
+
+    virtual bool playSfx(Entity             entity,
+                         const std::string& id,
+                         bool               loop     = false,
+                         float              volume   = 1.0f,
+                         int                priority = AudioConstants::DEFAULT_SFX_PRIORITY) = 0;
+    virtual void stopSfx(Entity entity)                                                   = 0;
+    virtual void setSfxVolume(Entity entity, float volume)                                = 0;
 
     virtual bool playMusic(const std::string& id, bool loop = true) = 0;
     virtual void stopMusic()                                        = 0;
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Color.h"
+
+namespace Components
+{
+struct ParticleBuffer;
+struct ParticleCurveTables;
+}
+
+namespace Systems
+{
+
+/**
+ * @brief Per-emitter constants for one particle update step
+ */
+struct ParticleUpdateParams
+{
+    float deltaTime      = 0.0f;          ///< Step length in seconds
+    Color startColor     = Color::White;  ///< Color at birth
+    Color endColor       = Color::White;  ///< Color at death
+    float startAlpha     = 1.0f;          ///< Alpha at birth (when fadeOut)
+    float endAlpha       = 1.0f;          ///< Alpha at death (when fadeOut)
+    float shrinkEndScale = 1.0f;          ///< Size scale at death (when shrink)
+    bool  fadeOut        = false;         ///< Interpolate alpha over lifetime
+    bool  shrink         = false;         ///< Interpolate size over lifetime
+
+    /// Baked lifetime curves (null for none); each table present replaces the matching setting above
+    const Components::ParticleCurveTables* curves = nullptr;
+};
+
+/**
+ * @brief Advances particles [begin, end) of a buffer by one step
+ *
+ * Integrates age, velocity, position and rotation, then derives color, alpha and
+ * size from age / lifetime, either by linear blend or by lookup in params.curves.
+ * Uses AVX when the CPU supports it, SSE2 on other x86 builds and the scalar loop
+ * otherwise; every path performs the same arithmetic.
+ *
+ * Expired particles are only aged, not removed; call ParticleBuffer::removeExpired()
+ * afterwards to compact the alive prefix.
+ */
+void integrateParticles(Components::ParticleBuffer& particles,
+                        std::size_t                 begin,
+                        std::size_t                 end,
+                        const ParticleUpdateParams& params);
+
+/**
+ * @brief Advances only the age of particles [begin, end)
+ *
+ * The cheap update for emitters no camera can see: particles still expire on time,
+ * but motion and appearance are left as they were.
+ */
+void ageParticles(Components::ParticleBuffer& particles, std::size_t begin, std::size_t end, float deltaTime);
+
+/**
+ * @brief Scalar reference for integrateParticles() (benchmarks and tests)
+ */
+void integrateParticlesScalar(Components::ParticleBuffer& particles,
+                              std::size_t                 begin,
+                              std::size_t                 end,
+                              const ParticleUpdateParams& params);
+
+/**
+ * @brief Name of the instruction set integrateParticles() uses on this machine ("avx", "sse2" or "scalar")
+ */
+const char* particleKernelName();
+
+namespace detail
+{
+/// Whether ParticleKernelAvx.cpp was compiled with AVX enabled
+bool particleKernelAvxBuilt();
+
+/// 8-wide integration pass (AVX CPUs only); returns the first index it did not process
+std::size_t integrateParticlesAvx(Components::ParticleBuffer& particles,
+                                  std::size_t                 begin,
+                                  std::size_t                 end,
+                                  const ParticleUpdateParams& params);
+}  // namespace detail
+
+}  // namespace Systems
@@ -0,0 +1,122 @@
+#ifndef RENDERSTATS_H
+#define RENDERSTATS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sf
+{
+class Shader;
+class Texture;
+}  // namespace sf
+
+namespace Systems
+{
+
+/**
+ * @brief Per-camera render counters
+ */
+struct CameraRenderStats
+{
+    std::string name;                ///< Camera name (CCamera::name)
+    std::size_t itemsSubmitted = 0;  ///< Render items drawn through this camera
+    std::size_t itemsCulled    = 0;  ///< Render items skipped by visibility tests
+};
+
+/**
+ * @brief Render counters for a single frame
+ *
+ * @description
+ * Filled by SRenderer::render() and by the systems that draw on its behalf
+ * (SParticle, UI::UIRenderer). Counters are reset at the start of every frame;
+ * read them after GameEngine::render() (or SRenderer::render()) returns.
+ */
+struct RenderStats
+{
+    std::uint64_t frame            = 0;     ///< Renderer frame index
+    std::size_t   renderItems      = 0;     ///< Items in the sorted render queue
+    std::size_t   drawCalls        = 0;     ///< Draw calls issued
+    std::size_t   vertices         = 0;     ///< Vertices submitted
+    std::size_t   textureBinds     = 0;     ///< Draws whose texture differs from the previous draw
+    std::size_t   shaderSwitches   = 0;     ///< Draws whose shader differs from the previous draw
+    std::size_t   culledItems      = 0;     ///< Items skipped by visibility tests (all cameras)
+    std::size_t   particleEmitters = 0;     ///< Emitters drawn
+    std::size_t   particles        = 0;     ///< Particles drawn
+    std::size_t   uiCommands       = 0;     ///< UI draw-list commands processed
+    std::size_t   staticLayers     = 0;     ///< Static layers drawn from a cache texture
+    std::size_t   staticRebuilds   = 0;     ///< Static layer caches re-rendered this frame
+    std::size_t   tileChunks       = 0;     ///< Tilemap chunks drawn
+    std::size_t   tileChunksCulled = 0;     ///< Tilemap chunks outside the view
+    std::size_t   tileChunkBuilds  = 0;     ///< Tilemap chunks rebuilt this frame
+    float         renderMs         = 0.0f;  ///< CPU time spent in SRenderer::render()
+
+    std::vector<CameraRenderStats> cameras;  ///< One entry per camera rendered this frame
+
+    /**
+     * @brief Records one draw call
+     * @param texture Texture bound for the draw (may be null)
+     * @param shader Shader bound for the draw (may be null)
+     * @param vertexCount Vertices submitted by the draw
+     */
+    void recordDraw(const sf::Texture* texture, const sf::Shader* shader, std::size_t vertexCount)
+    {
+        ++drawCalls;
+        vertices += vertexCount;
+        if (texture != m_lastTexture)
+        {
+            ++textureBinds;
+            m_lastTexture = texture;
+        }
+        if (shader != m_lastShader)
+        {
+            ++shaderSwitches;
+            m_lastShader = shader;
+        }
+    }
+
+    /**
+     * @brief Clears all counters for a new frame (keeps camera storage)
+     */
+    void reset(std::uint64_t frameIndex)
+    {
+        frame            = frameIndex;
+        renderItems      = 0;
+        drawCalls        = 0;
+        vertices         = 0;
+        textureBinds     = 0;
+        shaderSwitches   = 0;
+        culledItems      = 0;
+        particleEmitters = 0;
+        particles        = 0;
+        uiCommands       = 0;
+        staticLayers     = 0;
+        staticRebuilds   = 0;
+        tileChunks       = 0;
+        tileChunksCulled = 0;
+        tileChunkBuilds  = 0;
+        renderMs         = 0.0f;
+        cameras.clear();
+        m_lastTexture = nullptr;
+        m_lastShader  = nullptr;
+    }
+
+private:
+    const sf::Texture* m_lastTexture = nullptr;  ///< Texture of the previous draw this frame
+    const sf::Shader*  m_lastShader  = nullptr;  ///< Shader of the previous draw this frame
+};
+
+/**
+ * @brief Update time of one system for the last GameEngine::update()
+ */
+struct SystemTiming
+{
+    std::string_view name;             ///< ISystem::name()
+    float            updateMs = 0.0f;  ///< Wall time spent in update/fixedUpdate
+};
+
+}  // namespace Systems
+
+#endif  // RENDERSTATS_H
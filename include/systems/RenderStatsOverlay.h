@@ -0,0 +1,38 @@
+#ifndef RENDERSTATSOVERLAY_H
+#define RENDERSTATSOVERLAY_H
+
+#include <vector>
+
+#include "RenderStats.h"
+
+namespace Systems
+{
+
+/**
+ * @brief ImGui window showing RenderStats and per-system update times
+ *
+ * @description
+ * Enable it through the engine, which runs the ImGui-SFML frame inside
+ * GameEngine::render() and draws the window before presenting:
+ *
+ * @code
+ * engine.setStatsOverlayEnabled(true);
+ * @endcode
+ *
+ * Stats describe the frame just rendered; timings describe the last update().
+ */
+class RenderStatsOverlay
+{
+public:
+    /**
+     * @brief Draws the overlay window
+     * @param stats Render counters (SRenderer::getRenderStats())
+     * @param timings System update times (GameEngine::getSystemTimings())
+     * @param open Optional close-button flag forwarded to ImGui::Begin
+     */
+    static void draw(const RenderStats& stats, const std::vector<SystemTiming>& timings, bool* open = nullptr);
+};
+
+}  // namespace Systems
+
+#endif  // RENDERSTATSOVERLAY_H
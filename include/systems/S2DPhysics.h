@@ -47,6 +47,9 @@ private:
 
     std::unordered_map<Entity, uint64_t> m_colliderHashes;
 
+    // Scratch for castSegments() broadphase results
+    std::vector<b2ShapeId> m_queryShapes;
+
     // Per-entity fixed-update callbacks
     std::unordered_map<Entity, std::function<void(float)>> m_fixedCallbacks;
 
@@ -198,6 +201,37 @@ public:
      */
     void rayCast(const b2Vec2& origin, const b2Vec2& translation, b2CastResultFcn* callback, void* context);
 
+    /// One segment for castSegments(): from origin along translation
+    struct SegmentCast
+    {
+        b2Vec2 origin;
+        b2Vec2 translation;
+    };
+
+    /// Closest hit of one SegmentCast (hit is false when nothing was in the way)
+    struct SegmentHit
+    {
+        b2Vec2 point;
+        b2Vec2 normal;
+        float  fraction;
+        bool   hit;
+    };
+
+    /**
+     * @brief Finds the closest non-sensor shape crossed by each of a batch of segments
+     * @param segments Segments to test
+     * @param count Number of segments
+     * @param filter Category filter, as for Box2D queries
+     * @param hits Receives one result per segment
+     *
+     * Meant for many short segments, such as particle motion over one step. Segments are
+     * processed in chunks: each chunk does one broadphase query for the box around its
+     * segments and tests its segments against the shapes found, instead of one tree
+     * traversal per segment. Chunks whose box holds many shapes fall back to per-segment
+     * ray casts.
+     */
+    void castSegments(const SegmentCast* segments, std::size_t count, b2QueryFilter filter, SegmentHit* hits);
+
     /**
      * @brief Register a physics body for fixed-update callbacks
      * @param body Physics body component to register
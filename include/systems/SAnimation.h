@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string_view>
+
+#include "System.h"
+
+class World;
+
+namespace Systems
+{
+
+/**
+ * @brief Advances CSpriteAnimation frame tables and applies the current frame to CTexture
+ *
+ * @description
+ * One pass over the dense animation store per update. Only animations whose frame changed
+ * touch their CTexture, and only its textureRect is written. Frame events are emitted as
+ * SpriteAnimationEvent / SpriteAnimationFinished (AnimationEvents.h) on the world's event bus.
+ *
+ * Runs in PreFlush, after scripts, so play/pause calls made this frame take effect immediately.
+ */
+class SAnimation : public System
+{
+public:
+    SAnimation()           = default;
+    ~SAnimation() override = default;
+
+    void update(float deltaTime, World& world) override;
+
+    std::string_view name() const override
+    {
+        return "SAnimation";
+    }
+};
+
+}  // namespace Systems
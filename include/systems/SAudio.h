@@ -2,16 +2,27 @@
 #define SAUDIO_H
 
 #include <SFML/Audio.hpp>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include "AudioEvents.h"
+#include "AudioPack.h"
+#include "EventBus.h"
 #include "IAudioSystem.h"
+#include "SoundBankLoader.h"
 #include "System.h"
+#include "Vec2.h"
 
 class World;
 
+namespace Components
+{
+struct CAudioSource;
+}
+
 namespace Systems
 {
 
@@ -25,9 +36,24 @@ namespace Systems
  *
  * Features:
  * - SFX pooling: Reuses sf::Sound objects for efficient playback
+ * - Voice management: When the pool is full, a new sound steals the slot of the
+ *   lowest-priority (then quietest) voice if it outranks it. Voices without a slot
+ *   stay virtual: they keep advancing their playback position and resume in place
+ *   as soon as a slot frees up
+ * - Positional audio: Spatial CAudioSource voices are attenuated by their distance
+ *   to the CAudioListener and panned by the horizontal offset, for all voices in one
+ *   pass per frame. Voices beyond their maximum distance never hold a slot
  * - Music streaming: Single active music track with streaming
  * - Volume control: Master volume plus per-source volume; simple music volume
  *
+ * - Async loading: loadSoundAsync()/loadSoundBankAsync() read and decode on worker
+ *   threads; finished buffers are adopted whole at the start of update(). playSfx()
+ *   on a clip that is still loading follows the LoadingPlayPolicy
+ *
+ * - Audio packs: mountAudioPack() maps an archive built by the audio_pack tool. Sounds
+ *   and music whose path is in a mounted pack decode (or stream) straight from the
+ *   mapping instead of reading loose files. Packs stay mounted until destruction
+ *
  * Thread Safety:
  * All methods should be called from the main thread. SFML audio operations
  * are not guaranteed to be thread-safe.
@@ -53,7 +79,46 @@ public:
     bool loadSound(const std::string& id, const std::string& filepath, AudioType type) override;
     void unloadSound(const std::string& id) override;
 
-    bool playSfx(Entity entity, const std::string& id, bool loop = false, float volume = 1.0f) override;
+    /**
+     * @brief Queues a sound effect for loading and decoding on a worker thread
+     * @return False if the system is not initialized; true if queued, loading or loaded
+     */
+    bool loadSoundAsync(const std::string& id, const std::string& filepath) override;
+    bool isSoundLoading(const std::string& id) const override;
+
+    /**
+     * @brief Memory-maps an audio pack; later loads of paths it contains read from it
+     * @param filepath Pack file (relative paths resolve against the executable directory)
+     * @return False if the pack cannot be mapped or is malformed
+     *
+     * Entries are matched against the filepath passed to loadSound()/loadSoundAsync().
+     * Packs mounted later take precedence. They stay mounted until the system is destroyed.
+     */
+    bool mountAudioPack(const std::string& filepath);
+
+    /**
+     * @brief Queues every sound of a bank for asynchronous loading
+     * @return Number of entries newly queued (loaded or loading ids are skipped)
+     */
+    size_t loadSoundBankAsync(const std::vector<SoundBankEntry>& bank);
+
+    /**
+     * @brief Number of sounds whose asynchronous load has not been adopted yet
+     */
+    size_t getLoadingSoundCount() const;
+
+    /**
+     * @brief Sets what playSfx() does with a clip that is still loading (default: Queue)
+     */
+    void setLoadingPlayPolicy(LoadingPlayPolicy policy);
+
+    LoadingPlayPolicy getLoadingPlayPolicy() const;
+
+    bool playSfx(Entity             entity,
+                 const std::string& id,
+                 bool               loop     = false,
+                 float              volume   = 1.0f,
+                 int                priority = AudioConstants::DEFAULT_SFX_PRIORITY) override;
     void stopSfx(Entity entity) override;
     void setSfxVolume(Entity entity, float volume) override;
 
@@ -84,10 +149,33 @@ public:
     }
 
     /**
-     * @brief ECS-driven audio update that consumes component data
+     * @brief Subscribe to the world's AudioPlayRequest / AudioStopRequest events
+     *
+     * Call once the world exists and before its first EventBus pump, so requests emitted during
+     * setup or by PreFlush systems on the first frame are collected. The engine does this on
+     * construction.
+     */
+    void bindWorld(World& world);
+
+    /**
+     * @brief ECS-driven audio update
+     *
+     * Plays and stops CAudioSource entities on AudioPlayRequest / AudioStopRequest
+     * events, and applies CAudioSettings volumes when they change. Sources without
+     * requests cost nothing per frame.
      */
     void updateEcs(float deltaTime, World& world);
 
+    /**
+     * @brief Number of sound effects currently bound to a pool slot
+     */
+    size_t getAudibleVoiceCount() const;
+
+    /**
+     * @brief Number of sound effects tracked without a pool slot
+     */
+    size_t getVirtualVoiceCount() const;
+
     // Delete copy and move constructors/assignment operators
     SAudio(const SAudio&)            = delete;
     SAudio(SAudio&&)                 = delete;
@@ -95,37 +183,186 @@ public:
     SAudio& operator=(SAudio&&)      = delete;
 
 private:
+    /**
+     * @brief One playing sound effect, either audible (bound to a pool slot) or virtual
+     */
+    struct Voice
+    {
+        const sf::SoundBuffer* buffer     = nullptr;
+        Entity                 owner      = Entity::null();
+        float                  baseVolume = 1.0f;
+        int                    priority   = AudioConstants::DEFAULT_SFX_PRIORITY;
+        bool                   loop       = false;
+        float                  offset     = 0.0f;  ///< Playback position in seconds (advanced while virtual)
+        float                  duration   = 0.0f;  ///< Buffer length in seconds
+        int                    slot       = -1;    ///< Pool slot, or -1 while virtual
+
+        bool  spatial     = false;  ///< Attenuated and panned relative to the listener
+        Vec2  position    = Vec2(0.0f, 0.0f);
+        float minDistance = AudioConstants::DEFAULT_MIN_DISTANCE;
+        float maxDistance = AudioConstants::DEFAULT_MAX_DISTANCE;
+        float gain        = 1.0f;  ///< Distance attenuation in [0, 1]; 0 means inaudible
+        float pan         = 0.0f;  ///< -1 (left) to 1 (right)
+    };
+
     struct SoundSlot
     {
         std::optional<sf::Sound> sound;
-        Entity                   owner      = Entity::null();
-        bool                     inUse      = false;
-        float                    baseVolume = 1.0f;
+        Entity                   owner = Entity::null();  ///< Voice bound to this slot (null when free)
     };
 
     /**
-     * @brief Find an available slot in the sound pool
-     * @return Index of available slot, or -1 if pool is full
+     * @brief Where a new voice goes, decided before the entity's current voice is stopped
+     */
+    struct VoicePlan
+    {
+        bool   accepted   = false;           ///< False: the pool is full and the new voice is the weakest
+        bool   audible    = false;           ///< Takes a free slot, the replaced voice's, or the victim's
+        Entity victim     = Entity::null();  ///< Audible voice whose slot is taken
+        bool   dropVictim = false;           ///< Release the victim instead of virtualizing it (virtual cap)
+        Entity dropped    = Entity::null();  ///< Virtual voice released to stay within MAX_VIRTUAL_VOICES
+    };
+
+    /**
+     * @brief A playSfx() request waiting for its clip to finish loading
+     */
+    struct QueuedPlay
+    {
+        Entity      entity;
+        std::string id;
+        Voice       voice;
+    };
+
+    /**
+     * @brief Packed bytes for a load path, or nullptr if no mounted pack contains it
+     */
+    const Internal::AudioPackView* findPacked(const std::string& filepath) const;
+
+    /**
+     * @brief Adopts finished asynchronous loads and starts the plays queued on them
+     */
+    void collectLoadedSounds();
+
+    /**
+     * @brief Starts (or drops, if the clip failed to load) the plays queued on id
+     */
+    void startQueuedPlays(const std::string& id);
+
+    /**
+     * @brief Validates the clip, replaces the entity's current voice and starts voice
+     *        in a slot (or virtual when it is inaudible or loses the slot contest)
+     */
+    bool startVoice(Entity entity, const std::string& id, Voice voice);
+
+    /**
+     * @brief Decides whether voice (replacing entity's current one) is refused, audible or virtual
+     *
+     * Does not change any state, so a refused play leaves the entity's current voice playing.
+     */
+    VoicePlan planVoice(Entity entity, const Voice& voice) const;
+
+    /**
+     * @brief Starts clipId with a CAudioSource's settings, placed at the entity's CTransform when spatial
+     */
+    bool playSource(Entity                          entity,
+                    const Components::CAudioSource& source,
+                    const std::string&              clipId,
+                    World&                          world);
+
+    /**
+     * @brief Applies CAudioSettings (or legacy CAudioListener) volumes that differ from the current ones
+     */
+    void applyVolumeSettings(World& world);
+
+    /**
+     * @brief Recomputes voice.gain and voice.pan from the current listener
+     */
+    void spatialize(Voice& voice) const;
+
+    /**
+     * @brief Refreshes the listener and every spatial voice's position, gain and pan;
+     *        audible voices that moved out of range give up their slot
      */
-    int findAvailableSlot();
+    void updateSpatialVoices(World& world);
+
+    /**
+     * @brief Pushes the voice's volume and pan to its sf::Sound
+     */
+    void applyVoiceMix(const Voice& voice);
+
+    /**
+     * @brief Whether voice a should keep (or take) a slot over voice b
+     */
+    static bool outranks(const Voice& a, const Voice& b);
+
+    /**
+     * @brief Takes a free slot, or steals the weakest audible voice's slot if candidate outranks it
+     * @param candidate A virtual voice, so virtualizing the victim keeps the virtual count unchanged
+     * @return Slot index, or -1 if candidate has to stay virtual
+     */
+    int acquireSlot(const Voice& candidate);
+
+    /**
+     * @brief Index of the weakest audible voice, or -1 if no voice holds a slot
+     */
+    int findWeakestAudibleVoice() const;
+
+    /**
+     * @brief Index of the weakest virtual voice not owned by exclude, or -1 if there is none
+     */
+    int findWeakestVirtualVoice(Entity exclude) const;
+
+    void bindVoice(Voice& voice, size_t slotIndex);
+    void virtualizeVoice(Voice& voice);
+    void releaseVoice(size_t voiceIndex);
+
+    /**
+     * @brief Hands free slots to the strongest virtual voices, then lets one virtual
+     *        voice take over the weakest audible one if it outranks it
+     */
+    void promoteVirtualVoices();
 
     float calculateEffectiveSfxVolume(float baseVolume) const;
     float calculateEffectiveMusicVolume(float baseVolume) const;
 
     void shutdownInternal();
 
+    // Declared first so the mappings are released last: music streams and in-flight decodes read them in place.
+    std::vector<std::unique_ptr<Internal::AudioPack>>        m_audioPacks;   ///< Mounted packs, newest last
+    std::unordered_map<std::string, Internal::AudioPackView> m_packedMusic;  ///< Music IDs found in a mounted pack
+
     bool                                             m_initialized = false;
     std::vector<SoundSlot>                           m_soundPool;
+    std::vector<size_t>                              m_freeSlots;       ///< Unused pool slots (stack)
+    std::vector<Voice>                               m_voices;          ///< Dense; audible and virtual voices
+    std::vector<size_t>                              m_virtualScratch;  ///< Reused by promoteVirtualVoices()
     std::unordered_map<std::string, sf::SoundBuffer> m_soundBuffers;
     std::unordered_map<std::string, std::string>     m_musicPaths;  ///< Map music IDs to file paths
     std::unique_ptr<sf::Music>                       m_currentMusic;
     std::string                                      m_currentMusicId;
     float                                            m_currentMusicBaseVolume = 1.0f;
 
+    Internal::SoundBankLoader                      m_bankLoader;         ///< Decodes loadSoundAsync() requests
+    std::unordered_map<std::string, std::uint64_t> m_loadingSounds;      ///< Id -> ticket of its in-flight load
+    std::uint64_t                                  m_nextLoadTicket = 0;  ///< Last ticket handed out
+    std::vector<QueuedPlay>                        m_queuedPlays;        ///< Plays waiting for a loading clip
+    std::vector<Internal::SoundLoadResult>         m_loadResults;        ///< Scratch for collectLoadedSounds()
+    LoadingPlayPolicy                              m_loadingPlayPolicy = LoadingPlayPolicy::Queue;
+
     float                              m_masterVolume = AudioConstants::DEFAULT_MASTER_VOLUME;
     float                              m_musicVolume  = AudioConstants::DEFAULT_MUSIC_VOLUME;
     float                              m_sfxVolume    = AudioConstants::DEFAULT_SFX_VOLUME;
-    std::unordered_map<Entity, size_t> m_entityToSlot;
+    std::unordered_map<Entity, size_t> m_entityToVoice;  ///< Owner entity to index into m_voices
+
+    bool  m_hasListener      = false;  ///< False: spatial voices play unattenuated and centered
+    Vec2  m_listenerPosition = Vec2(0.0f, 0.0f);
+    float m_panDistance      = AudioConstants::DEFAULT_PAN_DISTANCE;
+
+    bool                          m_subscribed = false;  ///< EventBus subscriptions registered
+    std::vector<AudioPlayRequest> m_pendingPlayRequests;  ///< Collected by the EventBus handler
+    std::vector<AudioStopRequest> m_pendingStopRequests;  ///< Collected by the EventBus handler
+    ScopedSubscription            m_playSub;
+    ScopedSubscription            m_stopSub;
 };
 
 }  // namespace Systems
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 #include "ActionBinding.h"
@@ -13,6 +16,9 @@
 
 using ListenerId = size_t;
 using BindingId  = size_t;
+using ActionId   = std::uint32_t;
+
+constexpr ActionId kInvalidActionId = std::numeric_limits<ActionId>::max();
 
 namespace Systems
 {
@@ -46,10 +52,35 @@ private:
     // Optional filter invoked before dispatch/event emission. If it returns true, the event is consumed.
     std::function<bool(const InputEvent&)> m_preDispatchFilter;
 
-    // Helper to namespace actions per-entity so identical action names across entities don't collide
-    std::string scopeAction(Entity entity, const std::string& actionName) const;
-    void        registerControllerBindings(World& world);
-    void        updateControllerStates(World& world);
+    // Controller actions. Names are interned to ActionIds once, at bind time; each controller entity keeps its
+    // actions and their states densely, so per-frame evaluation neither allocates nor hashes strings.
+    struct ControllerAction
+    {
+        ActionId                   id    = kInvalidActionId;
+        ActionState                state = ActionState::None;
+        std::vector<ActionBinding> bindings;
+    };
+
+    struct ControllerActions
+    {
+        Entity                        entity;
+        std::uint64_t                 lastSeenFrame = 0;
+        std::vector<ControllerAction> actions;
+        std::vector<BindingId>        bindingIds;  // IDs this record issued to the component's bindings
+    };
+
+    std::vector<std::string>                  m_actionNames;  // ActionId -> name
+    std::unordered_map<std::string, ActionId> m_actionIds;    // name -> ActionId, only consulted at bind time
+    std::vector<ControllerActions>            m_controllers;
+    std::unordered_map<Entity, size_t>        m_controllerIndex;  // entity -> index into m_controllers
+    std::uint64_t                             m_controllerFrame = 0;
+
+    ActionId internAction(const std::string& actionName);
+    void     registerControllerBindings(World& world);
+    void     updateControllerStates(World& world);
+
+    ActionState        evaluateBinding(const ActionBinding& binding) const;
+    static ActionState advanceActionState(ActionState previous, ActionState evaluated);
 
     void dispatch(World& world, const InputEvent& inputEvent);
 
@@ -97,6 +128,10 @@ public:
     void        unbindAction(const std::string& actionName);                // remove all bindings
     ActionState getActionState(const std::string& actionName) const;
 
+    // Controller actions (CInputController). Resolve the ActionId once, then query per frame without strings.
+    ActionId    getActionId(const std::string& actionName) const;  // kInvalidActionId if never bound
+    ActionState getActionState(Entity entity, ActionId action) const;
+
     // ImGui handling
     void setPassToImGui(bool pass)
     {
@@ -4,16 +4,34 @@
 #include <Entity.h>
 #include <Vec2.h>
 #include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
-#include <unordered_map>
-#include <unordered_set>
+#include <vector>
+#include "ParticleKernel.h"
+#include "RenderStats.h"
 #include "System.h"
 
 class Registry;  // Forward declaration
 
+namespace Internal
+{
+class TextureLoader;
+class ThreadPool;
+}  // namespace Internal
+
+namespace Components
+{
+struct CParticleEmitter;
+struct ParticleBuffer;
+}
+
 namespace Systems
 {
 
+class S2DPhysics;
+
 /**
  * @brief Particle system that updates and renders particles from CParticleEmitter components
  *
@@ -27,20 +45,43 @@ namespace Systems
  * - Renders particles efficiently using SFML vertex arrays
  * - Supports textured and colored particles
  * - Automatic particle lifecycle management
+ *
+ * Emitters are simulated in parallel on an internal thread pool, and emitters larger
+ * than kParallelRangeSize are split into ranges. Each emitter samples spawns from its
+ * own Random stream (CParticleEmitter::getRandom()), seeded from the system seed and
+ * the entity, so a given seed reproduces the same particles regardless of thread count.
+ *
+ * Emitters with a collision mode are tested against the physics world after each
+ * integration step (see setPhysics()). Emitters no camera can see only age their
+ * particles, and an optional global budget thins spawning across emitters by
+ * importance and camera distance (see setParticleBudget()).
  */
 class SParticle : public System
 {
 public:
+    /// Particles per parallel task when splitting a large emitter
+    static constexpr std::size_t kParallelRangeSize = 16384;
+
+    /// Total alive particles below which update() stays on the calling thread
+    static constexpr std::size_t kMinParallelParticles = 4096;
+
+    /// Most particles of one emitter tested for collision per update; larger emitters
+    /// spread their particles over several updates
+    static constexpr std::size_t kMaxCollisionTestsPerEmitter = 1024;
+
+    /// setParticleBudget() value that disables the budget (the default)
+    static constexpr std::size_t kUnlimitedParticles = 0;
+
     SParticle();
     ~SParticle() override;
 
     /**
      * @brief Initializes the particle system
-     * @param window SFML render window (used to get dimensions)
+     * @param target Default render target (window or offscreen texture)
      * @param pixelsPerMeter Rendering scale (pixels per meter)
      * @return true if initialization succeeded
      */
-    bool initialize(sf::RenderWindow* window, float pixelsPerMeter = 100.0f);
+    bool initialize(sf::RenderTarget* target, float pixelsPerMeter = 100.0f);
 
     /**
      * @brief Shuts down the particle system
@@ -53,21 +94,122 @@ public:
      */
     void update(float deltaTime, World& world) override;
 
+    /**
+     * @brief Sets the seed that emitter spawn streams are derived from
+     *
+     * Emitters pick it up on their first update; emitters already seeded (including via
+     * CParticleEmitter::setRandomSeed()) keep their own sequence. Defaults to a random seed.
+     */
+    void setSeed(std::uint64_t seed);
+
+    std::uint64_t getSeed() const
+    {
+        return m_seed;
+    }
+
+    /**
+     * @brief Caps the total number of alive particles across all emitters
+     * @param budget Maximum particles (kUnlimitedParticles for no cap)
+     *
+     * When the spawns due in a step do not fit in the room left under the budget, each
+     * visible emitter keeps a share weighted by CParticleEmitter::getImportance() and
+     * reduced with its distance to the nearest camera (in view heights). Shares never add
+     * up to more than the room, so alive particles stay within the budget; existing
+     * particles are never killed early.
+     */
+    void setParticleBudget(std::size_t budget)
+    {
+        m_particleBudget = budget;
+    }
+    std::size_t getParticleBudget() const
+    {
+        return m_particleBudget;
+    }
+
+    /**
+     * @brief Enables the off-screen update for emitters no camera can see (default on)
+     *
+     * An emitter is off-screen when no enabled, rendering camera whose culling mask
+     * matches its layers overlaps its reach (spawn shape plus the farthest a particle can
+     * travel in one lifetime). Off-screen emitters only age their particles; they do not
+     * emit and drop queued bursts. Worlds without cameras treat every emitter as visible.
+     */
+    void setCullingEnabled(bool enabled)
+    {
+        m_cullingEnabled = enabled;
+    }
+    bool isCullingEnabled() const
+    {
+        return m_cullingEnabled;
+    }
+
+    /**
+     * @brief Sets the physics world particle collision is tested against
+     * @param physics Physics system (may be null to disable particle collision)
+     *
+     * Emitters with a collision mode other than None send the segment each particle
+     * moved along this update to S2DPhysics::castSegments() in one batch. An emitter
+     * with more than kMaxCollisionTestsPerEmitter particles tests an interleaved subset
+     * each update, with segments stretched over the updates between tests. Collision
+     * runs on the updating thread, after integration and before compaction.
+     */
+    void setPhysics(S2DPhysics* physics)
+    {
+        m_physics = physics;
+    }
+
+    /**
+     * @brief Emitters that took the off-screen update in the last update()
+     */
+    std::size_t getCulledEmitterCount() const
+    {
+        return m_culledEmitters;
+    }
+
+    /**
+     * @brief Replaces the simulation thread pool
+     * @param workerCount Worker threads besides the caller (0 picks a count from the hardware)
+     */
+    void setWorkerCount(std::size_t workerCount);
+
     /**
      * @brief Renders particles for a single emitter entity
      * @param entity Entity ID with CParticleEmitter component
-     * @param window SFML render window
+     * @param target Render target to draw into (null uses the one passed to initialize())
      * @param registry Registry to access components
+     * @param stats Optional frame counters to record the draw into
+     */
+    void renderEmitter(Entity entity, sf::RenderTarget* target, World& world, RenderStats* stats = nullptr);
+
+    /**
+     * @brief Renders several emitters through one shared vertex buffer
+     * @param entities Emitter entities in draw order
+     * @param count Number of entities
+     * @param target Render target to draw into (null uses the one passed to initialize())
+     * @param world World to access components
+     * @param stats Optional frame counters to record the draws into
+     *
+     * Each emitter's quads are written in parallel into a preassigned slice of one vertex
+     * array, and consecutive emitters with the same texture are drawn in a single call.
+     * Draw order between emitters is preserved, so the caller may pass any run of emitters
+     * that would otherwise be drawn back to back.
      */
-    void renderEmitter(Entity entity, sf::RenderWindow* window, World& world);
+    void renderEmitters(const Entity*     entities,
+                        std::size_t       count,
+                        sf::RenderTarget* target,
+                        World&            world,
+                        RenderStats*      stats = nullptr);
 
     /**
-     * @brief Processes queued texture loads (once per frame).
+     * @brief Sets the texture loader used for particle textures
+     * @param loader Loader owned by the renderer (may be null for untextured rendering)
      *
-     * This is called by the renderer after it activates the window context.
-     * It performs file IO and GPU uploads, so it must not be called in hot per-emitter code.
+     * The renderer uploads decoded textures once per frame for both systems.
      */
-    void processQueuedTextureLoads();
+    void setTextureLoader(Internal::TextureLoader* loader)
+    {
+        m_textureLoader = loader;
+    }
 
     /**
      * @brief Checks if the particle system is initialized
@@ -90,16 +232,78 @@ private:
     /** @brief Deleted assignment operator */
     SParticle& operator=(const SParticle&) = delete;
 
-    void               requestTextureLoad(const std::string& filepath);
-    const sf::Texture* getCachedTexture(const std::string& resolvedKey) const;
+    /** @brief Refreshes m_cameras from the world's enabled, rendering cameras */
+    void gatherCameras(World& world);
+
+    /** @brief Scales m_jobs spawns down to the room left under the particle budget */
+    void applyBudget();
+
+    /// One active emitter gathered for the current update
+    struct EmitterJob
+    {
+        Entity                        entity;
+        Components::CParticleEmitter* emitter = nullptr;
+        Vec2                          worldPosition;
+        float                         rotation = 0.0f;
+        ParticleUpdateParams          params;
+        bool                          visible = true;  ///< Seen by a camera (false: only aged)
+        float                         weight  = 1.0f;  ///< Budget weight: importance over camera distance
+        std::size_t                   spawns  = 0;     ///< Particles to spawn this step
+    };
+
+    /// World-space box a camera sees, gathered once per update
+    struct CameraBounds
+    {
+        Vec2          center;
+        Vec2          halfExtents;  ///< Axis-aligned, covering camera rotation
+        float         viewHeight;   ///< World units; distances are measured in these
+        std::uint32_t cullingMask;
+    };
+
+    /// Segment batch buffers (defined with the physics types in SParticle.cpp)
+    struct CollisionScratch;
+
+    /** @brief Tests an emitter's particles against m_physics and applies its collision response */
+    void collideParticles(const EmitterJob& job);
+
+    /// Particles [begin, end) of m_jobs[job] (or m_drawEmitters[job]), processed as one task
+    struct ParticleRange
+    {
+        std::size_t job;
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    /// One emitter queued by renderEmitters()
+    struct DrawEmitter
+    {
+        const Components::ParticleBuffer* particles;
+        const sf::Texture*                texture;
+        std::size_t                       firstVertex;  ///< Start of this emitter's slice in m_vertexArray
+    };
 
     sf::VertexArray   m_vertexArray;     ///< Vertex array for rendering
-    sf::RenderWindow* m_window;          ///< Render window reference
+    sf::RenderTarget* m_target;          ///< Default render target
     float             m_pixelsPerMeter;  ///< Rendering scale
     bool              m_initialized;     ///< Initialization state
 
-    std::unordered_map<std::string, sf::Texture> m_textureCache;
-    std::unordered_set<std::string>              m_queuedTextureLoads;
+    Internal::TextureLoader* m_textureLoader = nullptr;  ///< Shared texture cache (owned by SRenderer)
+
+    std::unique_ptr<Internal::ThreadPool> m_threadPool;    ///< Simulation workers
+    std::vector<EmitterJob>               m_jobs;          ///< Active emitters this update (reused)
+    std::vector<ParticleRange>            m_ranges;        ///< Integration tasks this update (reused)
+    std::vector<DrawEmitter>              m_drawEmitters;  ///< Emitters in the current render batch (reused)
+    std::vector<ParticleRange>            m_vertexRanges;  ///< Vertex generation tasks (reused)
+    std::vector<CameraBounds>             m_cameras;       ///< Rendering cameras this update (reused)
+    std::uint64_t                         m_seed;          ///< Base seed for emitter spawn streams
+
+    S2DPhysics*                       m_physics = nullptr;  ///< Collision world (owned by the engine)
+    std::unique_ptr<CollisionScratch> m_collision;          ///< Reused collision batch buffers
+    std::uint64_t                     m_updateIndex = 0;    ///< Rotates the collision subset of large emitters
+
+    std::size_t m_particleBudget = kUnlimitedParticles;  ///< Global alive particle cap
+    bool        m_cullingEnabled = true;                 ///< Off-screen emitters only age
+    std::size_t m_culledEmitters = 0;                    ///< Off-screen emitters in the last update
 };
 
 }  // namespace Systems
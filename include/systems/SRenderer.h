@@ -2,18 +2,29 @@
 #define SRENDERER_H
 
 #include <SFML/Graphics.hpp>
+#include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
-#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "AssetHandle.h"
 #include "Color.h"
+#include "RenderStats.h"
 #include "System.h"
+#include "TextureLoader.h"
 
 class World;
 
 namespace Components
 {
 enum class BlendMode;
+enum class UniformType;
+struct CMaterial;
+struct CRenderable;
+struct CTilemap;
+struct CTransform;
 }
 
 namespace Systems
@@ -33,6 +44,7 @@ struct WindowConfig
     bool         vsync        = true;           ///< Vertical sync flag
     unsigned int frameLimit   = 0;              ///< Frame rate limit (0 = unlimited)
     unsigned int antialiasing = 0;              ///< Anti-aliasing level (0, 2, 4, 8, 16)
+    bool         offscreen    = false;          ///< Render into an offscreen texture instead of opening a window
 
     /**
      * @brief Gets SFML window state (windowed vs fullscreen)
@@ -77,9 +89,17 @@ struct WindowConfig
  * over SFML for future portability to other rendering backends.
  *
  * Features:
- * - Internal window management
- * - Texture caching and loading
+ * - Internal window management, or an offscreen render texture (WindowConfig::offscreen)
+ * - Texture caching with asynchronous decoding (shared with SParticle)
+ * - Texture memory budget with LRU eviction
  * - Shader caching and compilation
+ * - Handle-based asset lookup (paths are resolved once, not per frame)
+ * - Shapes and sprites drawn from cached unit meshes, batched while render states match
+ * - Sprite sub-rectangles (CTexture::textureRect), e.g. atlas frames set by SAnimation
+ * - Static layers (CRenderable::isStatic) cached per camera in render textures
+ * - Chunked tilemaps (CTilemap) with prebuilt per-chunk vertex buffers and view culling
+ * - Per-camera visibility lists: render layer masks (CCamera::cullingMask) and view-bounds culling
+ * - Per-frame render statistics (draw calls, vertices, binds, per camera)
  * - Z-index based layered rendering
  * - Fallback rendering for physics debug visualization
  */
@@ -121,8 +141,9 @@ public:
      * Performs the following steps:
      * 1. Clears the window
      * 2. Sorts entities by z-index
-     * 3. Draws each visible entity using its components
-     * 4. Displays the frame
+     * 3. Builds each camera's visibility list (layer mask and view bounds)
+     * 4. Draws the visible entities using their components
+     * 5. Displays the frame
      */
     void render(World& world);
 
@@ -139,10 +160,18 @@ public:
 
     /**
      * @brief Checks if the window is open
-     * @return true if window is open, false otherwise
+     * @return true if window is open, false otherwise (always false when rendering offscreen)
      */
     bool isWindowOpen() const;
 
+    /**
+     * @brief Whether the renderer draws into an offscreen texture instead of a window
+     */
+    bool isOffscreen() const
+    {
+        return m_renderTexture != nullptr;
+    }
+
     /**
      * @brief Gets the SFML render window
      * @return Pointer to the render window
@@ -152,6 +181,21 @@ public:
      */
     sf::RenderWindow* getWindow();
 
+    /**
+     * @brief Gets the target all drawing goes to (the window, or the offscreen texture)
+     * @return Pointer to the render target, or nullptr before initialization
+     */
+    sf::RenderTarget* getRenderTarget();
+
+    /**
+     * @brief Copies the current frame into an image (e.g. for golden-image comparisons)
+     * @return Frame pixels, or an empty image if there is no target
+     *
+     * Offscreen, call after display(). With a window, call before display(), since
+     * the back buffer is undefined after a swap.
+     */
+    sf::Image captureFrame();
+
     /**
      * @brief Loads a texture from file and caches it
      * @param filepath Path to the texture file
@@ -163,10 +207,30 @@ public:
      * @brief Enqueues a texture load request.
      *
      * This is safe to call from render code: it does not perform file IO or GPU uploads.
-     * The actual load is processed once per frame inside SRenderer::render().
+     * The file is decoded on a worker thread and uploaded inside SRenderer::render(),
+     * within a per-frame byte budget.
      */
     void requestTextureLoad(const std::string& filepath);
 
+    /**
+     * @brief Resolves a texture path to a handle, registering it on first use
+     * @param filepath Path to the texture file (relative paths resolve against the executable directory)
+     * @return Handle usable with getTexture(), or kInvalidAssetHandle for an empty path
+     *
+     * Path resolution runs once per distinct path. Handles stay valid for the lifetime of
+     * the renderer, including across clearTextureCache().
+     */
+    AssetHandle resolveTextureHandle(const std::string& filepath);
+
+    /**
+     * @brief Gets a resident texture by handle without touching the filesystem
+     * @param handle Handle returned by resolveTextureHandle()
+     * @return Pointer to the texture, or nullptr if it is not resident yet
+     *
+     * A missing texture is queued for loading, so this is safe to call from hot render paths.
+     */
+    const sf::Texture* getTexture(AssetHandle handle);
+
     /**
      * @brief Loads a shader from files and caches it
      * @param vertexPath Path to vertex shader (empty for no vertex shader)
@@ -175,6 +239,36 @@ public:
      */
     const sf::Shader* loadShader(const std::string& vertexPath, const std::string& fragmentPath);
 
+    /**
+     * @brief Resolves a vertex/fragment path pair to a shader handle, registering it on first use
+     * @param vertexPath Path to vertex shader (empty for no vertex shader)
+     * @param fragmentPath Path to fragment shader (empty for no fragment shader)
+     * @return Handle usable with getShader(), or kInvalidAssetHandle if both paths are empty
+     */
+    AssetHandle resolveShaderHandle(const std::string& vertexPath, const std::string& fragmentPath);
+
+    /**
+     * @brief Gets a shader by handle, compiling it on first use
+     * @param handle Handle returned by resolveShaderHandle()
+     * @return Pointer to the shader, or nullptr if unavailable or compilation failed
+     *
+     * A failed compilation is remembered and not retried until clearShaderCache().
+     */
+    const sf::Shader* getShader(AssetHandle handle);
+
+    /**
+     * @brief Sets the texture memory budget
+     * @param bytes Budget in bytes (0 = unlimited, the default)
+     *
+     * When exceeded, least recently used textures are evicted and reload on their next use.
+     */
+    void setTextureMemoryBudget(std::size_t bytes);
+
+    /**
+     * @brief Gets texture residency counters (resident bytes, hits, misses, evictions)
+     */
+    const Internal::TextureResidencyStats& getTextureStats() const;
+
     /**
      * @brief Clears the texture cache
      */
@@ -185,6 +279,53 @@ public:
      */
     void clearShaderCache();
 
+    /**
+     * @brief Enables or disables static layer caching (enabled by default)
+     *
+     * When disabled, static entities are drawn every frame like any other entity. Static entities
+     * with a CShader (time-driven uniforms) or a non-Alpha blend mode are never cached.
+     */
+    void setStaticLayerCaching(bool enabled);
+
+    /**
+     * @brief Sets how far a cached layer extends past the view on each side
+     * @param fraction Margin as a fraction of the view size (default 0.25)
+     *
+     * Larger margins re-render less often while the camera pans, at the cost of texture memory.
+     */
+    void setStaticLayerMargin(float fraction);
+
+    /**
+     * @brief Re-renders every static layer on the next frame
+     *
+     * Layers already re-render when a member's transform, renderable, material, texture,
+     * shader or collider size changes. Call this for anything else (e.g. edited collider polygons).
+     */
+    void invalidateStaticLayers();
+
+    /**
+     * @brief Gets the counters collected during the last render()
+     *
+     * The non-const overload lets systems that draw on the renderer's behalf
+     * (e.g. UI::UIRenderer) record into the same frame.
+     */
+    const RenderStats& getRenderStats() const
+    {
+        return m_stats;
+    }
+    RenderStats& getRenderStats()
+    {
+        return m_stats;
+    }
+
+    /**
+     * @brief Gets the texture loader shared by the renderer and particle system
+     */
+    Internal::TextureLoader& getTextureLoader()
+    {
+        return m_textureLoader;
+    }
+
     /**
      * @brief Inject particle system for particle rendering
      */
@@ -214,15 +355,186 @@ private:
      */
     sf::BlendMode toSFMLBlendMode(::Components::BlendMode blendMode) const;
 
-    const sf::Texture* getCachedTexture(const std::string& resolvedKey) const;
-    void               processQueuedTextureLoads();
+    /**
+     * @brief Shader table entry addressed by AssetHandle
+     */
+    struct ShaderSlot
+    {
+        std::string                 resolvedVertexPath;           ///< Resolved vertex path (empty if none)
+        std::string                 resolvedFragmentPath;         ///< Resolved fragment path (empty if none)
+        std::unique_ptr<sf::Shader> shader;                       ///< Compiled shader (null until loaded)
+        bool                        failed              = false;  ///< Compilation failed; not retried
+        std::uint64_t               globalsFrame        = 0;      ///< Frame the engine globals were last set
+        std::uint64_t               appliedUniformsHash = 0;      ///< Uniform set currently held (0 = none)
+        std::vector<std::pair<std::string, ::Components::UniformType>> appliedUniforms;  ///< Names/types of that set
+    };
+
+    /**
+     * @brief Triangle list in unit space (centered on the origin, 1x1 extent) with 0..1 texture coordinates
+     */
+    struct UnitMesh
+    {
+        std::vector<sf::Vector2f> positions;  ///< Triangle-list vertex positions
+        std::vector<sf::Vector2f> uvs;        ///< Normalized texture coordinates per vertex
+    };
+
+    /** @brief Unit quad (two triangles), built once */
+    static const UnitMesh& unitQuad();
+
+    /** @brief Unit circle (triangle fan expanded to a list), built once */
+    static const UnitMesh& unitCircle();
+
+    /** @brief Unit half circle on the +X side, used for round line caps, built once */
+    static const UnitMesh& unitHalfCircle();
+
+    /**
+     * @brief Appends a transformed unit mesh to the shape batch
+     * @param states Render states for the mesh; the batch is flushed first if they differ
+     * @param mesh Unit mesh to append
+     * @param transform Unit space to world transform
+     * @param color Vertex color
+     * @param textureRect Texture region in pixels the unit UVs map onto (null = the whole texture)
+     *
+     * Meshes drawn with a shader are flushed immediately so per-entity uniforms stay correct.
+     */
+    void batchMesh(const sf::RenderStates& states,
+                   const UnitMesh&         mesh,
+                   const sf::Transform&    transform,
+                   sf::Color               color,
+                   const sf::FloatRect*    textureRect = nullptr);
+
+    /**
+     * @brief Draws and clears the pending shape batch
+     */
+    void flushBatch();
+
+    /**
+     * @brief Uploads shader uniforms that are out of date for this draw
+     * @param handle Shader handle of the entity being drawn
+     * @param material Entity material (may be null)
+     *
+     * Engine globals (u_time, u_resolution) are set once per shader per frame; the material
+     * uniform set only when it differs from the one the shader last received. On such a switch,
+     * uniforms of the previous set that the new one lacks are reset to zero first.
+     */
+    void applyShaderUniforms(AssetHandle handle, const ::Components::CMaterial* material);
+
+    void processQueuedTextureLoads();
+
+    /** @brief Whether there is a usable target (open window or offscreen texture) */
+    bool hasTarget() const;
+
+    /**
+     * @brief Cached rendering of one static layer (static entities sharing a zIndex) for one camera
+     */
+    struct StaticLayerCache
+    {
+        std::unique_ptr<sf::RenderTexture> texture;            ///< Layer pixels (premultiplied alpha)
+        sf::View                           view;               ///< Camera view grown by the margin
+        std::uint64_t                      fingerprint   = 0;  ///< Layer content the texture holds
+        std::uint64_t                      lastUsedFrame = 0;  ///< Frame the layer was last drawn
+    };
+
+    /// Frames an unused cache (static layer texture, tilemap mesh) is kept before it is released, so
+    /// content that is briefly hidden or off camera is not rebuilt from scratch when it returns.
+    static constexpr std::uint64_t kCacheIdleFrames = 300;
+
+    /// (camera index, camera generation, zIndex)
+    using StaticLayerKey = std::tuple<std::uint32_t, std::uint32_t, int>;
+
+    /**
+     * @brief Draws a static layer from its cache, re-rendering the cache first if it is stale
+     * @param key Camera and layer the cache belongs to
+     * @param view Camera view for this frame
+     * @param entities Static entities in the layer
+     * @param count Number of entities
+     * @param fingerprint Content fingerprint of the layer this frame
+     * @param world World that owns the entities
+     */
+    void drawStaticLayer(const StaticLayerKey& key,
+                         const sf::View&       view,
+                         const Entity*         entities,
+                         std::size_t           count,
+                         std::uint64_t         fingerprint,
+                         World&                world);
+
+    /**
+     * @brief Conservative world-space bounds of a renderable, for view culling
+     * @return false when the entity has no bounds to test; it is then drawn by every camera on its layers
+     */
+    bool renderableBounds(Entity                           entity,
+                          const ::Components::CRenderable& renderable,
+                          const ::Components::CTransform&  transform,
+                          World&                           world,
+                          sf::FloatRect&                   bounds);
+
+    /**
+     * @brief Hashes everything about a static entity that affects how it is drawn
+     */
+    std::uint64_t staticFingerprint(Entity entity, World& world);
+
+    /**
+     * @brief Prebuilt geometry for one chunk of a tilemap (tilemap-local coordinates)
+     */
+    struct TilemapChunk
+    {
+        sf::VertexBuffer buffer{sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static};  ///< GPU copy
+        sf::VertexArray  vertices{sf::PrimitiveType::Triangles};  ///< CPU copy (only without VBO support)
+        std::size_t      vertexCount = 0;                         ///< Vertices in the chunk (buffer may be larger)
+        std::uint32_t    revision    = 0;                         ///< CTilemap chunk revision this was built from
+    };
+
+    /**
+     * @brief Chunk meshes for one tilemap entity
+     */
+    struct TilemapMesh
+    {
+        std::vector<TilemapChunk> chunks;              ///< Row-major, CTilemap::getChunksX() per row
+        std::uint32_t             layoutRevision = 0;  ///< CTilemap::layoutRevision this was built from
+        sf::Vector2u              atlasSize;           ///< Atlas size the UVs were computed for
+        std::uint64_t             lastUsedFrame = 0;   ///< Frame the map was last drawn
+    };
+
+    /**
+     * @brief Draws the chunks of a tilemap that intersect the current view, rebuilding edited ones
+     */
+    void renderTilemap(Entity entity, World& world);
+
+    /**
+     * @brief Rebuilds the geometry of one chunk from the tilemap's tiles
+     */
+    static void buildTilemapChunk(const ::Components::CTilemap& tilemap,
+                                  std::uint32_t                 chunkX,
+                                  std::uint32_t                 chunkY,
+                                  const sf::Vector2u&           atlasSize,
+                                  TilemapChunk&                 chunk);
+
+    std::unique_ptr<sf::RenderWindow>  m_window;            ///< The render window (null when offscreen)
+    std::unique_ptr<sf::RenderTexture> m_renderTexture;     ///< Offscreen target (null when windowed)
+    sf::RenderTarget*                  m_target = nullptr;  ///< Active target: m_window or m_renderTexture
+
+    Internal::TextureLoader m_textureLoader;  ///< Texture cache shared with SParticle
+
+    std::vector<ShaderSlot>                      m_shaderSlots;          ///< Shader table indexed by handle
+    std::unordered_map<std::string, AssetHandle> m_shaderHandlesByKey;   ///< "vertex|fragment" request key -> handle
+    std::unordered_map<std::string, AssetHandle> m_shaderHandlesByResolvedKey;  ///< Resolved key -> handle
+
+    sf::VertexArray  m_batchVertices{sf::PrimitiveType::Triangles};  ///< Pending shape triangles
+    sf::RenderStates m_batchStates;                                  ///< States shared by the pending batch
+
+    std::map<StaticLayerKey, StaticLayerCache> m_staticLayers;               ///< Cached static layers
+    bool                                       m_staticLayerCaching = true;   ///< Static layer caching enabled
+    float                                      m_staticLayerMargin  = 0.25f;  ///< Cache margin per side
+
+    std::unordered_map<Entity, TilemapMesh> m_tilemaps;  ///< Chunk meshes per tilemap entity
+
+    RenderStats m_stats;  ///< Counters for the current/last frame
+
+    sf::Clock     m_shaderClock;     ///< Time source for u_time
+    std::uint64_t m_frameIndex = 0;  ///< Incremented once per render()
 
-    std::unique_ptr<sf::RenderWindow>            m_window;                       ///< The render window
-    std::unordered_map<std::string, sf::Texture> m_textureCache;                 ///< Cached textures by filepath
-    std::unordered_map<std::string, std::unique_ptr<sf::Shader>> m_shaderCache;  ///< Cached shaders by filepath combination
-    std::unordered_set<std::string> m_queuedTextureLoads;        ///< Resolved cache keys queued for load
-    bool                            m_initialized    = false;    ///< Initialization state
-    SParticle*                      m_particleSystem = nullptr;  ///< Optional particle system hookup
+    bool       m_initialized    = false;    ///< Initialization state
+    SParticle* m_particleSystem = nullptr;  ///< Optional particle system hookup
 };
 
 }  // namespace Systems
@@ -0,0 +1,21 @@
+#ifndef ASSET_HANDLE_H
+#define ASSET_HANDLE_H
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Index into a renderer-owned asset table
+ *
+ * @description
+ * Asset handles are resolved once from a resource path and cached on the component
+ * that references the asset, so per-frame lookups are plain array indexing instead of
+ * path resolution and string hashing. Handles are only meaningful to the system that
+ * issued them and are never serialized.
+ */
+using AssetHandle = std::uint32_t;
+
+/// Sentinel for "not resolved yet" / "no asset"
+constexpr AssetHandle kInvalidAssetHandle = std::numeric_limits<AssetHandle>::max();
+
+#endif  // ASSET_HANDLE_H
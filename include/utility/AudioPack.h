@@ -0,0 +1,115 @@
+#ifndef AUDIO_PACK_H
+#define AUDIO_PACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Internal
+{
+
+/**
+ * @brief Bytes of one packed file, pointing into the mapped pack
+ */
+struct AudioPackView
+{
+    const std::uint8_t* data = nullptr;  ///< Start of the payload (aligned to AudioPack::kPayloadAlignment)
+    std::size_t         size = 0;        ///< Payload size in bytes
+};
+
+/**
+ * @brief One input file of AudioPack::write()
+ */
+struct AudioPackSource
+{
+    std::string           name;  ///< Lookup name (normalized by write())
+    std::filesystem::path file;  ///< File whose bytes are packed
+};
+
+/**
+ * @brief Read-only, memory-mapped archive of audio files
+ *
+ * @description
+ * Layout (all integers little-endian):
+ * - Header: magic "EFAP", u32 version, u32 entry count, u32 index size in bytes
+ * - Index: per entry u64 payload offset, u64 payload size, u32 name offset, u32 name length
+ * - Name table: the entry names, concatenated
+ * - Payloads: the original file bytes, each starting on a kPayloadAlignment boundary
+ *
+ * The file is mapped once by open() and payloads are handed out as views into the
+ * mapping, so decoders (sf::SoundBuffer::loadFromMemory, sf::Music::openFromMemory)
+ * read the bytes in place. Views stay valid until close() or destruction.
+ *
+ * Names are stored normalized (forward slashes, no leading "./"), so a pack built from
+ * an asset directory is looked up with the same relative paths the game loads.
+ */
+class AudioPack
+{
+public:
+    static constexpr std::uint32_t kVersion          = 1;
+    static constexpr std::size_t   kPayloadAlignment = 64;
+
+    AudioPack() = default;
+    ~AudioPack();
+
+    AudioPack(const AudioPack&)            = delete;
+    AudioPack& operator=(const AudioPack&) = delete;
+
+    /**
+     * @brief Maps a pack file and reads its index
+     * @return False (with a reason in outError) if the file cannot be mapped or is malformed
+     */
+    bool open(const std::filesystem::path& path, std::string* outError = nullptr);
+
+    /**
+     * @brief Unmaps the pack; previously returned views become invalid
+     */
+    void close();
+
+    bool isOpen() const
+    {
+        return m_data != nullptr;
+    }
+
+    /**
+     * @brief Looks up a packed file by name (normalized before the lookup)
+     * @return View of its bytes, or nullptr if the pack has no such entry
+     */
+    const AudioPackView* find(const std::string& name) const;
+
+    std::size_t entryCount() const
+    {
+        return m_entries.size();
+    }
+
+    /**
+     * @brief Normalizes a path for use as an entry name
+     */
+    static std::string normalizeName(const std::string& name);
+
+    /**
+     * @brief Writes a pack containing the given files
+     * @return False (with a reason in outError) on duplicate names or IO errors
+     */
+    static bool write(const std::filesystem::path&        outPath,
+                      const std::vector<AudioPackSource>& sources,
+                      std::string*                        outError = nullptr);
+
+private:
+    bool fail(std::string* outError, const std::string& message);
+
+    const std::uint8_t*                            m_data = nullptr;  ///< Start of the mapping
+    std::size_t                                    m_size = 0;        ///< Mapped bytes
+    std::unordered_map<std::string, AudioPackView> m_entries;         ///< Name -> payload
+#if defined(_WIN32)
+    void* m_file    = nullptr;  ///< File HANDLE
+    void* m_mapping = nullptr;  ///< File mapping HANDLE
+#endif
+};
+
+}  // namespace Internal
+
+#endif  // AUDIO_PACK_H
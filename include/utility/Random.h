@@ -0,0 +1,91 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Small, fast random engine (PCG32, XSH-RR variant)
+ *
+ * @description
+ * 16 bytes of state and a handful of integer operations per draw, so it is cheap
+ * to embed one per component and to copy. Sequences depend only on the seed, which
+ * makes results reproducible across platforms and standard libraries (unlike
+ * std::uniform_real_distribution). Not suitable for cryptographic use.
+ *
+ * An instance must not be shared between threads without external locking; give
+ * each independent producer (e.g. each particle emitter) its own.
+ */
+class Random
+{
+public:
+    Random()
+    {
+        seed(0);
+    }
+    explicit Random(std::uint64_t seedValue, std::uint64_t stream = 0)
+    {
+        seed(seedValue, stream);
+    }
+
+    /**
+     * @brief Restarts the sequence
+     * @param seedValue Starting point within the stream
+     * @param stream Selects one of 2^63 independent sequences
+     */
+    inline void seed(std::uint64_t seedValue, std::uint64_t stream = 0)
+    {
+        m_state     = 0;
+        m_increment = (stream << 1u) | 1u;
+        nextUInt();
+        m_state += seedValue;
+        nextUInt();
+    }
+
+    /**
+     * @brief Next uniformly distributed 32-bit value
+     */
+    inline std::uint32_t nextUInt()
+    {
+        const std::uint64_t old = m_state;
+        m_state                 = old * 6364136223846793005ull + m_increment;
+        const auto xorShifted   = static_cast<std::uint32_t>(((old >> 18u) ^ old) >> 27u);
+        const auto rotation     = static_cast<std::uint32_t>(old >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((32u - rotation) & 31u));
+    }
+
+    /**
+     * @brief Uniform float in [0, 1) with 24 bits of precision
+     */
+    inline float nextFloat()
+    {
+        return static_cast<float>(nextUInt() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /**
+     * @brief Uniform float in [min, max)
+     */
+    inline float range(float min, float max)
+    {
+        return min + nextFloat() * (max - min);
+    }
+
+    /**
+     * @brief Fills out[0, count) with uniform floats in [0, 1)
+     *
+     * Same values as count calls to nextFloat(), in one tight loop.
+     */
+    inline void fill(float* out, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            out[i] = nextFloat();
+        }
+    }
+
+private:
+    std::uint64_t m_state     = 0;  ///< Current LCG state
+    std::uint64_t m_increment = 1;  ///< Stream selector (always odd)
+};
+
+#endif  // RANDOM_H
@@ -1,6 +1,7 @@
 #ifndef SFML_RESOURCE_LOADER_H
 #define SFML_RESOURCE_LOADER_H
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <string>
@@ -26,6 +27,10 @@ public:
     static bool
     loadSoundBufferFromFileBytes(const std::filesystem::path& path, sf::SoundBuffer& outBuffer, std::string* outError = nullptr);
 
+    // Decodes encoded sound bytes in place (e.g. a payload of a mapped AudioPack).
+    static bool
+    loadSoundBufferFromMemory(const void* data, std::size_t size, sf::SoundBuffer& outBuffer, std::string* outError = nullptr);
+
 private:
     static void setError(std::string* outError, const std::string& message);
 };
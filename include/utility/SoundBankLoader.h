@@ -0,0 +1,121 @@
+#ifndef SOUND_BANK_LOADER_H
+#define SOUND_BANK_LOADER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SFML/Audio/SoundBuffer.hpp>
+
+namespace Internal
+{
+
+/**
+ * @brief A sound decoded by SoundBankLoader
+ */
+struct SoundLoadResult
+{
+    std::string     id;      ///< Sound id of the request
+    std::string     path;    ///< Resolved path that was read
+    std::uint64_t   ticket;  ///< Caller's ticket of the request
+    bool            ok;      ///< Decode succeeded
+    sf::SoundBuffer buffer;  ///< Decoded samples (valid if ok)
+    std::string     error;   ///< Failure reason (if !ok)
+};
+
+/**
+ * @brief Reads and decodes sound buffers on worker threads
+ *
+ * @description
+ * Same shape as TextureLoader: the owner queues requests, workers do the file IO
+ * and decoding, and the owner picks finished buffers up with collect(). A buffer
+ * is handed over whole in one step, so the owner never sees a partial decode.
+ * collect() is a single atomic load while nothing has finished.
+ *
+ * Apart from the internal workers, the loader must only be used from one thread.
+ */
+class SoundBankLoader
+{
+public:
+    /**
+     * @brief Constructs the loader
+     * @param workerCount Decode threads to use (0 picks a count from the hardware)
+     *
+     * Threads are started lazily on the first request.
+     */
+    explicit SoundBankLoader(std::size_t workerCount = 0);
+    ~SoundBankLoader();
+
+    /**
+     * @brief Queues a decode
+     * @param id Sound id, returned with the result
+     * @param resolvedPath Path to read (already resolved by the caller)
+     * @param ticket Opaque value returned with the result
+     */
+    void request(const std::string& id, const std::string& resolvedPath, std::uint64_t ticket);
+
+    /**
+     * @brief Queues a decode of bytes already in memory (e.g. a mapped AudioPack payload)
+     * @param data Encoded bytes; must stay valid until the loader is destroyed (cancelAll() does not wait)
+     */
+    void requestFromMemory(const std::string& id, const void* data, std::size_t size, std::uint64_t ticket);
+
+    /**
+     * @brief Moves finished decodes (successful or not) to the end of out
+     * @return Number of results appended
+     */
+    std::size_t collect(std::vector<SoundLoadResult>& out);
+
+    /**
+     * @brief Number of requests not yet returned by collect()
+     */
+    std::size_t pendingCount() const
+    {
+        return m_pendingCount;
+    }
+
+    /**
+     * @brief Drops queued requests and finished results; decodes in flight are discarded on arrival
+     */
+    void cancelAll();
+
+private:
+    SoundBankLoader(const SoundBankLoader&)            = delete;
+    SoundBankLoader& operator=(const SoundBankLoader&) = delete;
+
+    struct DecodeJob
+    {
+        std::string   id;          ///< Sound id
+        std::string   path;        ///< Resolved path
+        std::uint64_t ticket;      ///< Caller's ticket
+        std::uint64_t generation;  ///< Loader generation at request time
+        const void*   data;        ///< Encoded bytes to decode instead of reading path (may be null)
+        std::size_t   size;        ///< Size of data
+    };
+
+    void ensureWorkers();
+    void workerLoop();
+    void stopWorkers();
+
+    std::size_t m_pendingCount = 0;  ///< Requests not yet collected (owner thread)
+
+    std::size_t                  m_workerCount;       ///< Configured decode thread count
+    std::vector<std::thread>     m_workers;           ///< Decode threads (started lazily)
+    std::mutex                   m_mutex;             ///< Guards the fields below except m_readyCount
+    std::condition_variable      m_jobsReady;         ///< Signalled when jobs arrive or on stop
+    std::deque<DecodeJob>        m_jobs;              ///< Pending decode jobs
+    std::vector<SoundLoadResult> m_results;           ///< Finished decodes not yet collected
+    std::uint64_t                m_generation = 0;    ///< Bumped by cancelAll(); older results are dropped
+    std::atomic<std::size_t>     m_readyCount{0};     ///< m_results.size(), readable without the lock
+    bool                         m_stopping = false;  ///< Workers should exit
+};
+
+}  // namespace Internal
+
+#endif  // SOUND_BANK_LOADER_H
@@ -0,0 +1,231 @@
+#ifndef TEXTURE_LOADER_H
+#define TEXTURE_LOADER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include "AssetHandle.h"
+
+namespace Internal
+{
+
+/**
+ * @brief Texture residency counters
+ */
+struct TextureResidencyStats
+{
+    std::size_t   residentBytes = 0;  ///< Bytes of texture memory currently resident (RGBA, no mipmaps)
+    std::size_t   residentCount = 0;  ///< Textures currently resident
+    std::size_t   budgetBytes   = 0;  ///< Configured budget (0 = unlimited)
+    std::uint64_t hits          = 0;  ///< Lookups that found a resident texture
+    std::uint64_t misses        = 0;  ///< Lookups of a texture that was not resident
+    std::uint64_t evictions     = 0;  ///< Textures released to stay within the budget
+    std::uint64_t uploads       = 0;  ///< Textures uploaded to the GPU
+};
+
+/**
+ * @brief Handle-addressed texture cache with asynchronous decoding
+ *
+ * @description
+ * File reads and image decoding run on a small worker pool. The render thread
+ * only performs the GPU upload, bounded by a per-frame byte budget, so a burst
+ * of new textures cannot stall a frame. SRenderer owns one loader and shares it
+ * with SParticle so both draw from a single cache.
+ *
+ * Residency is bounded by an optional memory budget. Resident textures are kept in an
+ * intrusive list ordered by last use, which each lookup updates in O(1); when resident
+ * bytes exceed the budget, textures are released from the least recently used end and
+ * reload transparently the next time they are drawn.
+ * Textures used in the current or previous frame are never evicted, so a working set
+ * larger than the budget overshoots it instead of thrashing.
+ *
+ * Apart from the internal workers, the loader must only be used from the render thread.
+ */
+class TextureLoader
+{
+public:
+    /// Default GPU upload budget per frame (RGBA bytes)
+    static constexpr std::size_t kDefaultUploadBudgetBytes = 8u * 1024u * 1024u;
+
+    /**
+     * @brief Constructs the loader
+     * @param workerCount Decode threads to use (0 picks a count from the hardware)
+     *
+     * Threads are started lazily on the first decode request.
+     */
+    explicit TextureLoader(std::size_t workerCount = 0);
+    ~TextureLoader();
+
+    /**
+     * @brief Resolves a texture path to a handle, registering it on first use
+     * @param filepath Path to the texture file (relative paths resolve against the executable directory)
+     * @return Handle, or kInvalidAssetHandle for an empty path
+     */
+    AssetHandle resolve(const std::string& filepath);
+
+    /**
+     * @brief Gets a resident texture without blocking
+     * @param handle Handle returned by resolve()
+     * @return Pointer to the texture, or nullptr if it is not resident yet
+     *
+     * A texture that is neither resident, in flight, nor failed is queued for decoding.
+     */
+    const sf::Texture* get(AssetHandle handle);
+
+    /**
+     * @brief Decodes and uploads a texture synchronously on the calling thread
+     * @param handle Handle returned by resolve()
+     * @param context Log prefix for diagnostics
+     * @return Pointer to the texture, or nullptr on failure
+     *
+     * Requires an active OpenGL context. Retries textures that previously failed.
+     */
+    const sf::Texture* loadNow(AssetHandle handle, const char* context);
+
+    /**
+     * @brief Uploads decoded images to the GPU
+     * @param byteBudget Maximum RGBA bytes to upload in this call
+     * @return Bytes uploaded
+     *
+     * Requires an active OpenGL context. An image larger than the whole budget is
+     * still uploaded when it is the first in the call, so large textures cannot starve.
+     * Failed decodes are processed regardless of the budget. Ends with trimToBudget().
+     */
+    std::size_t uploadPending(std::size_t byteBudget = kDefaultUploadBudgetBytes);
+
+    /**
+     * @brief Advances the frame counter used for LRU tracking (call once per rendered frame)
+     */
+    void beginFrame()
+    {
+        ++m_frame;
+    }
+
+    /**
+     * @brief Sets the texture memory budget
+     * @param bytes Budget in bytes (0 = unlimited)
+     *
+     * Takes effect at the next trimToBudget() / uploadPending().
+     */
+    void setMemoryBudget(std::size_t bytes)
+    {
+        m_stats.budgetBytes = bytes;
+    }
+
+    /**
+     * @brief Whether resident textures exceed the memory budget
+     */
+    bool isOverBudget() const
+    {
+        return m_stats.budgetBytes != 0 && m_stats.residentBytes > m_stats.budgetBytes;
+    }
+
+    /**
+     * @brief Releases least recently used textures until resident bytes fit the budget
+     * @return Number of textures evicted
+     */
+    std::size_t trimToBudget();
+
+    /**
+     * @brief Residency counters (hits/misses/evictions are cumulative)
+     */
+    const TextureResidencyStats& getStats() const
+    {
+        return m_stats;
+    }
+
+    /**
+     * @brief Number of textures requested but not yet resident or failed
+     */
+    std::size_t pendingCount() const
+    {
+        return m_pendingCount;
+    }
+
+    /**
+     * @brief Releases all textures; handles stay valid and reload on next use
+     */
+    void clear();
+
+private:
+    enum class SlotState
+    {
+        Unloaded,  ///< Known path, nothing requested
+        Pending,   ///< Queued, decoding, or decoded and waiting for upload
+        Resident,  ///< Uploaded to the GPU
+        Failed     ///< Load failed; not retried until clear() or loadNow()
+    };
+
+    struct Slot
+    {
+        std::string                  resolvedPath;                   ///< Executable-relative resolved path
+        std::unique_ptr<sf::Texture> texture;                        ///< Resident texture (null until uploaded)
+        SlotState                    state = SlotState::Unloaded;    ///< Load state
+        std::size_t                  bytes         = 0;              ///< GPU bytes while resident
+        std::uint64_t                lastUsedFrame = 0;              ///< Frame of the most recent lookup
+        AssetHandle                  lruPrev = kInvalidAssetHandle;  ///< Less recently used resident neighbour
+        AssetHandle                  lruNext = kInvalidAssetHandle;  ///< More recently used resident neighbour
+    };
+
+    struct DecodeJob
+    {
+        AssetHandle   handle;      ///< Target slot
+        std::uint64_t generation;  ///< Loader generation at request time
+        std::string   path;        ///< Resolved path (copied; workers never touch slots)
+    };
+
+    struct DecodeResult
+    {
+        AssetHandle   handle;      ///< Target slot
+        std::uint64_t generation;  ///< Generation of the originating job
+        bool          ok;          ///< Decode succeeded
+        sf::Image     image;       ///< Decoded pixels (valid if ok)
+        std::string   error;       ///< Failure reason (if !ok)
+    };
+
+    void ensureWorkers();
+    void workerLoop();
+    void stopWorkers();
+    bool upload(AssetHandle handle, const sf::Image& image, const char* context);
+    void setState(Slot& slot, SlotState state);
+    void release(AssetHandle handle);
+
+    void lruLink(AssetHandle handle);
+    void lruUnlink(AssetHandle handle);
+    void lruTouch(AssetHandle handle);
+
+    std::vector<Slot>                            m_slots;                  ///< Texture table indexed by handle
+    std::unordered_map<std::string, AssetHandle> m_handlesByPath;          ///< Requested path -> handle
+    std::unordered_map<std::string, AssetHandle> m_handlesByResolvedPath;  ///< Resolved path -> handle
+    std::deque<DecodeResult>                     m_decoded;                ///< Results awaiting upload (render thread)
+    std::size_t                                  m_pendingCount = 0;       ///< Slots in SlotState::Pending
+    std::uint64_t                                m_generation   = 0;       ///< Bumped by clear() to drop stale results
+    std::uint64_t                                m_frame        = 0;       ///< Frame counter for LRU tracking
+    TextureResidencyStats                        m_stats;                  ///< Residency counters and budget
+
+    AssetHandle m_lruHead = kInvalidAssetHandle;  ///< Least recently used resident texture (eviction end)
+    AssetHandle m_lruTail = kInvalidAssetHandle;  ///< Most recently used resident texture
+
+    std::size_t               m_workerCount;       ///< Configured decode thread count
+    std::vector<std::thread>  m_workers;           ///< Decode threads (started lazily)
+    std::mutex                m_mutex;             ///< Guards m_jobs, m_results, m_stopping
+    std::condition_variable   m_jobsReady;         ///< Signalled when jobs arrive or on stop
+    std::deque<DecodeJob>     m_jobs;              ///< Pending decode jobs
+    std::vector<DecodeResult> m_results;           ///< Finished decodes not yet collected
+    bool                      m_stopping = false;  ///< Workers should exit
+};
+
+}  // namespace Internal
+
+#endif  // TEXTURE_LOADER_H
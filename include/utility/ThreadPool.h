@@ -0,0 +1,80 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Internal
+{
+
+/**
+ * @brief Fork-join worker pool for data-parallel system updates
+ *
+ * @description
+ * parallelFor() hands out task indices to the workers and the calling thread, and
+ * returns once every index has run. Indices are claimed dynamically, so which thread
+ * runs a given index is unspecified; tasks that need reproducible results must derive
+ * any per-task state (such as RNG streams) from the index, not from the thread.
+ *
+ * One owner drives the pool: parallelFor() must not be called concurrently or from
+ * inside a task. Tasks must not throw.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Constructs the pool
+     * @param workerCount Worker threads besides the caller (0 picks a count from the hardware)
+     *
+     * Threads are started lazily on the first parallel call.
+     */
+    explicit ThreadPool(std::size_t workerCount = 0);
+    ~ThreadPool();
+
+    /**
+     * @brief Runs task(i) for every i in [0, count) and waits for all of them
+     *
+     * Runs inline when there is a single task or no workers.
+     */
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& task);
+
+    /**
+     * @brief Number of worker threads (the calling thread also runs tasks)
+     */
+    std::size_t getWorkerCount() const
+    {
+        return m_workerCount;
+    }
+
+private:
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void ensureWorkers();
+    void workerLoop();
+    void drain();
+
+    std::size_t              m_workerCount;  ///< Configured worker count
+    std::vector<std::thread> m_workers;      ///< Worker threads (started lazily)
+
+    std::mutex              m_mutex;             ///< Guards the batch fields below
+    std::condition_variable m_batchReady;        ///< Signals workers that a batch started (or stop)
+    std::condition_variable m_batchDone;         ///< Signals the caller that a worker finished its batch
+    std::uint64_t           m_batch    = 0;      ///< Incremented per parallelFor() call
+    std::size_t             m_pending  = 0;      ///< Workers still inside the current batch
+    bool                    m_stopping = false;  ///< Set by the destructor
+
+    const std::function<void(std::size_t)>* m_task  = nullptr;  ///< Current batch task
+    std::size_t                             m_count = 0;        ///< Current batch size
+    std::atomic<std::size_t>                m_next{0};          ///< Next unclaimed index
+};
+
+}  // namespace Internal
+
+#endif  // THREAD_POOL_H
@@ -1,5 +1,6 @@
 #include "GameEngine.h"
 #include <cassert>
+#include <chrono>
 #include <stdexcept>
 #include <typeindex>
 #include "Logger.h"
@@ -13,6 +14,9 @@
 #include <UIContext.h>
 #include <UIRenderer.h>
 
+#include <RenderStatsOverlay.h>
+#include <imgui-SFML.h>
+
 GameEngine::GameEngine(const Systems::WindowConfig& windowConfig, Vec2 gravity, uint8_t subStepCount, float timeStep, float pixelsPerMeter)
     : m_objectiveRegistry(std::make_unique<Objectives::ObjectiveRegistry>()),
       m_renderer(std::make_unique<Systems::SRenderer>()),
@@ -21,6 +25,7 @@ GameEngine::GameEngine(const Systems::WindowConfig& windowConfig, Vec2 gravity,
       m_objectives(std::make_unique<Systems::SObjectives>(m_objectiveRegistry.get())),
       m_physics(std::make_unique<Systems::S2DPhysics>()),
       m_camera(std::make_unique<Systems::SCamera>()),
+      m_animation(std::make_unique<Systems::SAnimation>()),
       m_particle(std::make_unique<Systems::SParticle>()),
       m_audio(std::make_unique<Systems::SAudio>()),
       m_subStepCount(subStepCount),
@@ -60,6 +65,8 @@ GameEngine::GameEngine(const Systems::WindowConfig& windowConfig, Vec2 gravity,
     }
 
     m_renderer->setParticleSystem(m_particle.get());
+    m_particle->setTextureLoader(&m_renderer->getTextureLoader());
+    m_particle->setPhysics(m_physics.get());
 
     m_gameRunning = true;
 
@@ -71,8 +78,8 @@ GameEngine::GameEngine(const Systems::WindowConfig& windowConfig, Vec2 gravity,
     m_physics->setTimeStep(m_timeStep);          // Set fixed timestep
 
     // Initialize input manager and register window event handling.
-    // The engine does not initialize ImGui, so default to not forwarding
-    // events to ImGui to avoid undefined behavior.
+    // ImGui is only initialized by setStatsOverlayEnabled(), so default to not
+    // forwarding events to ImGui to avoid undefined behavior.
     m_input->initialize(m_renderer->getWindow(), false);
     m_windowCloseSubscription = ScopedSubscription(m_world.events(),
                                                    m_world.events().subscribe<InputEvent>(
@@ -89,17 +96,24 @@ GameEngine::GameEngine(const Systems::WindowConfig& windowConfig, Vec2 gravity,
                                                            }
                                                        }));
 
-    // Initialize audio system
+    // Initialize audio system and subscribe to audio requests before the first pump
     m_audio->initialize();
+    m_audio->bindWorld(m_world);
 
     // Initialize particle system with default scale
     // Note: Users can re-initialize with different scale if needed
-    m_particle->initialize(m_renderer->getWindow(), pixelsPerMeter);
-
-    // Maintain ordered list for per-frame updates (input -> scripts -> objectives -> physics -> camera -> particle ->
-    // audio) Audio is marked as PostFlush via ISystem::stage().
-    m_systemOrder = {
-        m_input.get(), m_script.get(), m_objectives.get(), m_physics.get(), m_camera.get(), m_particle.get(), m_audio.get()};
+    m_particle->initialize(m_renderer->getRenderTarget(), pixelsPerMeter);
+
+    // Maintain ordered list for per-frame updates (input -> scripts -> objectives -> physics -> camera -> animation ->
+    // particle -> audio) Audio is marked as PostFlush via ISystem::stage().
+    m_systemOrder = {m_input.get(),
+                     m_script.get(),
+                     m_objectives.get(),
+                     m_physics.get(),
+                     m_camera.get(),
+                     m_animation.get(),
+                     m_particle.get(),
+                     m_audio.get()};
 
     LOG_INFO("All core systems initialized");
 }
@@ -112,6 +126,12 @@ GameEngine::~GameEngine()
         m_input->shutdown();
     }
 
+    // ImGui-SFML holds the render window; shut it down before the renderer closes it
+    if (m_imguiInitialized)
+    {
+        ImGui::SFML::Shutdown();
+    }
+
     // Shutdown renderer
     if (m_renderer)
     {
@@ -141,15 +161,26 @@ void GameEngine::update(float deltaTime)
 {
     static uint64_t s_frameIndex = 0;
 
+    m_systemTimings.resize(m_systemOrder.size());
+
     auto runStage = [this, deltaTime](Systems::UpdateStage stage)
     {
-        for (auto* system : m_systemOrder)
+        for (size_t i = 0; i < m_systemOrder.size(); ++i)
         {
+            auto* system = m_systemOrder[i];
             if (!system || system->stage() != stage)
             {
                 continue;
             }
 
+            const auto updateStart = std::chrono::steady_clock::now();
+            auto       recordTime  = [this, i, system, updateStart]()
+            {
+                m_systemTimings[i].name = system->name();
+                m_systemTimings[i].updateMs =
+                    std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - updateStart).count();
+            };
+
             if (s_frameIndex < 3)
             {
                 LOG_INFO("Frame {}: {} stage {} begin",
@@ -172,6 +203,7 @@ void GameEngine::update(float deltaTime)
                     system->fixedUpdate(m_timeStep, m_world);
                     m_accumulator -= m_timeStep;
                 }
+                recordTime();
 
                 if (s_frameIndex < 3)
                 {
@@ -184,6 +216,7 @@ void GameEngine::update(float deltaTime)
             }
 
             system->update(deltaTime, m_world);
+            recordTime();
 
             if (s_frameIndex < 3)
             {
@@ -261,6 +294,14 @@ void GameEngine::render()
         m_uiRenderer->render(*m_uiContext, *m_renderer);
     }
 
+    auto* window = m_renderer->getWindow();
+    if (m_statsOverlayEnabled && m_imguiInitialized && window)
+    {
+        ImGui::SFML::Update(*window, m_imguiClock.restart());
+        Systems::RenderStatsOverlay::draw(m_renderer->getRenderStats(), m_systemTimings);
+        ImGui::SFML::Render(*window);
+    }
+
     if (s_renderFrameIndex < 3)
     {
         LOG_INFO("Frame {}: render world end", s_renderFrameIndex);
@@ -296,6 +337,24 @@ void GameEngine::setUIContext(UI::UIContext* uiContext)
     }
 }
 
+void GameEngine::setStatsOverlayEnabled(bool enabled)
+{
+    auto* window = m_renderer ? m_renderer->getWindow() : nullptr;
+    if (enabled && !m_imguiInitialized)
+    {
+        if (!window || !ImGui::SFML::Init(*window))
+        {
+            LOG_ERROR("GameEngine: Failed to initialize ImGui-SFML; stats overlay stays disabled");
+            return;
+        }
+        m_imguiInitialized = true;
+        m_imguiClock.restart();
+    }
+
+    m_statsOverlayEnabled = enabled;
+    m_input->setPassToImGui(enabled);
+}
+
 bool GameEngine::is_running() const
 {
     return m_gameRunning;
@@ -315,6 +374,11 @@ Systems::SAudio& GameEngine::getAudioSystem()
     return *m_audio;
 }
 
+const std::vector<Systems::SystemTiming>& GameEngine::getSystemTimings() const
+{
+    return m_systemTimings;
+}
+
 Systems::SRenderer& GameEngine::getRenderer()
 {
     return *m_renderer;
@@ -325,6 +389,11 @@ Systems::SParticle& GameEngine::getParticleSystem()
     return *m_particle;
 }
 
+Systems::SAnimation& GameEngine::getAnimationSystem()
+{
+    return *m_animation;
+}
+
 Systems::SObjectives& GameEngine::getObjectivesSystem()
 {
     return *m_objectives;
@@ -360,6 +429,8 @@ void GameEngine::registerComponentTypes()
     m_world.registerTypeName<CAudioSource>("CAudioSource");
     m_world.registerTypeName<CAudioListener>("CAudioListener");
     m_world.registerTypeName<CObjectives>("CObjectives");
+    m_world.registerTypeName<CTilemap>("CTilemap");
+    m_world.registerTypeName<CSpriteAnimation>("CSpriteAnimation");
 
     validateComponentTypeNames();
 }
@@ -400,4 +471,6 @@ void GameEngine::validateComponentTypeNames()
     validate(CAudioSource{}, "CAudioSource");
     validate(CAudioListener{}, "CAudioListener");
     validate(CObjectives{}, "CObjectives");
+    validate(CTilemap{}, "CTilemap");
+    validate(CSpriteAnimation{}, "CSpriteAnimation");
 }
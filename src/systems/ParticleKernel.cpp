@@ -0,0 +1,262 @@
+#include "ParticleKernel.h"
+
+#include <cstdint>
+
+#include "ParticleBuffer.h"
+#include "ParticleCurve.h"
+
+// x86-64 always has SSE2; other targets use the scalar loop. The 8-wide AVX pass lives in
+// ParticleKernelAvx.cpp, the only file built with -mavx, and runs only on CPUs that report AVX.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PARTICLE_KERNEL_SSE2 1
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace Systems
+{
+
+namespace
+{
+
+/// Motion and lifetime-derived alpha/size for one particle. The SIMD paths do the same
+/// operations in the same order.
+inline void integrateOne(Components::ParticleBuffer& p, std::size_t i, const ParticleUpdateParams& params)
+{
+    const float dt = params.deltaTime;
+
+    p.age[i] += dt;
+    p.velocityX[i] += p.accelerationX[i] * dt;
+    p.velocityY[i] += p.accelerationY[i] * dt;
+    p.positionX[i] += p.velocityX[i] * dt;
+    p.positionY[i] += p.velocityY[i] * dt;
+    p.rotation[i] += p.rotationSpeed[i] * dt;
+
+    const float t = p.age[i] / p.lifetime[i];
+    if (params.fadeOut)
+    {
+        p.alpha[i] = params.startAlpha + (params.endAlpha - params.startAlpha) * t;
+    }
+    if (params.shrink)
+    {
+        p.size[i] = p.initialSize[i] * (1.0f + (params.shrinkEndScale - 1.0f) * t);
+    }
+}
+
+/// Colors are bytes, so they stay scalar; this loop has no dependencies and the compiler
+/// is free to vectorize it.
+void applyColors(Components::ParticleBuffer& p, std::size_t begin, std::size_t end, const ParticleUpdateParams& params)
+{
+    const float r0 = params.startColor.r;
+    const float g0 = params.startColor.g;
+    const float b0 = params.startColor.b;
+    const float a0 = params.startColor.a;
+    const float dr = static_cast<float>(params.endColor.r) - r0;
+    const float dg = static_cast<float>(params.endColor.g) - g0;
+    const float db = static_cast<float>(params.endColor.b) - b0;
+    const float da = static_cast<float>(params.endColor.a) - a0;
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        // Expired particles (t >= 1, or NaN for a zero lifetime) are clamped; they are
+        // removed before anything reads them.
+        float t = p.age[i] / p.lifetime[i];
+        t       = t < 1.0f ? t : 1.0f;
+
+        p.color[i] = Color(static_cast<std::uint8_t>(r0 + dr * t),
+                           static_cast<std::uint8_t>(g0 + dg * t),
+                           static_cast<std::uint8_t>(b0 + db * t),
+                           static_cast<std::uint8_t>(a0 + da * t));
+    }
+}
+
+/// Table lookups for the baked lifetime curves. The speed curve scales the distance moved
+/// this step, so it is applied as a correction on top of the plain integration.
+void applyCurves(Components::ParticleBuffer&            p,
+                 std::size_t                            begin,
+                 std::size_t                            end,
+                 const Components::ParticleCurveTables& curves,
+                 float                                  dt)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const std::size_t k = Components::ParticleCurveTables::index(p.age[i] / p.lifetime[i]);
+        if (curves.hasColor)
+        {
+            p.color[i] = curves.color[k];
+        }
+        if (curves.hasAlpha)
+        {
+            p.alpha[i] = curves.alpha[k];
+        }
+        if (curves.hasSize)
+        {
+            p.size[i] = p.initialSize[i] * curves.size[k];
+        }
+        if (curves.hasSpeed)
+        {
+            const float extra = (curves.speed[k] - 1.0f) * dt;
+            p.positionX[i] += p.velocityX[i] * extra;
+            p.positionY[i] += p.velocityY[i] * extra;
+        }
+    }
+}
+
+/// Whether the CPU and OS support AVX (the OS must save the YMM registers).
+bool cpuSupportsAvx()
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_cpu_supports("avx");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4] = {};
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx     = (info[2] & (1 << 28)) != 0;
+    return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+#else
+    return false;
+#endif
+}
+
+/// Decided once: the AVX file was built for AVX and this machine can run it.
+bool useAvxKernel()
+{
+    static const bool enabled = detail::particleKernelAvxBuilt() && cpuSupportsAvx();
+    return enabled;
+}
+
+/// Drops the linear alpha/size blends that a baked curve replaces.
+ParticleUpdateParams withoutReplacedBlends(const ParticleUpdateParams& params)
+{
+    ParticleUpdateParams effective = params;
+    if (params.curves)
+    {
+        effective.fadeOut = params.fadeOut && !params.curves->hasAlpha;
+        effective.shrink  = params.shrink && !params.curves->hasSize;
+    }
+    return effective;
+}
+
+/// Lifetime-derived values that are not part of the integration pass.
+void applyLifetimeValues(Components::ParticleBuffer& p,
+                         std::size_t                 begin,
+                         std::size_t                 end,
+                         const ParticleUpdateParams& params)
+{
+    if (!params.curves || !params.curves->hasColor)
+    {
+        applyColors(p, begin, end, params);
+    }
+    if (params.curves && params.curves->any())
+    {
+        applyCurves(p, begin, end, *params.curves, params.deltaTime);
+    }
+}
+
+#if defined(PARTICLE_KERNEL_SSE2)
+
+/// 4-wide pass; returns the first index it did not process.
+std::size_t integrateWide(Components::ParticleBuffer& p,
+                          std::size_t                 begin,
+                          std::size_t                 end,
+                          const ParticleUpdateParams& params)
+{
+    const __m128 dt         = _mm_set1_ps(params.deltaTime);
+    const __m128 one        = _mm_set1_ps(1.0f);
+    const __m128 alpha0     = _mm_set1_ps(params.startAlpha);
+    const __m128 alphaDelta = _mm_set1_ps(params.endAlpha - params.startAlpha);
+    const __m128 scaleDelta = _mm_set1_ps(params.shrinkEndScale - 1.0f);
+
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4)
+    {
+        const __m128 age = _mm_add_ps(_mm_loadu_ps(&p.age[i]), dt);
+        _mm_storeu_ps(&p.age[i], age);
+
+        const __m128 vx = _mm_add_ps(_mm_loadu_ps(&p.velocityX[i]), _mm_mul_ps(_mm_loadu_ps(&p.accelerationX[i]), dt));
+        const __m128 vy = _mm_add_ps(_mm_loadu_ps(&p.velocityY[i]), _mm_mul_ps(_mm_loadu_ps(&p.accelerationY[i]), dt));
+        _mm_storeu_ps(&p.velocityX[i], vx);
+        _mm_storeu_ps(&p.velocityY[i], vy);
+        _mm_storeu_ps(&p.positionX[i], _mm_add_ps(_mm_loadu_ps(&p.positionX[i]), _mm_mul_ps(vx, dt)));
+        _mm_storeu_ps(&p.positionY[i], _mm_add_ps(_mm_loadu_ps(&p.positionY[i]), _mm_mul_ps(vy, dt)));
+        _mm_storeu_ps(&p.rotation[i],
+                      _mm_add_ps(_mm_loadu_ps(&p.rotation[i]), _mm_mul_ps(_mm_loadu_ps(&p.rotationSpeed[i]), dt)));
+
+        const __m128 t = _mm_div_ps(age, _mm_loadu_ps(&p.lifetime[i]));
+        if (params.fadeOut)
+        {
+            _mm_storeu_ps(&p.alpha[i], _mm_add_ps(alpha0, _mm_mul_ps(alphaDelta, t)));
+        }
+        if (params.shrink)
+        {
+            const __m128 scale = _mm_add_ps(one, _mm_mul_ps(scaleDelta, t));
+            _mm_storeu_ps(&p.size[i], _mm_mul_ps(_mm_loadu_ps(&p.initialSize[i]), scale));
+        }
+    }
+    return i;
+}
+
+#endif
+
+}  // namespace
+
+void integrateParticles(Components::ParticleBuffer& particles,
+                        std::size_t                 begin,
+                        std::size_t                 end,
+                        const ParticleUpdateParams& params)
+{
+    const ParticleUpdateParams effective = withoutReplacedBlends(params);
+    std::size_t                i         = begin;
+    if (useAvxKernel())
+    {
+        i = detail::integrateParticlesAvx(particles, i, end, effective);
+    }
+#if defined(PARTICLE_KERNEL_SSE2)
+    i = integrateWide(particles, i, end, effective);
+#endif
+    for (; i < end; ++i)
+    {
+        integrateOne(particles, i, effective);
+    }
+    applyLifetimeValues(particles, begin, end, effective);
+}
+
+void ageParticles(Components::ParticleBuffer& particles, std::size_t begin, std::size_t end, float deltaTime)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        particles.age[i] += deltaTime;
+    }
+}
+
+void integrateParticlesScalar(Components::ParticleBuffer& particles,
+                              std::size_t                 begin,
+                              std::size_t                 end,
+                              const ParticleUpdateParams& params)
+{
+    const ParticleUpdateParams effective = withoutReplacedBlends(params);
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        integrateOne(particles, i, effective);
+    }
+    applyLifetimeValues(particles, begin, end, effective);
+}
+
+const char* particleKernelName()
+{
+    if (useAvxKernel())
+    {
+        return "avx";
+    }
+#if defined(PARTICLE_KERNEL_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+}  // namespace Systems
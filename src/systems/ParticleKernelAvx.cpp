@@ -0,0 +1,81 @@
+#include "ParticleKernel.h"
+
+#include "ParticleBuffer.h"
+
+// This file alone is built with -mavx (or /arch:AVX) where the compiler supports it; see
+// CMakeLists.txt. integrateParticles() calls into it only after checking the CPU.
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+namespace Systems::detail
+{
+
+#if defined(__AVX__)
+
+bool particleKernelAvxBuilt()
+{
+    return true;
+}
+
+std::size_t integrateParticlesAvx(Components::ParticleBuffer& p,
+                                  std::size_t                 begin,
+                                  std::size_t                 end,
+                                  const ParticleUpdateParams& params)
+{
+    const __m256 dt         = _mm256_set1_ps(params.deltaTime);
+    const __m256 one        = _mm256_set1_ps(1.0f);
+    const __m256 alpha0     = _mm256_set1_ps(params.startAlpha);
+    const __m256 alphaDelta = _mm256_set1_ps(params.endAlpha - params.startAlpha);
+    const __m256 scaleDelta = _mm256_set1_ps(params.shrinkEndScale - 1.0f);
+
+    std::size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        const __m256 age = _mm256_add_ps(_mm256_loadu_ps(&p.age[i]), dt);
+        _mm256_storeu_ps(&p.age[i], age);
+
+        const __m256 vx = _mm256_add_ps(_mm256_loadu_ps(&p.velocityX[i]),
+                                        _mm256_mul_ps(_mm256_loadu_ps(&p.accelerationX[i]), dt));
+        const __m256 vy = _mm256_add_ps(_mm256_loadu_ps(&p.velocityY[i]),
+                                        _mm256_mul_ps(_mm256_loadu_ps(&p.accelerationY[i]), dt));
+        _mm256_storeu_ps(&p.velocityX[i], vx);
+        _mm256_storeu_ps(&p.velocityY[i], vy);
+        _mm256_storeu_ps(&p.positionX[i], _mm256_add_ps(_mm256_loadu_ps(&p.positionX[i]), _mm256_mul_ps(vx, dt)));
+        _mm256_storeu_ps(&p.positionY[i], _mm256_add_ps(_mm256_loadu_ps(&p.positionY[i]), _mm256_mul_ps(vy, dt)));
+        _mm256_storeu_ps(
+            &p.rotation[i],
+            _mm256_add_ps(_mm256_loadu_ps(&p.rotation[i]), _mm256_mul_ps(_mm256_loadu_ps(&p.rotationSpeed[i]), dt)));
+
+        const __m256 t = _mm256_div_ps(age, _mm256_loadu_ps(&p.lifetime[i]));
+        if (params.fadeOut)
+        {
+            _mm256_storeu_ps(&p.alpha[i], _mm256_add_ps(alpha0, _mm256_mul_ps(alphaDelta, t)));
+        }
+        if (params.shrink)
+        {
+            const __m256 scale = _mm256_add_ps(one, _mm256_mul_ps(scaleDelta, t));
+            _mm256_storeu_ps(&p.size[i], _mm256_mul_ps(_mm256_loadu_ps(&p.initialSize[i]), scale));
+        }
+    }
+    return i;
+}
+
+#else
+
+bool particleKernelAvxBuilt()
+{
+    return false;
+}
+
+std::size_t integrateParticlesAvx(Components::ParticleBuffer& /*p*/,
+                                  std::size_t                 begin,
+                                  std::size_t                 /*end*/,
+                                  const ParticleUpdateParams& /*params*/)
+{
+    return begin;
+}
+
+#endif
+
+}  // namespace Systems::detail
@@ -0,0 +1,82 @@
+#include "RenderStatsOverlay.h"
+
+#include <imgui.h>
+
+namespace Systems
+{
+
+void RenderStatsOverlay::draw(const RenderStats& stats, const std::vector<SystemTiming>& timings, bool* open)
+{
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowBgAlpha(0.75f);
+    const int flags = ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav;
+    if (!ImGui::Begin("Render Stats", open, flags))
+    {
+        ImGui::End();
+        return;
+    }
+
+    const float framerate = ImGui::GetIO().Framerate;
+    ImGui::Text("Frame %llu  %.1f FPS (%.2f ms)",
+                static_cast<unsigned long long>(stats.frame),
+                framerate,
+                framerate > 0.0f ? 1000.0f / framerate : 0.0f);
+    ImGui::Text("Render CPU: %.2f ms", stats.renderMs);
+    ImGui::Separator();
+
+    ImGui::Text("Draw calls:      %zu", stats.drawCalls);
+    ImGui::Text("Vertices:        %zu", stats.vertices);
+    ImGui::Text("Texture binds:   %zu", stats.textureBinds);
+    ImGui::Text("Shader switches: %zu", stats.shaderSwitches);
+    ImGui::Text("Render items:    %zu (%zu culled)", stats.renderItems, stats.culledItems);
+    ImGui::Text("Particles:       %zu in %zu emitters", stats.particles, stats.particleEmitters);
+    ImGui::Text("UI commands:     %zu", stats.uiCommands);
+    ImGui::Text("Static layers:   %zu (%zu rebuilt)", stats.staticLayers, stats.staticRebuilds);
+    ImGui::Text("Tile chunks:     %zu (%zu culled, %zu rebuilt)",
+                stats.tileChunks,
+                stats.tileChunksCulled,
+                stats.tileChunkBuilds);
+
+    if (!stats.cameras.empty() && ImGui::BeginTable("cameras", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+    {
+        ImGui::TableSetupColumn("Camera");
+        ImGui::TableSetupColumn("Drawn");
+        ImGui::TableSetupColumn("Culled");
+        ImGui::TableHeadersRow();
+        for (const CameraRenderStats& camera : stats.cameras)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", camera.name.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", camera.itemsSubmitted);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", camera.itemsCulled);
+        }
+        ImGui::EndTable();
+    }
+
+    if (!timings.empty() && ImGui::BeginTable("systems", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+    {
+        ImGui::TableSetupColumn("System");
+        ImGui::TableSetupColumn("Update ms");
+        ImGui::TableHeadersRow();
+        for (const SystemTiming& timing : timings)
+        {
+            if (timing.name.empty())
+            {
+                continue;
+            }
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%.*s", static_cast<int>(timing.name.size()), timing.name.data());
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", timing.updateMs);
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+}
+
+}  // namespace Systems
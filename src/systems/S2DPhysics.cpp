@@ -54,6 +54,10 @@ uint64_t hashCollider(const ::Components::CCollider2D& collider)
     // cppcheck-suppress redundantAssignment
     hash = fnv1a64(hash, floatBits(collider.restitution));
     // cppcheck-suppress redundantAssignment
+    hash = fnv1a64(hash, collider.categoryBits);
+    // cppcheck-suppress redundantAssignment
+    hash = fnv1a64(hash, collider.maskBits);
+    // cppcheck-suppress redundantAssignment
     hash = fnv1a64(hash, static_cast<uint64_t>(collider.fixtures.size()));
 
     for (const auto& fixture : collider.fixtures)
@@ -360,6 +364,8 @@ void S2DPhysics::ensureShapesForEntity(Entity entity, const ::Components::CColli
     shapeDef.material.friction    = collider.friction;
     shapeDef.material.restitution = collider.restitution;
     shapeDef.isSensor             = collider.sensor;
+    shapeDef.filter.categoryBits  = collider.categoryBits;
+    shapeDef.filter.maskBits      = collider.maskBits;
     // Box2D v3 requires explicit opt-in for sensor overlap events.
     // Enable for all shapes so sensors can report overlaps with any visitor.
     shapeDef.enableSensorEvents = true;
@@ -454,6 +460,7 @@ void S2DPhysics::ensureShapesForEntity(Entity entity, const ::Components::CColli
                 chainDef.count         = 4;
                 chainDef.materials     = &mat;
                 chainDef.materialCount = 1;
+                chainDef.filter        = shapeDef.filter;
                 // Enable sensor overlap events regardless of whether this chain is a sensor.
                 chainDef.enableSensorEvents = true;
                 chainDef.isLoop             = false;
@@ -589,6 +596,85 @@ void S2DPhysics::rayCast(const b2Vec2& origin, const b2Vec2& translation, b2Cast
     b2World_CastRay(m_worldId, origin, translation, filter, callback, context);
 }
 
+void S2DPhysics::castSegments(const SegmentCast* segments, std::size_t count, b2QueryFilter filter, SegmentHit* hits)
+{
+    // Segments per broadphase query, and the most shapes a chunk tests directly
+    constexpr std::size_t kChunkSize      = 64;
+    constexpr std::size_t kMaxChunkShapes = 32;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        hits[i] = SegmentHit{segments[i].origin, b2Vec2{0.0f, 0.0f}, 1.0f, false};
+    }
+    if (!b2World_IsValid(m_worldId))
+    {
+        return;
+    }
+
+    for (std::size_t first = 0; first < count; first += kChunkSize)
+    {
+        const std::size_t last = std::min(count, first + kChunkSize);
+
+        b2AABB box{segments[first].origin, segments[first].origin};
+        for (std::size_t i = first; i < last; ++i)
+        {
+            const b2Vec2 end{segments[i].origin.x + segments[i].translation.x,
+                             segments[i].origin.y + segments[i].translation.y};
+            box.lowerBound = b2Min(box.lowerBound, b2Min(segments[i].origin, end));
+            box.upperBound = b2Max(box.upperBound, b2Max(segments[i].origin, end));
+        }
+
+        m_queryShapes.clear();
+        b2World_OverlapAABB(
+            m_worldId,
+            box,
+            filter,
+            [](b2ShapeId shapeId, void* context)
+            {
+                if (!b2Shape_IsSensor(shapeId))
+                {
+                    static_cast<std::vector<b2ShapeId>*>(context)->push_back(shapeId);
+                }
+                return true;
+            },
+            &m_queryShapes);
+
+        if (m_queryShapes.empty())
+        {
+            continue;
+        }
+
+        if (m_queryShapes.size() > kMaxChunkShapes)
+        {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                const b2RayResult result =
+                    b2World_CastRayClosest(m_worldId, segments[i].origin, segments[i].translation, filter);
+                if (result.hit && !b2Shape_IsSensor(result.shapeId))
+                {
+                    hits[i] = SegmentHit{result.point, result.normal, result.fraction, true};
+                }
+            }
+            continue;
+        }
+
+        for (std::size_t i = first; i < last; ++i)
+        {
+            b2RayCastInput input{segments[i].origin, segments[i].translation, 1.0f};
+            for (b2ShapeId shapeId : m_queryShapes)
+            {
+                const b2CastOutput output = b2Shape_RayCast(shapeId, &input);
+                if (output.hit)
+                {
+                    // Later shapes only need to beat the closest hit so far.
+                    hits[i]           = SegmentHit{output.point, output.normal, output.fraction, true};
+                    input.maxFraction = output.fraction;
+                }
+            }
+        }
+    }
+}
+
 void S2DPhysics::setFixedUpdateCallback(Entity entity, std::function<void(float)> callback)
 {
     if (!entity.isValid())
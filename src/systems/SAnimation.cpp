@@ -0,0 +1,91 @@
+#include "SAnimation.h"
+
+#include <CSpriteAnimation.h>
+#include <CTexture.h>
+#include <World.h>
+
+#include "AnimationEvents.h"
+
+namespace Systems
+{
+
+void SAnimation::update(float deltaTime, World& world)
+{
+    auto  components = world.components();
+    auto& events     = world.events();
+
+    components.each<Components::CSpriteAnimation>(
+        [&](Entity entity, Components::CSpriteAnimation& animation)
+        {
+            const auto frameCount = static_cast<std::uint32_t>(animation.frames.size());
+            if (frameCount == 0)
+            {
+                return;
+            }
+            if (animation.currentFrame >= frameCount)
+            {
+                animation.setFrame(0);
+            }
+
+            // A frame entered by starting or jumping (not by advancing) emits its event on the next update.
+            if (animation.playing && animation.eventPending)
+            {
+                animation.eventPending   = false;
+                const std::string& event = animation.frames[animation.currentFrame].event;
+                if (!event.empty())
+                {
+                    events.emit(SpriteAnimationEvent{entity, event, animation.currentFrame});
+                }
+            }
+
+            if (animation.playing && !animation.finished && animation.speed > 0.0f)
+            {
+                animation.frameTime += deltaTime * animation.speed;
+
+                // A long step can cross several frames. Cap the walk at one lap so zero-length
+                // frames or a stalled frame cannot spin; the remainder is dropped.
+                for (std::uint32_t steps = 0;; ++steps)
+                {
+                    const float duration = animation.frames[animation.currentFrame].duration;
+                    if (animation.frameTime < duration)
+                    {
+                        break;
+                    }
+                    if (steps == frameCount)
+                    {
+                        animation.frameTime = 0.0f;
+                        break;
+                    }
+
+                    if (animation.currentFrame + 1 == frameCount && !animation.loop)
+                    {
+                        animation.finished  = true;
+                        animation.frameTime = duration;
+                        events.emit(SpriteAnimationFinished{entity});
+                        break;
+                    }
+
+                    animation.frameTime -= duration;
+                    animation.currentFrame = (animation.currentFrame + 1) % frameCount;
+                    animation.rectDirty    = true;
+
+                    const std::string& event = animation.frames[animation.currentFrame].event;
+                    if (!event.empty())
+                    {
+                        events.emit(SpriteAnimationEvent{entity, event, animation.currentFrame});
+                    }
+                }
+            }
+
+            if (animation.rectDirty)
+            {
+                if (auto* texture = components.tryGet<Components::CTexture>(entity))
+                {
+                    texture->textureRect = animation.frames[animation.currentFrame].rect;
+                    animation.rectDirty  = false;
+                }
+            }
+        });
+}
+
+}  // namespace Systems
@@ -1,11 +1,14 @@
 #include "SAudio.h"
 
 #include <algorithm>
+#include <cmath>
 #include <filesystem>
+#include <iterator>
 
 #include "CAudioListener.h"
 #include "CAudioSettings.h"
 #include "CAudioSource.h"
+#include "CTransform.h"
 #include "ExecutablePaths.h"
 #include "FileUtilities.h"
 #include "Logger.h"
@@ -45,12 +48,14 @@ bool SAudio::initialize()
     }
 #endif
 
-    for (auto& slot : m_soundPool)
+    m_freeSlots.clear();
+    m_voices.clear();
+    m_entityToVoice.clear();
+    for (size_t i = m_soundPool.size(); i-- > 0;)
     {
-        slot.inUse      = false;
-        slot.owner      = Entity::null();
-        slot.baseVolume = 1.0f;
-        slot.sound.reset();
+        m_soundPool[i].owner = Entity::null();
+        m_soundPool[i].sound.reset();
+        m_freeSlots.push_back(i);
     }
 
 #ifndef _WIN32
@@ -73,6 +78,13 @@ void SAudio::shutdown()
 
 void SAudio::shutdownInternal()
 {
+    // Drop the subscriptions while the world's EventBus is still alive (the engine destroys the world first).
+    m_playSub.reset();
+    m_stopSub.reset();
+    m_subscribed = false;
+    m_pendingPlayRequests.clear();
+    m_pendingStopRequests.clear();
+
     if (!m_initialized)
     {
         return;
@@ -80,14 +92,10 @@ void SAudio::shutdownInternal()
 
     for (auto& slot : m_soundPool)
     {
-        if (slot.inUse)
+        if (slot.sound)
         {
-            if (slot.sound)
-            {
-                slot.sound->stop();
-            }
+            slot.sound->stop();
         }
-        slot.inUse = false;
         slot.owner = Entity::null();
         slot.sound.reset();
     }
@@ -98,9 +106,15 @@ void SAudio::shutdownInternal()
         m_currentMusic.reset();
     }
 
-    m_entityToSlot.clear();
+    m_bankLoader.cancelAll();
+    m_loadingSounds.clear();
+    m_queuedPlays.clear();
+    m_entityToVoice.clear();
+    m_voices.clear();
+    m_freeSlots.clear();
     m_soundBuffers.clear();
     m_musicPaths.clear();
+    m_packedMusic.clear();
     m_currentMusicId.clear();
     m_initialized = false;
     LOG_INFO("SAudio: Shutdown complete");
@@ -121,6 +135,8 @@ bool SAudio::loadSound(const std::string& id, const std::string& filepath, Audio
             return true;
         }
 
+        const Internal::AudioPackView* packed = findPacked(filepath);
+
 #ifndef _WIN32
         int oldStderr = -1;
         int devNull   = open("/dev/null", O_WRONLY);
@@ -135,21 +151,35 @@ bool SAudio::loadSound(const std::string& id, const std::string& filepath, Audio
         const std::filesystem::path resolvedPath = Internal::ExecutablePaths::resolveRelativeToExecutableDir(filepath);
         const std::string           resolvedStr  = resolvedPath.string();
 
-        std::error_code ec;
-        const bool      exists = std::filesystem::exists(resolvedPath, ec);
-        if (ec)
+        if (!packed)
         {
-            LOG_WARN("SAudio: exists() error for '{}' : {}", resolvedStr, ec.message());
-        }
-        if (!exists)
-        {
-            LOG_ERROR("Failed to load sound buffer (file does not exist): {} (original='{}')", resolvedStr, filepath);
-            return false;
+            std::error_code ec;
+            const bool      exists = std::filesystem::exists(resolvedPath, ec);
+            if (ec)
+            {
+                LOG_WARN("SAudio: exists() error for '{}' : {}", resolvedStr, ec.message());
+            }
+            if (!exists)
+            {
+                LOG_ERROR(
+                    "Failed to load sound buffer (file does not exist): {} (original='{}')", resolvedStr, filepath);
+                return false;
+            }
         }
 
+        // Packed sounds decode straight from the mapped pack; loose files are read into memory first.
         sf::SoundBuffer buffer;
         std::string     loadError;
-        const bool success = Internal::SFMLResourceLoader::loadSoundBufferFromFileBytes(resolvedPath, buffer, &loadError);
+        bool            success = false;
+        if (packed)
+        {
+            success =
+                Internal::SFMLResourceLoader::loadSoundBufferFromMemory(packed->data, packed->size, buffer, &loadError);
+        }
+        else
+        {
+            success = Internal::SFMLResourceLoader::loadSoundBufferFromFileBytes(resolvedPath, buffer, &loadError);
+        }
 
 #ifndef _WIN32
         if (oldStderr != -1)
@@ -166,32 +196,52 @@ bool SAudio::loadSound(const std::string& id, const std::string& filepath, Audio
         }
 
         m_soundBuffers[id] = std::move(buffer);
-        LOG_INFO("SAudio: Loaded sound '{}' from '{}'", id, resolvedStr);
+        LOG_INFO("SAudio: Loaded sound '{}' from '{}'{}", id, resolvedStr, packed ? " (audio pack)" : "");
+
+        // A synchronous load overtakes an asynchronous one still in flight.
+        if (m_loadingSounds.erase(id) > 0)
+        {
+            startQueuedPlays(id);
+        }
         return true;
     }
 
     {
         const std::filesystem::path resolvedPath = Internal::ExecutablePaths::resolveRelativeToExecutableDir(filepath);
         m_musicPaths[id]                         = resolvedPath.string();
-        LOG_INFO("SAudio: Registered music '{}' from '{}'", id, m_musicPaths[id]);
+        if (const Internal::AudioPackView* packed = findPacked(filepath))
+        {
+            m_packedMusic[id] = *packed;
+        }
+        else
+        {
+            m_packedMusic.erase(id);
+        }
+        LOG_INFO("SAudio: Registered music '{}' from '{}'{}",
+                 id,
+                 m_musicPaths[id],
+                 m_packedMusic.count(id) > 0 ? " (audio pack)" : "");
     }
     return true;
 }
 
 void SAudio::unloadSound(const std::string& id)
 {
+    // Forgetting the ticket makes collectLoadedSounds() discard a load still in flight.
+    m_loadingSounds.erase(id);
+    m_queuedPlays.erase(std::remove_if(m_queuedPlays.begin(),
+                                       m_queuedPlays.end(),
+                                       [&id](const QueuedPlay& play) { return play.id == id; }),
+                        m_queuedPlays.end());
+
     auto bufferIt = m_soundBuffers.find(id);
     if (bufferIt != m_soundBuffers.end())
     {
-        for (auto& slot : m_soundPool)
+        for (size_t i = m_voices.size(); i-- > 0;)
         {
-            if (slot.inUse && slot.sound && (&slot.sound->getBuffer() == &bufferIt->second))
+            if (m_voices[i].buffer == &bufferIt->second)
             {
-                slot.sound->stop();
-                m_entityToSlot.erase(slot.owner);
-                slot.inUse = false;
-                slot.owner = Entity::null();
-                slot.sound.reset();
+                releaseVoice(i);
             }
         }
         m_soundBuffers.erase(bufferIt);
@@ -206,97 +256,336 @@ void SAudio::unloadSound(const std::string& id)
             stopMusic();
         }
         m_musicPaths.erase(musicIt);
+        m_packedMusic.erase(id);
     }
 }
 
-bool SAudio::playSfx(Entity entity, const std::string& id, bool loop, float volume)
+bool SAudio::loadSoundAsync(const std::string& id, const std::string& filepath)
 {
-    if (!m_initialized || !entity.isValid())
+    if (!m_initialized)
     {
+        LOG_ERROR("Cannot load sound: audio system not initialized");
         return false;
     }
 
-    auto bufferIt = m_soundBuffers.find(id);
-    if (bufferIt == m_soundBuffers.end())
+    if (m_soundBuffers.find(id) != m_soundBuffers.end() || m_loadingSounds.find(id) != m_loadingSounds.end())
     {
-        LOG_WARN("Sound buffer '{}' not found", id);
-        return false;
+        return true;
     }
 
-    stopSfx(entity);
+    const std::uint64_t ticket = ++m_nextLoadTicket;
+    m_loadingSounds[id]        = ticket;
+    if (const Internal::AudioPackView* packed = findPacked(filepath))
+    {
+        m_bankLoader.requestFromMemory(id, packed->data, packed->size, ticket);
+        return true;
+    }
+
+    // Existence is checked on the worker; resolving the path is cheap string work.
+    const std::filesystem::path resolvedPath = Internal::ExecutablePaths::resolveRelativeToExecutableDir(filepath);
+    m_bankLoader.request(id, resolvedPath.string(), ticket);
+    return true;
+}
 
-    int slotIndex = findAvailableSlot();
-    if (slotIndex < 0)
+bool SAudio::mountAudioPack(const std::string& filepath)
+{
+    const std::filesystem::path resolvedPath = Internal::ExecutablePaths::resolveRelativeToExecutableDir(filepath);
+
+    auto        pack = std::make_unique<Internal::AudioPack>();
+    std::string error;
+    if (!pack->open(resolvedPath, &error))
     {
-        LOG_WARN("Sound pool full, cannot play '{}'", id);
+        LOG_ERROR("SAudio: Failed to mount audio pack '{}' : {}", resolvedPath.string(), error);
         return false;
     }
 
-    auto& slot = m_soundPool[slotIndex];
-    slot.sound.emplace(bufferIt->second);
-    slot.baseVolume = std::clamp(volume, AudioConstants::MIN_VOLUME, AudioConstants::MAX_VOLUME);
-    slot.sound->setVolume(calculateEffectiveSfxVolume(slot.baseVolume) * 100.0f);
-    slot.sound->setLooping(loop);
-    slot.sound->play();
-    slot.inUse = true;
-    slot.owner = entity;
-
-    m_entityToSlot[entity] = static_cast<size_t>(slotIndex);
+    LOG_INFO("SAudio: Mounted audio pack '{}' ({} entries)", resolvedPath.string(), pack->entryCount());
+    m_audioPacks.push_back(std::move(pack));
     return true;
 }
 
-void SAudio::stopSfx(Entity entity)
+const Internal::AudioPackView* SAudio::findPacked(const std::string& filepath) const
 {
-    auto it = m_entityToSlot.find(entity);
-    if (it == m_entityToSlot.end())
+    // Later mounts override earlier ones, so a patch pack can replace individual sounds.
+    for (auto it = m_audioPacks.rbegin(); it != m_audioPacks.rend(); ++it)
     {
-        return;
+        if (const Internal::AudioPackView* view = (*it)->find(filepath))
+        {
+            return view;
+        }
     }
+    return nullptr;
+}
 
-    size_t index = it->second;
-    if (index < m_soundPool.size())
+bool SAudio::isSoundLoading(const std::string& id) const
+{
+    return m_loadingSounds.find(id) != m_loadingSounds.end();
+}
+
+size_t SAudio::loadSoundBankAsync(const std::vector<SoundBankEntry>& bank)
+{
+    size_t queued = 0;
+    for (const SoundBankEntry& entry : bank)
     {
-        auto& slot = m_soundPool[index];
-        if (slot.inUse)
+        const bool known = m_soundBuffers.find(entry.id) != m_soundBuffers.end() || isSoundLoading(entry.id);
+        if (!known && loadSoundAsync(entry.id, entry.filepath))
         {
-            if (slot.sound)
-            {
-                slot.sound->stop();
-            }
+            ++queued;
         }
-        slot.inUse = false;
-        slot.owner = Entity::null();
-        slot.sound.reset();
     }
+    return queued;
+}
 
-    m_entityToSlot.erase(it);
+size_t SAudio::getLoadingSoundCount() const
+{
+    return m_loadingSounds.size();
 }
 
-void SAudio::setSfxVolume(Entity entity, float volume)
+void SAudio::setLoadingPlayPolicy(LoadingPlayPolicy policy)
+{
+    m_loadingPlayPolicy = policy;
+}
+
+LoadingPlayPolicy SAudio::getLoadingPlayPolicy() const
 {
-    auto it = m_entityToSlot.find(entity);
-    if (it == m_entityToSlot.end())
+    return m_loadingPlayPolicy;
+}
+
+void SAudio::collectLoadedSounds()
+{
+    if (m_bankLoader.collect(m_loadResults) == 0)
     {
         return;
     }
 
-    size_t index = it->second;
-    if (index >= m_soundPool.size())
+    for (Internal::SoundLoadResult& result : m_loadResults)
     {
-        return;
+        // Unloaded, or re-requested after an unload, while this decode was in flight.
+        auto loading = m_loadingSounds.find(result.id);
+        if (loading == m_loadingSounds.end() || loading->second != result.ticket)
+        {
+            continue;
+        }
+        m_loadingSounds.erase(loading);
+
+        if (!result.ok)
+        {
+            LOG_ERROR("Failed to load sound '{}' from '{}' : {}", result.id, result.path, result.error);
+        }
+        else if (m_soundBuffers.find(result.id) == m_soundBuffers.end())
+        {
+            m_soundBuffers.emplace(result.id, std::move(result.buffer));
+            LOG_INFO("SAudio: Loaded sound '{}' from '{}'", result.id, result.path);
+        }
+        startQueuedPlays(result.id);
     }
+    m_loadResults.clear();
+}
+
+void SAudio::startQueuedPlays(const std::string& id)
+{
+    // Split off first: startVoice() edits m_queuedPlays through stopSfx().
+    auto waiting = std::stable_partition(
+        m_queuedPlays.begin(), m_queuedPlays.end(), [&id](const QueuedPlay& play) { return play.id != id; });
+    std::vector<QueuedPlay> ready(std::make_move_iterator(waiting), std::make_move_iterator(m_queuedPlays.end()));
+    m_queuedPlays.erase(waiting, m_queuedPlays.end());
 
-    auto& slot = m_soundPool[index];
-    if (!slot.inUse)
+    if (m_soundBuffers.find(id) == m_soundBuffers.end())
     {
         return;
     }
+    for (QueuedPlay& play : ready)
+    {
+        startVoice(play.entity, play.id, play.voice);
+    }
+}
 
-    slot.baseVolume = std::clamp(volume, AudioConstants::MIN_VOLUME, AudioConstants::MAX_VOLUME);
-    if (slot.sound)
+bool SAudio::playSfx(Entity entity, const std::string& id, bool loop, float volume, int priority)
+{
+    Voice voice;
+    voice.baseVolume = volume;
+    voice.priority   = priority;
+    voice.loop       = loop;
+    return startVoice(entity, id, voice);
+}
+
+bool SAudio::playSource(Entity                          entity,
+                        const Components::CAudioSource& source,
+                        const std::string&              clipId,
+                        World&                          world)
+{
+    Voice voice;
+    voice.baseVolume = source.volume;
+    voice.priority   = source.priority;
+    voice.loop       = source.loop;
+    voice.spatial    = source.spatial;
+    if (source.spatial)
+    {
+        voice.minDistance = std::max(source.minDistance, 0.0f);
+        voice.maxDistance = std::max(source.maxDistance, voice.minDistance);
+        if (const auto* transform = world.components().tryGet<Components::CTransform>(entity))
+        {
+            voice.position = transform->getPosition();
+        }
+    }
+    return startVoice(entity, clipId, voice);
+}
+
+bool SAudio::startVoice(Entity entity, const std::string& id, Voice voice)
+{
+    if (!m_initialized || !entity.isValid())
+    {
+        return false;
+    }
+
+    auto bufferIt = m_soundBuffers.find(id);
+    if (bufferIt == m_soundBuffers.end())
+    {
+        if (!isSoundLoading(id))
+        {
+            LOG_WARN("Sound buffer '{}' not found", id);
+            return false;
+        }
+        if (m_loadingPlayPolicy == LoadingPlayPolicy::Skip)
+        {
+            LOG_DEBUG("SAudio: Skipping '{}' (still loading)", id);
+            return false;
+        }
+        stopSfx(entity);
+        m_queuedPlays.push_back(QueuedPlay{entity, id, voice});
+        return true;
+    }
+
+    voice.buffer     = &bufferIt->second;
+    voice.owner      = entity;
+    voice.baseVolume = std::clamp(voice.baseVolume, AudioConstants::MIN_VOLUME, AudioConstants::MAX_VOLUME);
+    voice.duration   = bufferIt->second.getDuration().asSeconds();
+    spatialize(voice);
+
+    const VoicePlan plan = planVoice(entity, voice);
+    if (!plan.accepted)
+    {
+        LOG_WARN("Sound pool full, cannot play '{}'", id);
+        return false;
+    }
+
+    // Accepted: only now replace the entity's voice. Owners are looked up again since releases reorder m_voices.
+    stopSfx(entity);
+    if (plan.dropped.isValid())
+    {
+        releaseVoice(m_entityToVoice.at(plan.dropped));
+    }
+
+    int slotIndex = -1;
+    if (plan.audible && plan.victim.isValid())
+    {
+        const size_t victimIndex = m_entityToVoice.at(plan.victim);
+        slotIndex                = m_voices[victimIndex].slot;
+        if (plan.dropVictim)
+        {
+            releaseVoice(victimIndex);
+        }
+        else
+        {
+            virtualizeVoice(m_voices[victimIndex]);
+        }
+        m_freeSlots.pop_back();  // Both pushed slotIndex
+    }
+    else if (plan.audible)
+    {
+        slotIndex = static_cast<int>(m_freeSlots.back());
+        m_freeSlots.pop_back();
+    }
+
+    m_entityToVoice[entity] = m_voices.size();
+    m_voices.push_back(voice);
+    if (slotIndex >= 0)
+    {
+        bindVoice(m_voices.back(), static_cast<size_t>(slotIndex));
+    }
+    return true;
+}
+
+SAudio::VoicePlan SAudio::planVoice(Entity entity, const Voice& voice) const
+{
+    VoicePlan    plan;
+    const auto   current  = m_entityToVoice.find(entity);
+    const Voice* replaced = current != m_entityToVoice.end() ? &m_voices[current->second] : nullptr;
+
+    // Out-of-range voices start virtual, so they never take a slot from an audible one.
+    if (voice.gain > 0.0f)
+    {
+        plan.audible = !m_freeSlots.empty() || (replaced && replaced->slot >= 0);
+        if (!plan.audible)
+        {
+            const int weakest = findWeakestAudibleVoice();
+            if (weakest >= 0 && outranks(voice, m_voices[weakest]))
+            {
+                plan.audible = true;
+                plan.victim  = m_voices[weakest].owner;
+            }
+        }
+    }
+
+    // Either the new voice or the victim it displaces becomes virtual (or neither). At the cap the
+    // weakest virtual voice makes room, or the newcomer is refused / the victim dropped if it is the weakest.
+    const Voice* becomesVirtual = nullptr;
+    if (!plan.audible)
+    {
+        becomesVirtual = &voice;
+    }
+    else if (plan.victim.isValid())
+    {
+        becomesVirtual = &m_voices[m_entityToVoice.at(plan.victim)];
+    }
+
+    const size_t virtualCount = getVirtualVoiceCount() - (replaced && replaced->slot < 0 ? 1 : 0);
+    if (becomesVirtual && virtualCount >= AudioConstants::MAX_VIRTUAL_VOICES)
+    {
+        const int weakest = findWeakestVirtualVoice(entity);
+        if (weakest >= 0 && outranks(*becomesVirtual, m_voices[weakest]))
+        {
+            plan.dropped = m_voices[weakest].owner;
+        }
+        else if (becomesVirtual == &voice)
+        {
+            return plan;
+        }
+        else
+        {
+            plan.dropVictim = true;
+        }
+    }
+
+    plan.accepted = true;
+    return plan;
+}
+
+void SAudio::stopSfx(Entity entity)
+{
+    m_queuedPlays.erase(std::remove_if(m_queuedPlays.begin(),
+                                       m_queuedPlays.end(),
+                                       [entity](const QueuedPlay& play) { return play.entity == entity; }),
+                        m_queuedPlays.end());
+
+    auto it = m_entityToVoice.find(entity);
+    if (it != m_entityToVoice.end())
+    {
+        releaseVoice(it->second);
+    }
+}
+
+void SAudio::setSfxVolume(Entity entity, float volume)
+{
+    auto it = m_entityToVoice.find(entity);
+    if (it == m_entityToVoice.end())
     {
-        slot.sound->setVolume(calculateEffectiveSfxVolume(slot.baseVolume) * 100.0f);
+        return;
     }
+
+    Voice& voice     = m_voices[it->second];
+    voice.baseVolume = std::clamp(volume, AudioConstants::MIN_VOLUME, AudioConstants::MAX_VOLUME);
+    applyVoiceMix(voice);
 }
 
 bool SAudio::playMusic(const std::string& id, bool loop)
@@ -330,8 +619,12 @@ bool SAudio::playMusic(const std::string& id, bool loop)
     }
 #endif
 
-    m_currentMusic = std::make_unique<sf::Music>();
-    bool success   = m_currentMusic->openFromFile(it->second);
+    // Packed music streams from the mapped pack, which stays mounted as long as this system exists.
+    const auto packedIt = m_packedMusic.find(id);
+    m_currentMusic      = std::make_unique<sf::Music>();
+    bool success        = packedIt != m_packedMusic.end()
+                              ? m_currentMusic->openFromMemory(packedIt->second.data, packedIt->second.size)
+                              : m_currentMusic->openFromFile(it->second);
 
 #ifndef _WIN32
     if (oldStderr != -1)
@@ -391,15 +684,9 @@ void SAudio::setMasterVolume(float volume)
 {
     m_masterVolume = std::clamp(volume, AudioConstants::MIN_VOLUME, AudioConstants::MAX_VOLUME);
 
-    for (auto& slot : m_soundPool)
+    for (const Voice& voice : m_voices)
     {
-        if (slot.inUse)
-        {
-            if (slot.sound)
-            {
-                slot.sound->setVolume(calculateEffectiveSfxVolume(slot.baseVolume) * 100.0f);
-            }
-        }
+        applyVoiceMix(voice);
     }
 
     if (m_currentMusic)
@@ -430,28 +717,43 @@ float SAudio::getMusicVolume() const
 
 void SAudio::update(float deltaTime)
 {
-    (void)deltaTime;
-
     if (!m_initialized)
     {
         return;
     }
 
-    for (auto& slot : m_soundPool)
+    collectLoadedSounds();
+
+    // releaseVoice() swaps the last voice into the released index, so only advance past kept voices.
+    for (size_t i = 0; i < m_voices.size();)
     {
-        if (!slot.inUse)
+        Voice& voice = m_voices[i];
+        if (voice.slot >= 0)
         {
-            continue;
+            const auto& sound = m_soundPool[voice.slot].sound;
+            if (!sound || sound->getStatus() == sf::SoundSource::Status::Stopped)
+            {
+                releaseVoice(i);
+                continue;
+            }
         }
-
-        if (!slot.sound || slot.sound->getStatus() == sf::SoundSource::Status::Stopped)
+        else
         {
-            m_entityToSlot.erase(slot.owner);
-            slot.inUse = false;
-            slot.owner = Entity::null();
-            slot.sound.reset();
+            voice.offset += deltaTime;
+            if (voice.offset >= voice.duration)
+            {
+                if (!voice.loop || voice.duration <= 0.0f)
+                {
+                    releaseVoice(i);
+                    continue;
+                }
+                voice.offset = std::fmod(voice.offset, voice.duration);
+            }
         }
+        ++i;
     }
+
+    promoteVirtualVoices();
 }
 
 void SAudio::update(float deltaTime, World& world)
@@ -459,75 +761,372 @@ void SAudio::update(float deltaTime, World& world)
     updateEcs(deltaTime, world);
 }
 
+void SAudio::bindWorld(World& world)
+{
+    m_playSub = ScopedSubscription(
+        world.events(),
+        world.events().subscribe<AudioPlayRequest>([this](const AudioPlayRequest& ev, World&)
+                                                   { m_pendingPlayRequests.push_back(ev); }));
+    m_stopSub = ScopedSubscription(
+        world.events(),
+        world.events().subscribe<AudioStopRequest>([this](const AudioStopRequest& ev, World&)
+                                                   { m_pendingStopRequests.push_back(ev); }));
+    m_subscribed = true;
+}
+
 void SAudio::updateEcs(float deltaTime, World& world)
 {
+    // Fallback for callers that never bound a world; requests pumped before this point are lost.
+    if (!m_subscribed)
+    {
+        bindWorld(world);
+    }
+
+    if (m_initialized)
+    {
+        updateSpatialVoices(world);
+    }
+
     update(deltaTime);
 
     if (!m_initialized)
     {
+        m_pendingStopRequests.clear();
+        m_pendingPlayRequests.clear();
         return;
     }
 
-    bool settingsApplied = false;
+    applyVolumeSettings(world);
+
+    // Stops first, so a stop and a play for the same entity in one frame restarts it.
+    for (const AudioStopRequest& request : m_pendingStopRequests)
+    {
+        stopSfx(request.entity);
+    }
+    for (const AudioPlayRequest& request : m_pendingPlayRequests)
+    {
+        const auto* source = world.components().tryGet<Components::CAudioSource>(request.entity);
+        if (!source)
+        {
+            LOG_WARN("SAudio: Play request for an entity without CAudioSource");
+            continue;
+        }
+        playSource(request.entity, *source, request.clipId.empty() ? source->clipId : request.clipId, world);
+    }
+    m_pendingStopRequests.clear();
+    m_pendingPlayRequests.clear();
+}
+
+void SAudio::applyVolumeSettings(World& world)
+{
+    const Components::CAudioSettings* settings = nullptr;
     world.components().each<Components::CAudioSettings>(
-        [this, &settingsApplied](Entity, const Components::CAudioSettings& settings)
+        [&settings](Entity, const Components::CAudioSettings& candidate)
         {
-            if (settingsApplied)
+            if (!settings)
             {
-                return;
+                settings = &candidate;
             }
-
-            setMasterVolume(settings.masterVolume);
-            setMusicVolume(settings.musicVolume);
-            m_sfxVolume     = std::clamp(settings.sfxVolume, AudioConstants::MIN_VOLUME, AudioConstants::MAX_VOLUME);
-            settingsApplied = true;
         });
 
-    // Backward compatibility: treat CAudioListener as a legacy place for volume settings.
-    if (!settingsApplied)
+    float master = m_masterVolume;
+    float music  = m_musicVolume;
+    float sfx    = m_sfxVolume;
+    if (settings)
+    {
+        master = settings->masterVolume;
+        music  = settings->musicVolume;
+        sfx    = settings->sfxVolume;
+    }
+    else
     {
-        bool listenerApplied = false;
+        // Backward compatibility: treat CAudioListener as a legacy place for volume settings.
+        bool listenerFound = false;
         world.components().each<Components::CAudioListener>(
-            [this, &listenerApplied](Entity, const Components::CAudioListener& listener)
+            [&](Entity, const Components::CAudioListener& listener)
             {
-                if (listenerApplied)
+                if (!listenerFound)
                 {
-                    return;
+                    master        = listener.masterVolume;
+                    music         = listener.musicVolume;
+                    listenerFound = true;
                 }
-                setMasterVolume(listener.masterVolume);
-                setMusicVolume(listener.musicVolume);
-                listenerApplied = true;
             });
     }
 
-    world.components().each<Components::CAudioSource>(
-        [this](Entity entity, Components::CAudioSource& source)
+    // The setters walk every voice, so only call them for values that actually changed.
+    master = std::clamp(master, AudioConstants::MIN_VOLUME, AudioConstants::MAX_VOLUME);
+    music  = std::clamp(music, AudioConstants::MIN_VOLUME, AudioConstants::MAX_VOLUME);
+    sfx    = std::clamp(sfx, AudioConstants::MIN_VOLUME, AudioConstants::MAX_VOLUME);
+    if (sfx != m_sfxVolume)
+    {
+        m_sfxVolume = sfx;
+        if (master == m_masterVolume)
         {
-            if (source.stopRequested)
+            for (const Voice& voice : m_voices)
             {
-                stopSfx(entity);
+                applyVoiceMix(voice);
             }
+        }
+    }
+    if (master != m_masterVolume)
+    {
+        setMasterVolume(master);
+    }
+    if (music != m_musicVolume)
+    {
+        setMusicVolume(music);
+    }
+}
+
+size_t SAudio::getAudibleVoiceCount() const
+{
+    return m_voices.size() - getVirtualVoiceCount();
+}
+
+size_t SAudio::getVirtualVoiceCount() const
+{
+    const size_t audible = m_initialized ? m_soundPool.size() - m_freeSlots.size() : 0;
+    return m_voices.size() - audible;
+}
 
-            if (source.playRequested)
+bool SAudio::outranks(const Voice& a, const Voice& b)
+{
+    if (a.priority != b.priority)
+    {
+        return a.priority > b.priority;
+    }
+    return a.baseVolume * a.gain > b.baseVolume * b.gain;
+}
+
+void SAudio::spatialize(Voice& voice) const
+{
+    voice.gain = 1.0f;
+    voice.pan  = 0.0f;
+    if (!voice.spatial || !m_hasListener)
+    {
+        return;
+    }
+
+    const float dx         = voice.position.x - m_listenerPosition.x;
+    const float dy         = voice.position.y - m_listenerPosition.y;
+    const float distanceSq = dx * dx + dy * dy;
+    if (distanceSq >= voice.maxDistance * voice.maxDistance)
+    {
+        voice.gain = 0.0f;
+        return;
+    }
+
+    // Linear roll-off between minDistance and maxDistance reaches exactly zero at the cull radius.
+    const float distance = std::sqrt(distanceSq);
+    const float range    = voice.maxDistance - voice.minDistance;
+    if (distance > voice.minDistance && range > 0.0f)
+    {
+        voice.gain = 1.0f - (distance - voice.minDistance) / range;
+    }
+    if (m_panDistance > 0.0f)
+    {
+        voice.pan = std::clamp(dx / m_panDistance, -1.0f, 1.0f);
+    }
+}
+
+void SAudio::updateSpatialVoices(World& world)
+{
+    m_hasListener = false;
+    world.components().each<Components::CAudioListener>(
+        [this, &world](Entity entity, const Components::CAudioListener& listener)
+        {
+            const auto* transform = world.components().tryGet<Components::CTransform>(entity);
+            if (m_hasListener || !transform)
             {
-                playSfx(entity, source.clipId, source.loop, source.volume);
+                return;
             }
-
-            source.playRequested = false;
-            source.stopRequested = false;
+            m_hasListener      = true;
+            m_listenerPosition = transform->getPosition();
+            m_panDistance      = listener.panDistance;
         });
+
+    // Gather positions first so the attenuation pass below only touches the dense voice array.
+    for (Voice& voice : m_voices)
+    {
+        if (!voice.spatial)
+        {
+            continue;
+        }
+        if (const auto* transform = world.components().tryGet<Components::CTransform>(voice.owner))
+        {
+            voice.position = transform->getPosition();
+        }
+    }
+
+    for (Voice& voice : m_voices)
+    {
+        if (!voice.spatial)
+        {
+            continue;
+        }
+        spatialize(voice);
+        if (voice.slot < 0)
+        {
+            continue;
+        }
+        if (voice.gain > 0.0f)
+        {
+            applyVoiceMix(voice);
+        }
+        else
+        {
+            virtualizeVoice(voice);
+        }
+    }
 }
 
-int SAudio::findAvailableSlot()
+void SAudio::applyVoiceMix(const Voice& voice)
 {
-    for (size_t i = 0; i < m_soundPool.size(); ++i)
+    if (voice.slot < 0 || !m_soundPool[voice.slot].sound)
+    {
+        return;
+    }
+    sf::Sound& sound = *m_soundPool[voice.slot].sound;
+    sound.setVolume(calculateEffectiveSfxVolume(voice.baseVolume * voice.gain) * 100.0f);
+    sound.setPan(voice.pan);
+}
+
+int SAudio::acquireSlot(const Voice& candidate)
+{
+    if (!m_freeSlots.empty())
+    {
+        const size_t slotIndex = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        return static_cast<int>(slotIndex);
+    }
+
+    const int weakest = findWeakestAudibleVoice();
+    if (weakest < 0 || !outranks(candidate, m_voices[weakest]))
+    {
+        return -1;
+    }
+
+    Voice&    victim    = m_voices[weakest];
+    const int slotIndex = victim.slot;
+    virtualizeVoice(victim);
+    m_freeSlots.pop_back();  // virtualizeVoice() just pushed slotIndex
+    return slotIndex;
+}
+
+int SAudio::findWeakestAudibleVoice() const
+{
+    int weakest = -1;
+    for (size_t i = 0; i < m_voices.size(); ++i)
+    {
+        if (m_voices[i].slot >= 0 && (weakest < 0 || outranks(m_voices[weakest], m_voices[i])))
+        {
+            weakest = static_cast<int>(i);
+        }
+    }
+    return weakest;
+}
+
+int SAudio::findWeakestVirtualVoice(Entity exclude) const
+{
+    int weakest = -1;
+    for (size_t i = 0; i < m_voices.size(); ++i)
+    {
+        const Voice& voice = m_voices[i];
+        if (voice.slot < 0 && voice.owner != exclude && (weakest < 0 || outranks(m_voices[weakest], voice)))
+        {
+            weakest = static_cast<int>(i);
+        }
+    }
+    return weakest;
+}
+
+void SAudio::bindVoice(Voice& voice, size_t slotIndex)
+{
+    SoundSlot& slot = m_soundPool[slotIndex];
+    slot.sound.emplace(*voice.buffer);
+    slot.sound->setLooping(voice.loop);
+    if (voice.offset > 0.0f)
+    {
+        slot.sound->setPlayingOffset(sf::seconds(voice.offset));
+    }
+    slot.owner = voice.owner;
+    voice.slot = static_cast<int>(slotIndex);
+    applyVoiceMix(voice);
+    slot.sound->play();
+}
+
+void SAudio::virtualizeVoice(Voice& voice)
+{
+    SoundSlot& slot = m_soundPool[voice.slot];
+    if (slot.sound)
+    {
+        voice.offset = slot.sound->getPlayingOffset().asSeconds();
+        slot.sound->stop();
+        slot.sound.reset();
+    }
+    slot.owner = Entity::null();
+    m_freeSlots.push_back(static_cast<size_t>(voice.slot));
+    voice.slot = -1;
+}
+
+void SAudio::releaseVoice(size_t voiceIndex)
+{
+    Voice& voice = m_voices[voiceIndex];
+    if (voice.slot >= 0)
+    {
+        virtualizeVoice(voice);
+    }
+    m_entityToVoice.erase(voice.owner);
+
+    if (voiceIndex + 1 != m_voices.size())
+    {
+        m_voices[voiceIndex]                        = m_voices.back();
+        m_entityToVoice[m_voices[voiceIndex].owner] = voiceIndex;
+    }
+    m_voices.pop_back();
+}
+
+void SAudio::promoteVirtualVoices()
+{
+    m_virtualScratch.clear();
+    for (size_t i = 0; i < m_voices.size(); ++i)
+    {
+        if (m_voices[i].slot < 0 && m_voices[i].gain > 0.0f)
+        {
+            m_virtualScratch.push_back(i);
+        }
+    }
+    if (m_virtualScratch.empty())
+    {
+        return;
+    }
+
+    const size_t promoted = std::min(m_freeSlots.size(), m_virtualScratch.size());
+    auto         stronger = [this](size_t a, size_t b) { return outranks(m_voices[a], m_voices[b]); };
+    std::partial_sort(m_virtualScratch.begin(),
+                      m_virtualScratch.begin() + static_cast<std::ptrdiff_t>(promoted),
+                      m_virtualScratch.end(),
+                      stronger);
+    for (size_t i = 0; i < promoted; ++i)
+    {
+        const size_t slotIndex = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        bindVoice(m_voices[m_virtualScratch[i]], slotIndex);
+    }
+
+    // At most one swap per update, so voices of equal rank cannot thrash between slots.
+    if (promoted < m_virtualScratch.size())
     {
-        if (!m_soundPool[i].inUse)
+        const auto best = std::min_element(
+            m_virtualScratch.begin() + static_cast<std::ptrdiff_t>(promoted), m_virtualScratch.end(), stronger);
+        Voice&    candidate = m_voices[*best];
+        const int slotIndex = acquireSlot(candidate);
+        if (slotIndex >= 0)
         {
-            return static_cast<int>(i);
+            bindVoice(candidate, static_cast<size_t>(slotIndex));
         }
     }
-    return -1;
 }
 
 float SAudio::calculateEffectiveSfxVolume(float baseVolume) const
@@ -172,9 +172,9 @@ Vec2 SCamera::screenToWorld(const World& world, std::string_view cameraName, con
     sf::Vector2u windowSizePx(0, 0);
     if (auto* renderer = Systems::SystemLocator::tryRenderer())
     {
-        if (auto* window = renderer->getWindow())
+        if (auto* target = renderer->getRenderTarget())
         {
-            windowSizePx = window->getSize();
+            windowSizePx = target->getSize();
         }
     }
 
@@ -200,9 +200,9 @@ Vec2i SCamera::worldToScreen(const World& world, std::string_view cameraName, co
     sf::Vector2u windowSizePx(0, 0);
     if (auto* renderer = Systems::SystemLocator::tryRenderer())
     {
-        if (auto* window = renderer->getWindow())
+        if (auto* target = renderer->getRenderTarget())
         {
-            windowSizePx = window->getSize();
+            windowSizePx = target->getSize();
         }
     }
 
@@ -3,6 +3,7 @@
 #include <imgui-SFML.h>
 #include <imgui.h>
 #include <algorithm>
+#include <iterator>
 #include <string>
 
 #include "CInputController.h"
@@ -40,6 +41,10 @@ void SInput::shutdown()
     m_mousePosition = Vec2i{0, 0};
     m_actionBindings.clear();
     m_actionStates.clear();
+    m_actionNames.clear();
+    m_actionIds.clear();
+    m_controllers.clear();
+    m_controllerIndex.clear();
     m_subscribers.clear();
     m_listenerPointers.clear();
     m_nextBindingId = 1;
@@ -279,6 +284,9 @@ void SInput::dispatch(World& world, const InputEvent& inputEvent)
             case InputEventType::WindowResized:
                 l->onWindowEvent(inputEvent.window);
                 break;
+            case InputEventType::Action:
+                l->onAction(inputEvent.action);
+                break;
             default:
                 break;
         }
@@ -471,93 +479,26 @@ void SInput::update(float /*deltaTime*/, World& world)
     registerControllerBindings(world);
 
     // Evaluate actions centrally
-    for (const auto& actionKv : m_actionBindings)
+    for (auto& actionKv : m_actionBindings)
     {
         const std::string& actionName = actionKv.first;
-        const auto&        bindings   = actionKv.second;
         ActionState        newState   = ActionState::None;
-
-        for (const auto& pr : bindings)
+        for (const auto& pr : actionKv.second)
         {
-            const auto& binding     = pr.second;
-            bool        anyDown     = false;
-            bool        anyPressed  = false;
-            bool        anyReleased = false;
-            for (auto k : binding.keys)
-            {
-                if (m_keyDown.find(k) != m_keyDown.end() && m_keyDown[k])
-                    anyDown = true;
-                if (m_keyPressed.find(k) != m_keyPressed.end() && m_keyPressed[k])
-                    anyPressed = true;
-                if (m_keyReleased.find(k) != m_keyReleased.end() && m_keyReleased[k])
-                    anyReleased = true;
-                if (m_keyRepeat.find(k) != m_keyRepeat.end() && m_keyRepeat[k])
-                    anyPressed = true;
-            }
-            for (auto mb : binding.mouseButtons)
-            {
-                if (m_mouseDown.find(mb) != m_mouseDown.end() && m_mouseDown[mb])
-                    anyDown = true;
-                if (m_mousePressed.find(mb) != m_mousePressed.end() && m_mousePressed[mb])
-                    anyPressed = true;
-                if (m_mouseReleased.find(mb) != m_mouseReleased.end() && m_mouseReleased[mb])
-                    anyReleased = true;
-            }
-            switch (binding.trigger)
-            {
-                case ActionTrigger::Pressed:
-                {
-                    bool eff = anyPressed;
-                    if (!binding.allowRepeat)
-                    {
-                        // if any key repeat triggered and repeat not allowed, ignore as pressed
-                        bool repeatTriggered = false;
-                        for (auto k : binding.keys)
-                            if (m_keyRepeat.find(k) != m_keyRepeat.end() && m_keyRepeat[k])
-                            {
-                                repeatTriggered = true;
-                                break;
-                            }
-                        if (repeatTriggered)
-                            eff = false;
-                    }
-                    if (eff)
-                        newState = ActionState::Pressed;
-                    else if (anyDown)
-                        newState = ActionState::Held;
-                }
-                break;
-                case ActionTrigger::Held:
-                    if (anyDown)
-                        newState = anyPressed ? ActionState::Pressed : ActionState::Held;
-                    break;
-                case ActionTrigger::Released:
-                    if (anyReleased)
-                        newState = ActionState::Released;
-                    break;
-            }
+            newState = evaluateBinding(pr.second);
             if (newState != ActionState::None)
                 break;
         }
 
-        ActionState previous = ActionState::None;
-        auto        pit      = m_actionStates.find(actionName);
-        if (pit != m_actionStates.end())
-            previous = pit->second;
-        bool wasDown = (previous == ActionState::Pressed || previous == ActionState::Held);
-        if (!wasDown && newState == ActionState::Pressed)
-            m_actionStates[actionName] = ActionState::Pressed;
-        else if (wasDown && newState == ActionState::None)
-            m_actionStates[actionName] = ActionState::Released;
-        else
-            m_actionStates[actionName] = newState;
-
-        if (m_actionStates[actionName] != ActionState::None)
+        ActionState& state = m_actionStates[actionName];
+        state              = advanceActionState(state, newState);
+
+        if (state != ActionState::None)
         {
             InputEvent ie{};
             ie.type              = InputEventType::Action;
             ie.action.actionName = actionName;
-            ie.action.state      = m_actionStates[actionName];
+            ie.action.state      = state;
             for (const auto& kv : m_subscribers)
             {
                 try
@@ -578,43 +519,200 @@ void SInput::update(float /*deltaTime*/, World& world)
     updateControllerStates(world);
 }
 
-std::string SInput::scopeAction(Entity entity, const std::string& actionName) const
+ActionState SInput::evaluateBinding(const ActionBinding& binding) const
+{
+    auto isSet = [](const auto& states, auto key)
+    {
+        auto it = states.find(key);
+        return it != states.end() && it->second;
+    };
+
+    bool anyDown     = false;
+    bool anyPressed  = false;
+    bool anyReleased = false;
+    bool anyRepeat   = false;
+    for (auto k : binding.keys)
+    {
+        anyDown     = anyDown || isSet(m_keyDown, k);
+        anyPressed  = anyPressed || isSet(m_keyPressed, k);
+        anyReleased = anyReleased || isSet(m_keyReleased, k);
+        anyRepeat   = anyRepeat || isSet(m_keyRepeat, k);
+    }
+    for (auto mb : binding.mouseButtons)
+    {
+        anyDown     = anyDown || isSet(m_mouseDown, mb);
+        anyPressed  = anyPressed || isSet(m_mousePressed, mb);
+        anyReleased = anyReleased || isSet(m_mouseReleased, mb);
+    }
+    // Key repeats count as presses
+    anyPressed = anyPressed || anyRepeat;
+
+    switch (binding.trigger)
+    {
+        case ActionTrigger::Pressed:
+        {
+            // if any key repeat triggered and repeat not allowed, ignore as pressed
+            const bool eff = anyPressed && (binding.allowRepeat || !anyRepeat);
+            if (eff)
+                return ActionState::Pressed;
+            if (anyDown)
+                return ActionState::Held;
+            break;
+        }
+        case ActionTrigger::Held:
+            if (anyDown)
+                return anyPressed ? ActionState::Pressed : ActionState::Held;
+            break;
+        case ActionTrigger::Released:
+            if (anyReleased)
+                return ActionState::Released;
+            break;
+    }
+    return ActionState::None;
+}
+
+ActionState SInput::advanceActionState(ActionState previous, ActionState evaluated)
 {
-    return actionName + "@E" + std::to_string(entity.index) + "." + std::to_string(entity.generation);
+    const bool wasDown = (previous == ActionState::Pressed || previous == ActionState::Held);
+    if (wasDown && evaluated == ActionState::None)
+        return ActionState::Released;
+    return evaluated;
+}
+
+ActionId SInput::internAction(const std::string& actionName)
+{
+    auto [it, inserted] = m_actionIds.try_emplace(actionName, static_cast<ActionId>(m_actionNames.size()));
+    if (inserted)
+    {
+        m_actionNames.push_back(actionName);
+    }
+    return it->second;
 }
 
 void SInput::registerControllerBindings(World& world)
 {
+    const std::uint64_t frame = ++m_controllerFrame;
+
     world.components().each<Components::CInputController>(
-        [this](Entity entity, Components::CInputController& controller)
+        [this, frame](Entity entity, Components::CInputController& controller)
         {
+            auto [indexIt, inserted] = m_controllerIndex.try_emplace(entity, m_controllers.size());
+            if (inserted)
+            {
+                m_controllers.push_back(ControllerActions{entity, frame, {}});
+            }
+            ControllerActions& record = m_controllers[indexIt->second];
+            record.lastSeenFrame      = frame;
+
+            // A binding counts as registered only if it carries an ID this record issued, so bindings copied
+            // from another controller, or left on a removed and re-added one, are registered again.
+            const auto& ids    = record.bindingIds;
+            auto        issued = [&ids](BindingId id)
+            { return id != 0 && std::find(ids.begin(), ids.end(), id) != ids.end(); };
+
+            size_t registered = 0;
+            bool   pending    = false;
+            for (const auto& kv : controller.bindings)
+            {
+                for (const auto& binding : kv.second)
+                {
+                    if (issued(binding.bindingId))
+                        ++registered;
+                    else
+                        pending = true;
+                }
+            }
+
+            // Fewer registered bindings than issued IDs: some were removed, so rebuild from the component.
+            const bool rebuild = registered != record.bindingIds.size();
+            if (rebuild)
+            {
+                for (ControllerAction& action : record.actions)
+                    action.bindings.clear();
+                record.bindingIds.clear();
+            }
+            if (!pending && !rebuild)
+                return;
+
             for (auto& kv : controller.bindings)
             {
-                const std::string& actionName = kv.first;
                 for (auto& binding : kv.second)
                 {
-                    if (binding.bindingId == 0)
+                    if (!rebuild && issued(binding.bindingId))
+                        continue;
+
+                    const ActionId id        = internAction(kv.first);
+                    auto           matchesId = [id](const ControllerAction& a) { return a.id == id; };
+                    auto action = std::find_if(record.actions.begin(), record.actions.end(), matchesId);
+                    if (action == record.actions.end())
                     {
-                        std::string scoped = scopeAction(entity, actionName);
-                        binding.bindingId  = bindAction(scoped, binding.binding);
+                        record.actions.push_back(ControllerAction{id, ActionState::None, {}});
+                        action = std::prev(record.actions.end());
                     }
+                    controller.actionStates.try_emplace(kv.first, action->state);
+                    action->bindings.push_back(binding.binding);
+                    binding.bindingId = m_nextBindingId++;
+                    record.bindingIds.push_back(binding.bindingId);
                 }
             }
         });
+
+    // Drop records of entities that lost their controller (or were destroyed)
+    for (size_t i = 0; i < m_controllers.size();)
+    {
+        if (m_controllers[i].lastSeenFrame == frame)
+        {
+            ++i;
+            continue;
+        }
+        m_controllerIndex.erase(m_controllers[i].entity);
+        if (i + 1 != m_controllers.size())
+        {
+            m_controllers[i]                           = std::move(m_controllers.back());
+            m_controllerIndex[m_controllers[i].entity] = i;
+        }
+        m_controllers.pop_back();
+    }
 }
 
 void SInput::updateControllerStates(World& world)
 {
-    world.components().each<Components::CInputController>(
-        [this](Entity entity, Components::CInputController& controller)
+    for (ControllerActions& record : m_controllers)
+    {
+        for (ControllerAction& action : record.actions)
         {
-            for (const auto& kv : controller.bindings)
+            ActionState newState = ActionState::None;
+            for (const ActionBinding& binding : action.bindings)
             {
-                const std::string& actionName       = kv.first;
-                std::string        scoped           = scopeAction(entity, actionName);
-                controller.actionStates[actionName] = getActionState(scoped);
+                newState = evaluateBinding(binding);
+                if (newState != ActionState::None)
+                    break;
             }
-        });
+
+            newState = advanceActionState(action.state, newState);
+            if (newState == action.state && newState == ActionState::None)
+                continue;
+
+            // Only changed states are written back; like global actions, events go out every frame
+            // while the action is not None.
+            const std::string& actionName = m_actionNames[action.id];
+            if (newState != action.state)
+            {
+                action.state = newState;
+                if (auto* controller = world.components().tryGet<Components::CInputController>(record.entity))
+                    controller->actionStates[actionName] = newState;
+            }
+            if (newState == ActionState::None)
+                continue;
+
+            InputEvent ie{};
+            ie.type              = InputEventType::Action;
+            ie.action.actionName = actionName;
+            ie.action.state      = newState;
+            ie.action.entity     = record.entity;
+            dispatch(world, ie);
+        }
+    }
 }
 
 ListenerId SInput::subscribe(std::function<void(const InputEvent&)> cb)
@@ -691,4 +789,21 @@ ActionState SInput::getActionState(const std::string& actionName) const
     return it->second;
 }
 
+ActionId SInput::getActionId(const std::string& actionName) const
+{
+    auto it = m_actionIds.find(actionName);
+    return it != m_actionIds.end() ? it->second : kInvalidActionId;
+}
+
+ActionState SInput::getActionState(Entity entity, ActionId action) const
+{
+    auto it = m_controllerIndex.find(entity);
+    if (it == m_controllerIndex.end())
+        return ActionState::None;
+    for (const ControllerAction& a : m_controllers[it->second].actions)
+        if (a.id == action)
+            return a.state;
+    return ActionState::None;
+}
+
 }  // namespace Systems
@@ -2,140 +2,40 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
-#include <filesystem>
+#include <functional>
 #include <iomanip>
+#include <limits>
 #include <random>
 #include <sstream>
+#include "CCamera.h"
 #include "CParticleEmitter.h"
 #include "CTransform.h"
-#include "ExecutablePaths.h"
-#include "FileUtilities.h"
 #include "Logger.h"
+#include "ParticleKernel.h"
 #include "Registry.h"
-#include "SFMLResourceLoader.h"
+#include "S2DPhysics.h"
+#include "TextureLoader.h"
+#include "ThreadPool.h"
 #include "World.h"
 
 namespace Systems
 {
-const sf::Texture* SParticle::getCachedTexture(const std::string& resolvedKey) const
-{
-    auto it = m_textureCache.find(resolvedKey);
-    if (it == m_textureCache.end())
-    {
-        return nullptr;
-    }
-    return &it->second;
-}
+/// Uniform draws consumed per spawned particle: shape, lifetime, size, spread, speed, rotation, spin
+static constexpr std::size_t kSpawnDraws = 7;
 
-void SParticle::requestTextureLoad(const std::string& filepath)
-{
-    if (filepath.empty())
-    {
-        return;
-    }
+/// Particles whose draws are generated together by emitParticles()
+static constexpr std::size_t kSpawnBatch = 64;
 
-    const std::filesystem::path resolvedPath = Internal::ExecutablePaths::resolveRelativeToExecutableDir(filepath);
-    const std::string           resolvedStr  = resolvedPath.string();
+/// Distance a colliding particle is placed off the surface, so its next segment starts outside the shape
+static constexpr float kCollisionSkin = 0.001f;
 
-    if (resolvedStr.empty())
-    {
-        return;
-    }
+/// Aspect ratio assumed for camera culling without a render target (wide, so culling errs toward visible)
+static constexpr float kFallbackAspect = 21.0f / 9.0f;
 
-    if (m_textureCache.find(resolvedStr) != m_textureCache.end())
-    {
-        return;
-    }
-
-    m_queuedTextureLoads.insert(resolvedStr);
-}
-
-void SParticle::processQueuedTextureLoads()
+// Helper function to map a uniform draw in [0, 1) onto [min, max)
+static float uniformRange(float u, float min, float max)
 {
-    if (!m_window || !m_window->isOpen())
-    {
-        return;
-    }
-
-    if (m_queuedTextureLoads.empty())
-    {
-        return;
-    }
-
-    // Activate once per batch.
-    if (!m_window->setActive(true))
-    {
-        LOG_WARN("SParticle::processQueuedTextureLoads: setActive(true) failed, deferring {} queued textures",
-                 m_queuedTextureLoads.size());
-        return;
-    }
-
-    // Limit work per frame.
-    constexpr size_t kMaxLoadsPerFrame = 2;
-    size_t           loadsThisFrame    = 0;
-
-    static uint64_t s_debugLoadsLogged = 0;
-
-    for (auto it = m_queuedTextureLoads.begin(); it != m_queuedTextureLoads.end() && loadsThisFrame < kMaxLoadsPerFrame;)
-    {
-        const std::string& resolvedStr = *it;
-
-        const bool logThis = s_debugLoadsLogged < 32;
-        if (logThis)
-        {
-            LOG_INFO("SParticle::processQueuedTextureLoads: begin '{}'", resolvedStr);
-            ++s_debugLoadsLogged;
-        }
-
-        if (m_textureCache.find(resolvedStr) != m_textureCache.end())
-        {
-            it = m_queuedTextureLoads.erase(it);
-            continue;
-        }
-
-        const std::filesystem::path resolvedPath(resolvedStr);
-        std::error_code             ec;
-        const bool                  exists = std::filesystem::exists(resolvedPath, ec);
-        if (ec)
-        {
-            LOG_WARN("SParticle::processQueuedTextureLoads: exists() error for '{}' : {}", resolvedStr, ec.message());
-        }
-        if (!exists)
-        {
-            LOG_WARN("SParticle::processQueuedTextureLoads: file does not exist: '{}'", resolvedStr);
-            it = m_queuedTextureLoads.erase(it);
-            continue;
-        }
-
-        if (logThis)
-        {
-            LOG_INFO("SParticle::processQueuedTextureLoads: loading '{}'", resolvedStr);
-        }
-
-        sf::Texture texture;
-        std::string loadError;
-        const bool  loaded = Internal::SFMLResourceLoader::loadTextureFromFileBytes(resolvedPath, texture, &loadError);
-        if (!loaded)
-        {
-            LOG_WARN("SParticle::processQueuedTextureLoads: failed to load '{}' : {}", resolvedStr, loadError);
-            it = m_queuedTextureLoads.erase(it);
-            continue;
-        }
-
-        m_textureCache.emplace(resolvedStr, std::move(texture));
-        it = m_queuedTextureLoads.erase(it);
-        ++loadsThisFrame;
-    }
-}
-
-static std::random_device               s_rd;
-static std::mt19937                     s_gen(s_rd());
-static std::uniform_real_distribution<> s_dist(0.0, 1.0);
-
-// Helper function to generate random float
-static float randomFloat(float min, float max)
-{
-    return min + static_cast<float>(s_dist(s_gen)) * (max - min);
+    return min + u * (max - min);
 }
 
 // Helper function to interpolate between two values
@@ -145,27 +45,19 @@ static T lerp(const T& a, const T& b, float t)
     return a + (b - a) * t;
 }
 
-// Helper function to interpolate between two colors
-static Color lerpColor(const Color& a, const Color& b, float t)
-{
-    return Color(static_cast<unsigned char>(lerp(static_cast<float>(a.r), static_cast<float>(b.r), t)),
-                 static_cast<unsigned char>(lerp(static_cast<float>(a.g), static_cast<float>(b.g), t)),
-                 static_cast<unsigned char>(lerp(static_cast<float>(a.b), static_cast<float>(b.b), t)),
-                 static_cast<unsigned char>(lerp(static_cast<float>(a.a), static_cast<float>(b.a), t)));
-}
-
 //=============================================================================
 // Shape-based emission helpers
 //=============================================================================
 
 /**
  * @brief Sample a position on the edge of a circle
+ * @param u Uniform draw in [0, 1)
  * @param radius Circle radius
  * @return Position on circle edge and outward normal
  */
-static std::pair<Vec2, Vec2> sampleCircleEdge(float radius)
+static std::pair<Vec2, Vec2> sampleCircleEdge(float u, float radius)
 {
-    float angle = randomFloat(0.0f, 2.0f * 3.14159f);
+    float angle = uniformRange(u, 0.0f, 2.0f * 3.14159f);
     Vec2  position(std::cos(angle) * radius, std::sin(angle) * radius);
     Vec2  normal(std::cos(angle), std::sin(angle));  // Outward normal
     return {position, normal};
@@ -173,15 +65,16 @@ static std::pair<Vec2, Vec2> sampleCircleEdge(float radius)
 
 /**
  * @brief Sample a position on the edge of a rectangle
+ * @param u Uniform draw in [0, 1)
  * @param halfWidth Half-width of the rectangle
  * @param halfHeight Half-height of the rectangle
  * @return Position on rectangle edge and outward normal
  */
-static std::pair<Vec2, Vec2> sampleRectangleEdge(float halfWidth, float halfHeight)
+static std::pair<Vec2, Vec2> sampleRectangleEdge(float u, float halfWidth, float halfHeight)
 {
     // Calculate perimeter for uniform distribution
     float perimeter = 2.0f * (2.0f * halfWidth + 2.0f * halfHeight);
-    float t         = randomFloat(0.0f, perimeter);
+    float t         = uniformRange(u, 0.0f, perimeter);
 
     float topLength    = 2.0f * halfWidth;
     float rightLength  = 2.0f * halfHeight;
@@ -223,13 +116,14 @@ static std::pair<Vec2, Vec2> sampleRectangleEdge(float halfWidth, float halfHeig
 
 /**
  * @brief Sample a position along a line segment
+ * @param u Uniform draw in [0, 1)
  * @param start Start point of the line
  * @param end End point of the line
  * @return Position on line and perpendicular normal
  */
-static std::pair<Vec2, Vec2> sampleLine(const Vec2& start, const Vec2& end)
+static std::pair<Vec2, Vec2> sampleLine(float u, const Vec2& start, const Vec2& end)
 {
-    float t        = randomFloat(0.0f, 1.0f);
+    float t        = u;
     Vec2  position = lerp(start, end, t);
 
     // Calculate perpendicular normal (90 degrees rotated from line direction)
@@ -248,10 +142,11 @@ static std::pair<Vec2, Vec2> sampleLine(const Vec2& start, const Vec2& end)
 
 /**
  * @brief Sample a position on the edge of a polygon
+ * @param u Uniform draw in [0, 1)
  * @param vertices Polygon vertices (should form a closed shape)
  * @return Position on polygon edge and outward normal
  */
-static std::pair<Vec2, Vec2> samplePolygonEdge(const std::vector<Vec2>& vertices)
+static std::pair<Vec2, Vec2> samplePolygonEdge(float u, const std::vector<Vec2>& vertices)
 {
     if (vertices.size() < 2)
     {
@@ -280,7 +175,7 @@ static std::pair<Vec2, Vec2> samplePolygonEdge(const std::vector<Vec2>& vertices
     }
 
     // Random position along perimeter
-    float targetDist  = randomFloat(0.0f, totalPerimeter);
+    float targetDist  = uniformRange(u, 0.0f, totalPerimeter);
     float accumulated = 0.0f;
 
     for (size_t i = 0; i < numVertices; ++i)
@@ -318,11 +213,14 @@ static std::pair<Vec2, Vec2> samplePolygonEdge(const std::vector<Vec2>& vertices
 
 /**
  * @brief Get emission position and optional outward direction based on emission shape
+ * @param u Uniform draw in [0, 1) for the position along the shape
  * @param emitter The particle emitter component
  * @param entityRotation Rotation of the entity in radians
  * @return Local-space position offset and outward normal direction
  */
-static std::pair<Vec2, Vec2> getEmissionPositionAndNormal(const ::Components::CParticleEmitter* emitter, float entityRotation)
+static std::pair<Vec2, Vec2> getEmissionPositionAndNormal(float                                 u,
+                                                          const ::Components::CParticleEmitter* emitter,
+                                                          float                                 entityRotation)
 {
     Vec2 localPosition(0.0f, 0.0f);
     Vec2 outwardNormal(0.0f, 1.0f);
@@ -335,7 +233,7 @@ static std::pair<Vec2, Vec2> getEmissionPositionAndNormal(const ::Components::CP
 
         case ::Components::EmissionShape::Circle:
         {
-            auto [pos, normal] = sampleCircleEdge(emitter->getShapeRadius());
+            auto [pos, normal] = sampleCircleEdge(u, emitter->getShapeRadius());
             localPosition      = pos;
             outwardNormal      = normal;
             break;
@@ -344,7 +242,7 @@ static std::pair<Vec2, Vec2> getEmissionPositionAndNormal(const ::Components::CP
         case ::Components::EmissionShape::Rectangle:
         {
             Vec2 size          = emitter->getShapeSize();
-            auto [pos, normal] = sampleRectangleEdge(size.x / 2.0f, size.y / 2.0f);
+            auto [pos, normal] = sampleRectangleEdge(u, size.x / 2.0f, size.y / 2.0f);
             localPosition      = pos;
             outwardNormal      = normal;
             break;
@@ -352,7 +250,7 @@ static std::pair<Vec2, Vec2> getEmissionPositionAndNormal(const ::Components::CP
 
         case ::Components::EmissionShape::Line:
         {
-            auto [pos, normal] = sampleLine(emitter->getLineStart(), emitter->getLineEnd());
+            auto [pos, normal] = sampleLine(u, emitter->getLineStart(), emitter->getLineEnd());
             localPosition      = pos;
             outwardNormal      = normal;
             break;
@@ -363,7 +261,7 @@ static std::pair<Vec2, Vec2> getEmissionPositionAndNormal(const ::Components::CP
             const auto& vertices = emitter->getPolygonVertices();
             if (!vertices.empty())
             {
-                auto [pos, normal] = samplePolygonEdge(vertices);
+                auto [pos, normal] = samplePolygonEdge(u, vertices);
                 localPosition      = pos;
                 outwardNormal      = normal;
             }
@@ -410,24 +308,27 @@ static bool shouldEmitAtNormal(const Vec2& outwardNormal, const Vec2& velocity)
     return dot < 0.0f;
 }
 
-static ::Components::Particle spawnParticle(const ::Components::CParticleEmitter* emitter, const Vec2& worldPosition, float entityRotation)
+static ::Components::Particle spawnParticle(const float*                          u,
+                                            const ::Components::CParticleEmitter* emitter,
+                                            const Vec2&                           worldPosition,
+                                            float                                 entityRotation)
 {
+    const auto&            curves = emitter->getCurveTables();
     ::Components::Particle p;
-    p.alive = true;
-    p.age   = 0.0f;
+    p.age = 0.0f;
 
     // Get emission position and outward normal based on shape
-    auto [shapeOffset, outwardNormal] = getEmissionPositionAndNormal(emitter, entityRotation);
+    auto [shapeOffset, outwardNormal] = getEmissionPositionAndNormal(u[0], emitter, entityRotation);
 
     // Position: world position + shape-based offset
     p.position = Vec2(worldPosition.x + shapeOffset.x, worldPosition.y + shapeOffset.y);
 
     // Lifetime
-    p.lifetime = randomFloat(emitter->getMinLifetime(), emitter->getMaxLifetime());
+    p.lifetime = uniformRange(u[1], emitter->getMinLifetime(), emitter->getMaxLifetime());
 
-    // Size
-    p.size        = randomFloat(emitter->getMinSize(), emitter->getMaxSize());
-    p.initialSize = p.size;
+    // Size (the size curve scales the spawn size from birth on)
+    p.initialSize = uniformRange(u[2], emitter->getMinSize(), emitter->getMaxSize());
+    p.size        = curves.hasSize ? p.initialSize * curves.size.front() : p.initialSize;
 
     // Velocity (direction + spread + speed)
     Vec2 direction;
@@ -454,88 +355,218 @@ static ::Components::Particle spawnParticle(const ::Components::CParticleEmitter
     }
 
     float angle  = std::atan2(direction.y, direction.x);
-    float spread = randomFloat(-emitter->getSpreadAngle(), emitter->getSpreadAngle());
+    float spread = uniformRange(u[3], -emitter->getSpreadAngle(), emitter->getSpreadAngle());
     angle += spread;
 
-    float speed = randomFloat(emitter->getMinSpeed(), emitter->getMaxSpeed());
+    float speed = uniformRange(u[4], emitter->getMinSpeed(), emitter->getMaxSpeed());
     p.velocity  = Vec2(std::cos(angle) * speed, std::sin(angle) * speed);
 
     // Acceleration (gravity)
     p.acceleration = emitter->getGravity();
 
-    // Color and alpha
-    p.color = emitter->getStartColor();
-    p.alpha = emitter->getStartAlpha();
+    // Color and alpha (the curves' first samples when set)
+    p.color = curves.hasColor ? curves.color.front() : emitter->getStartColor();
+    p.alpha = curves.hasAlpha ? curves.alpha.front() : emitter->getStartAlpha();
 
     // Rotation
-    p.rotation      = randomFloat(0.0f, 2.0f * 3.14159f);
-    p.rotationSpeed = randomFloat(emitter->getMinRotationSpeed(), emitter->getMaxRotationSpeed());
+    p.rotation      = uniformRange(u[5], 0.0f, 2.0f * 3.14159f);
+    p.rotationSpeed = uniformRange(u[6], emitter->getMinRotationSpeed(), emitter->getMaxRotationSpeed());
 
     return p;
 }
 
-static void updateParticle(::Components::Particle& particle, const ::Components::CParticleEmitter* emitter, float deltaTime)
+static void emitParticles(::Components::CParticleEmitter* emitter,
+                          std::size_t                     count,
+                          const Vec2&                     worldPosition,
+                          float                           entityRotation)
 {
-    particle.age += deltaTime;
-
-    // Kill if lifetime exceeded
-    if (particle.age >= particle.lifetime)
+    // Clamp to the room left under the particle limit
+    auto&             particles = emitter->getParticles();
+    const std::size_t limit     = static_cast<std::size_t>(std::max(emitter->getMaxParticles(), 0));
+    if (particles.count() >= limit)
     {
-        particle.alive = false;
         return;
     }
+    count = std::min(count, limit - particles.count());
+
+    // Grow at most once for the whole batch (geometrically, capped at the limit);
+    // alive particles are the buffer's prefix, so spawns append
+    const std::size_t needed = particles.count() + count;
+    if (needed > particles.capacity())
+    {
+        particles.reserve(std::min(std::max(needed, particles.capacity() * 2), limit));
+    }
 
-    // Update physics
-    particle.velocity.x += particle.acceleration.x * deltaTime;
-    particle.velocity.y += particle.acceleration.y * deltaTime;
-    particle.position.x += particle.velocity.x * deltaTime;
-    particle.position.y += particle.velocity.y * deltaTime;
+    // Draws come from the emitter's own stream, generated kSpawnBatch particles at a time
+    float draws[kSpawnBatch * kSpawnDraws];
+    for (std::size_t first = 0; first < count; first += kSpawnBatch)
+    {
+        const std::size_t batch = std::min(kSpawnBatch, count - first);
+        emitter->getRandom().fill(draws, batch * kSpawnDraws);
+        for (std::size_t i = 0; i < batch; ++i)
+        {
+            particles.push(spawnParticle(&draws[i * kSpawnDraws], emitter, worldPosition, entityRotation));
+        }
+    }
+}
 
-    // Update rotation
-    particle.rotation += particle.rotationSpeed * deltaTime;
+/**
+ * @brief Default seed for an emitter's spawn stream
+ *
+ * A function of the system seed and the entity only, so results do not depend on
+ * which thread runs the emitter or on update order (splitmix64 finalizer).
+ */
+static std::uint64_t emitterSeed(std::uint64_t seed, Entity entity)
+{
+    const std::uint64_t key = (static_cast<std::uint64_t>(entity.generation) << 32) | entity.index;
 
-    // Interpolation factor (0 at birth, 1 at death)
-    float t = particle.age / particle.lifetime;
+    std::uint64_t z = seed ^ (key * 0x9E3779B97F4A7C15ull);
+    z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z               = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
 
-    // Color interpolation
-    particle.color = lerpColor(emitter->getStartColor(), emitter->getEndColor(), t);
+/**
+ * @brief Farthest a particle of this emitter can get from the emitter position
+ *
+ * Spawn shape extent plus one lifetime of travel at top speed under gravity, plus the
+ * particle size. Emitter movement after a particle spawned is not included.
+ */
+static float emitterReach(const ::Components::CParticleEmitter& emitter)
+{
+    using ::Components::EmissionShape;
 
-    // Alpha fade
-    if (emitter->getFadeOut())
+    float shape = 0.0f;
+    switch (emitter.getEmissionShape())
     {
-        particle.alpha = lerp(emitter->getStartAlpha(), emitter->getEndAlpha(), t);
+        case EmissionShape::Point:
+            break;
+        case EmissionShape::Circle:
+            shape = emitter.getShapeRadius();
+            break;
+        case EmissionShape::Rectangle:
+            shape = 0.5f * std::sqrt(emitter.getShapeSize().lengthSquared());
+            break;
+        case EmissionShape::Line:
+            shape = std::sqrt(std::max(emitter.getLineStart().lengthSquared(), emitter.getLineEnd().lengthSquared()));
+            break;
+        case EmissionShape::Polygon:
+            for (const Vec2& vertex : emitter.getPolygonVertices())
+            {
+                shape = std::max(shape, std::sqrt(vertex.lengthSquared()));
+            }
+            break;
     }
 
-    // Size shrink
-    if (emitter->getShrink())
+    const auto& curves    = emitter.getCurveTables();
+    float       speed     = std::max(std::fabs(emitter.getMinSpeed()), std::fabs(emitter.getMaxSpeed()));
+    float       sizeScale = 1.0f;
+    if (curves.hasSpeed)
+    {
+        speed *= *std::max_element(curves.speed.begin(), curves.speed.end());
+    }
+    if (curves.hasSize)
     {
-        particle.size = particle.initialSize * lerp(1.0f, emitter->getShrinkEndScale(), t);
+        sizeScale = std::max(sizeScale, *std::max_element(curves.size.begin(), curves.size.end()));
     }
+
+    const float lifetime = std::max(emitter.getMaxLifetime(), 0.0f);
+    const float gravity  = std::sqrt(emitter.getGravity().lengthSquared());
+    return std::fabs(shape) + speed * lifetime + 0.5f * gravity * lifetime * lifetime
+           + emitter.getMaxSize() * sizeScale;
 }
 
-static void emitParticle(::Components::CParticleEmitter* emitter, const Vec2& worldPosition, float entityRotation)
+/// Runs task(i) for i in [0, count) on the pool, or inline when there is none
+static void forEachTask(Internal::ThreadPool* pool, std::size_t count, const std::function<void(std::size_t)>& task)
 {
-    // Check particle limit
-    if (emitter->getAliveCount() >= static_cast<size_t>(emitter->getMaxParticles()))
+    if (pool)
     {
+        pool->parallelFor(count, task);
         return;
     }
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        task(i);
+    }
+}
+
+/// Vertices per particle quad (two triangles)
+static constexpr std::size_t kVerticesPerParticle = 6;
 
-    // Find dead particle to reuse or add new one
-    auto& particles = emitter->getParticles();
-    auto it = std::find_if(particles.begin(), particles.end(), [](const ::Components::Particle& p) { return !p.alive; });
-    if (it != particles.end())
+/**
+ * @brief Writes the quads for particles [begin, end) to out
+ *
+ * Quads are in world space (meters); the active sf::View handles world->screen mapping.
+ * Without a texture the quad is white, so a missing texture still shows something.
+ */
+static void writeParticleVertices(const ::Components::ParticleBuffer& particles,
+                                  std::size_t                         begin,
+                                  std::size_t                         end,
+                                  const sf::Texture*                  texture,
+                                  sf::Vertex*                         out)
+{
+    // Texture coordinates are in pixels for SFML; untextured quads keep them at zero.
+    sf::Vector2f texSize;
+    if (texture)
     {
-        *it = spawnParticle(emitter, worldPosition, entityRotation);
-        return;
+        const sf::Vector2u size = texture->getSize();
+        texSize                 = sf::Vector2f(static_cast<float>(size.x), static_cast<float>(size.y));
     }
+    const sf::Vector2f texCoords[4] = {
+        sf::Vector2f(0.0f, 0.0f), sf::Vector2f(texSize.x, 0.0f), texSize, sf::Vector2f(0.0f, texSize.y)};
+
+    // Two triangles: (0,1,2) and (0,2,3); corners run top-left, top-right, bottom-right, bottom-left
+    static constexpr int kQuadCorners[kVerticesPerParticle] = {0, 1, 2, 0, 2, 3};
 
-    // No dead particles, add new one
-    emitter->getParticles().push_back(spawnParticle(emitter, worldPosition, entityRotation));
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const float half = particles.size[i];
+        const float cosR = std::cos(particles.rotation[i]);
+        const float sinR = std::sin(particles.rotation[i]);
+
+        const sf::Vector2f center(particles.positionX[i], particles.positionY[i]);
+        const sf::Vector2f local[4] = {sf::Vector2f(-half, -half),
+                                       sf::Vector2f(half, -half),
+                                       sf::Vector2f(half, half),
+                                       sf::Vector2f(-half, half)};
+        sf::Vector2f       corners[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            corners[c] = sf::Vector2f(local[c].x * cosR - local[c].y * sinR + center.x,
+                                      local[c].x * sinR + local[c].y * cosR + center.y);
+        }
+
+        const float     clampedAlpha = std::clamp(particles.alpha[i], 0.0f, 1.0f);
+        const auto      alphaByte    = static_cast<std::uint8_t>(clampedAlpha * 255.0f);
+        const Color&    tint         = particles.color[i];
+        const sf::Color color        = texture ? sf::Color(tint.r, tint.g, tint.b, alphaByte)
+                                               : sf::Color(255, 255, 255, alphaByte);
+
+        for (int corner : kQuadCorners)
+        {
+            out->position  = corners[corner];
+            out->color     = color;
+            out->texCoords = texCoords[corner];
+            ++out;
+        }
+    }
 }
 
+struct SParticle::CollisionScratch
+{
+    std::vector<S2DPhysics::SegmentCast> segments;
+    std::vector<S2DPhysics::SegmentHit>  hits;
+    std::vector<std::size_t>             indices;  ///< Particle index of each segment
+};
+
 SParticle::SParticle()
-    : m_vertexArray(sf::PrimitiveType::Triangles), m_window(nullptr), m_pixelsPerMeter(100.0f), m_initialized(false)
+    : m_vertexArray(sf::PrimitiveType::Triangles),
+      m_target(nullptr),
+      m_pixelsPerMeter(100.0f),
+      m_initialized(false),
+      m_threadPool(std::make_unique<Internal::ThreadPool>()),
+      m_seed((static_cast<std::uint64_t>(std::random_device{}()) << 32) | std::random_device{}()),
+      m_collision(std::make_unique<CollisionScratch>())
 {
 }
 
@@ -544,9 +575,9 @@ SParticle::~SParticle()
     shutdown();
 }
 
-bool SParticle::initialize(sf::RenderWindow* window, float pixelsPerMeter)
+bool SParticle::initialize(sf::RenderTarget* target, float pixelsPerMeter)
 {
-    m_window         = window;
+    m_target         = target;
     m_pixelsPerMeter = pixelsPerMeter;
     m_initialized    = true;
     LOG_INFO("SParticle: Initialized with pixelsPerMeter={}", pixelsPerMeter);
@@ -556,7 +587,7 @@ bool SParticle::initialize(sf::RenderWindow* window, float pixelsPerMeter)
 void SParticle::shutdown()
 {
     m_initialized = false;
-    m_window      = nullptr;
+    m_target      = nullptr;
     LOG_INFO("SParticle: Shutdown complete");
 }
 
@@ -567,8 +598,13 @@ void SParticle::update(float deltaTime, World& world)
         return;
     }
 
+    gatherCameras(world);
+
+    // Gather active emitters here; the parallel passes below only touch emitter data.
+    m_jobs.clear();
+    m_culledEmitters = 0;
     world.components().view2<::Components::CParticleEmitter, ::Components::CTransform>(
-        [deltaTime](Entity /*entity*/, ::Components::CParticleEmitter& emitter, ::Components::CTransform& transform)
+        [this, deltaTime](Entity entity, ::Components::CParticleEmitter& emitter, ::Components::CTransform& transform)
         {
             if (!emitter.isActive())
             {
@@ -588,242 +624,435 @@ void SParticle::update(float deltaTime, World& world)
                 offset         = Vec2(rotatedX, rotatedY);
             }
 
-            Vec2 worldPos = entityPos + offset;
+            if (!emitter.hasRandomSeed())
+            {
+                emitter.setRandomSeed(emitterSeed(m_seed, entity));
+            }
 
-            for (auto& particle : emitter.getParticles())
+            EmitterJob job;
+            job.entity                = entity;
+            job.emitter               = &emitter;
+            job.worldPosition         = entityPos + offset;
+            job.rotation              = rotation;
+            job.params.deltaTime      = deltaTime;
+            job.params.startColor     = emitter.getStartColor();
+            job.params.endColor       = emitter.getEndColor();
+            job.params.startAlpha     = emitter.getStartAlpha();
+            job.params.endAlpha       = emitter.getEndAlpha();
+            job.params.shrinkEndScale = emitter.getShrinkEndScale();
+            job.params.fadeOut        = emitter.getFadeOut();
+            job.params.shrink         = emitter.getShrink();
+            job.params.curves         = emitter.getCurveTables().any() ? &emitter.getCurveTables() : nullptr;
+
+            // Visibility, and distance (in view heights) to the nearest camera that could draw the emitter
+            bool  seen     = m_cameras.empty();
+            float distance = m_cameras.empty() ? 0.0f : std::numeric_limits<float>::max();
+            if (!m_cameras.empty())
             {
-                if (particle.alive)
+                const float reach = emitterReach(emitter);
+                for (const CameraBounds& camera : m_cameras)
                 {
-                    updateParticle(particle, &emitter, deltaTime);
+                    if ((camera.cullingMask & emitter.getRenderLayers()) == 0)
+                    {
+                        continue;
+                    }
+                    const float dx = std::fabs(job.worldPosition.x - camera.center.x);
+                    const float dy = std::fabs(job.worldPosition.y - camera.center.y);
+                    seen = seen || (dx <= camera.halfExtents.x + reach && dy <= camera.halfExtents.y + reach);
+                    distance = std::min(distance, std::sqrt(dx * dx + dy * dy) / camera.viewHeight);
                 }
             }
+            job.visible = seen || !m_cullingEnabled;
+            job.weight  = emitter.getImportance() / (1.0f + distance);
 
-            if (emitter.getEmissionRate() > 0.0f)
+            // Spawns due this step; off-screen emitters neither emit nor keep queued bursts.
+            if (job.visible)
             {
-                float timer            = emitter.getEmissionTimer() + deltaTime;
-                float emissionInterval = 1.0f / emitter.getEmissionRate();
-
-                while (timer >= emissionInterval)
+                job.spawns = static_cast<std::size_t>(emitter.getPendingBurst());
+                if (emitter.getEmissionRate() > 0.0f)
                 {
-                    emitParticle(&emitter, worldPos, rotation);
-                    timer -= emissionInterval;
+                    float timer            = emitter.getEmissionTimer() + deltaTime;
+                    float emissionInterval = 1.0f / emitter.getEmissionRate();
+
+                    // Every spawn due this step goes out in the same batch as any burst
+                    const auto due = static_cast<std::size_t>(timer / emissionInterval);
+                    job.spawns += due;
+                    timer -= static_cast<float>(due) * emissionInterval;
+                    emitter.setEmissionTimer(timer);
                 }
-                emitter.setEmissionTimer(timer);
             }
-        });
-}
-
-void SParticle::renderEmitter(Entity entity, sf::RenderWindow* window, World& world)
-{
-    static uint64_t s_renderEmitterFrameIndex = 0;
+            else
+            {
+                ++m_culledEmitters;
+            }
+            emitter.clearPendingBurst();
 
-    sf::RenderWindow* targetWindow = window ? window : m_window;
+            m_jobs.push_back(job);
+        });
 
-    if (m_initialized == false || targetWindow == nullptr || !targetWindow->isOpen() || !entity.isValid())
+    // Large emitters are split into ranges so a single big emitter still spreads across the pool.
+    m_ranges.clear();
+    std::size_t totalParticles = 0;
+    for (std::size_t j = 0; j < m_jobs.size(); ++j)
     {
-        return;
+        const std::size_t count = m_jobs[j].emitter->getParticles().count();
+        totalParticles += count;
+        for (std::size_t begin = 0; begin < count; begin += kParallelRangeSize)
+        {
+            m_ranges.push_back(ParticleRange{j, begin, std::min(count, begin + kParallelRangeSize)});
+        }
     }
 
-    if (s_renderEmitterFrameIndex < 3)
+    // Waking the workers costs more than small scenes take to simulate.
+    Internal::ThreadPool* pool = totalParticles >= kMinParallelParticles ? m_threadPool.get() : nullptr;
+
+    forEachTask(pool,
+                m_ranges.size(),
+                [this](std::size_t r)
+                {
+                    const ParticleRange& range = m_ranges[r];
+                    const EmitterJob&    job   = m_jobs[range.job];
+                    if (job.visible)
+                    {
+                        integrateParticles(job.emitter->getParticles(), range.begin, range.end, job.params);
+                    }
+                    else
+                    {
+                        ageParticles(job.emitter->getParticles(), range.begin, range.end, job.params.deltaTime);
+                    }
+                });
+
+    // Physics queries stay on this thread (see setPhysics()); off-screen emitters did not move.
+    if (m_physics)
     {
-        LOG_INFO("Frame {}: SParticle::renderEmitter begin E{}:G{}", s_renderEmitterFrameIndex, entity.index, entity.generation);
+        for (const EmitterJob& job : m_jobs)
+        {
+            if (job.visible && job.emitter->getCollisionMode() != ::Components::ParticleCollision::None)
+            {
+                collideParticles(job);
+            }
+        }
     }
+    ++m_updateIndex;
 
-    auto* emitter = world.components().tryGet<::Components::CParticleEmitter>(entity);
-    if (!emitter)
+    forEachTask(pool, m_jobs.size(), [this](std::size_t j) { m_jobs[j].emitter->getParticles().removeExpired(); });
+
+    // The budget needs every emitter's survivors, so it sits between compaction and spawning.
+    applyBudget();
+
+    // Spawning is per emitter. Each emitter samples from its own stream, so results do not
+    // depend on thread scheduling.
+    forEachTask(pool,
+                m_jobs.size(),
+                [this](std::size_t j)
+                {
+                    const EmitterJob& job = m_jobs[j];
+                    if (job.spawns > 0)
+                    {
+                        emitParticles(job.emitter, job.spawns, job.worldPosition, job.rotation);
+                    }
+                });
+}
+
+void SParticle::collideParticles(const EmitterJob& job)
+{
+    ::Components::CParticleEmitter& emitter   = *job.emitter;
+    ::Components::ParticleBuffer&   particles = emitter.getParticles();
+    const std::size_t               count     = particles.count();
+    if (count == 0)
     {
         return;
     }
 
-    if (s_renderEmitterFrameIndex < 3)
-    {
-        LOG_INFO("Frame {}: SParticle::renderEmitter got emitter (particles={}, alive={}, texturePath='{}')",
-                 s_renderEmitterFrameIndex,
-                 emitter->getParticles().size(),
-                 emitter->getAliveCount(),
-                 emitter->getTexturePath());
-        LOG_INFO("Frame {}: SParticle::renderEmitter loadTexture begin", s_renderEmitterFrameIndex);
-    }
+    // Large emitters test every stride-th particle, starting one further along each update;
+    // a tested particle's segment reaches back over the updates since its last test.
+    const std::size_t stride = (count + kMaxCollisionTestsPerEmitter - 1) / kMaxCollisionTestsPerEmitter;
+    const float       span   = job.params.deltaTime * static_cast<float>(stride);
 
-    // Cache-only in the hot render path: if missing, queue it and draw fallback.
-    const std::string& texturePath = emitter->getTexturePath();
-    const sf::Texture* texture     = nullptr;
-    if (!texturePath.empty())
+    CollisionScratch& scratch = *m_collision;
+    scratch.segments.clear();
+    scratch.indices.clear();
+    for (std::size_t i = static_cast<std::size_t>(m_updateIndex % stride); i < count; i += stride)
     {
-        const std::filesystem::path resolvedPath = Internal::ExecutablePaths::resolveRelativeToExecutableDir(texturePath);
-        const std::string resolvedStr = resolvedPath.string();
-        texture                       = getCachedTexture(resolvedStr);
-        if (!texture)
+        const float dx = particles.velocityX[i] * span;
+        const float dy = particles.velocityY[i] * span;
+        if (dx == 0.0f && dy == 0.0f)
         {
-            requestTextureLoad(texturePath);
+            continue;  // Resting or stuck
         }
+        const b2Vec2 origin{particles.positionX[i] - dx, particles.positionY[i] - dy};
+        scratch.segments.push_back(S2DPhysics::SegmentCast{origin, b2Vec2{dx, dy}});
+        scratch.indices.push_back(i);
     }
-
-    if (s_renderEmitterFrameIndex < 3)
+    if (scratch.segments.empty())
     {
-        LOG_INFO("Frame {}: SParticle::renderEmitter loadTexture end (texture={})", s_renderEmitterFrameIndex, texture ? "yes" : "no");
+        return;
     }
 
-    // Clear vertex array for this emitter
-    m_vertexArray.clear();
+    scratch.hits.resize(scratch.segments.size());
+    const b2QueryFilter filter{emitter.getCollisionCategory(), emitter.getCollisionMask()};
+    m_physics->castSegments(scratch.segments.data(), scratch.segments.size(), filter, scratch.hits.data());
 
-    // Build vertex array for all alive particles
-    for (const auto& particle : emitter->getParticles())
+    const ::Components::ParticleCollision mode        = emitter.getCollisionMode();
+    const float                           restitution = emitter.getCollisionRestitution();
+    const float                           keepTangent = 1.0f - emitter.getCollisionFriction();
+    for (std::size_t k = 0; k < scratch.hits.size(); ++k)
     {
-        if (particle.alive == false)
+        const S2DPhysics::SegmentHit& hit = scratch.hits[k];
+        if (!hit.hit)
         {
             continue;
         }
 
-        if (s_renderEmitterFrameIndex < 3)
+        const std::size_t i = scratch.indices[k];
+        if (mode == ::Components::ParticleCollision::Die)
         {
-            // Throttle: only log a small sample of alive particles
-            static uint32_t s_loggedAliveParticles = 0;
-            if (s_loggedAliveParticles < 8)
-            {
-                LOG_INFO("Frame {}: SParticle alive particle sample pos=({}, {}) size={} rot={} alpha={}",
-                         s_renderEmitterFrameIndex,
-                         particle.position.x,
-                         particle.position.y,
-                         particle.size,
-                         particle.rotation,
-                         particle.alpha);
-                ++s_loggedAliveParticles;
-            }
+            particles.age[i] = particles.lifetime[i];  // Removed by the compaction that follows
+            continue;
+        }
+
+        particles.positionX[i] = hit.point.x + hit.normal.x * kCollisionSkin;
+        particles.positionY[i] = hit.point.y + hit.normal.y * kCollisionSkin;
+
+        if (mode == ::Components::ParticleCollision::Stick)
+        {
+            particles.velocityX[i]     = 0.0f;
+            particles.velocityY[i]     = 0.0f;
+            particles.accelerationX[i] = 0.0f;
+            particles.accelerationY[i] = 0.0f;
+            particles.rotationSpeed[i] = 0.0f;
+            continue;
+        }
+
+        // Bounce: reflect the normal part of the velocity, damp the tangential part.
+        const float vx = particles.velocityX[i];
+        const float vy = particles.velocityY[i];
+        const float vn = vx * hit.normal.x + vy * hit.normal.y;
+        if (vn < 0.0f)
+        {
+            const float tx         = vx - vn * hit.normal.x;
+            const float ty         = vy - vn * hit.normal.y;
+            particles.velocityX[i] = tx * keepTangent - vn * restitution * hit.normal.x;
+            particles.velocityY[i] = ty * keepTangent - vn * restitution * hit.normal.y;
         }
+    }
+}
 
-        // Render in world space (meters). The active sf::View handles world->screen mapping.
-        sf::Vector2f worldPos(static_cast<float>(particle.position.x), static_cast<float>(particle.position.y));
-        float        halfSizeWorld = particle.size;
+void SParticle::gatherCameras(World& world)
+{
+    m_cameras.clear();
 
-        // Create color with alpha
-        const float clampedAlpha = std::clamp(particle.alpha, 0.0f, 1.0f);
-        const auto  alphaByte    = static_cast<std::uint8_t>(clampedAlpha * 255.0f);
-        // If a texture is missing/unavailable, fall back to a visible white quad.
-        sf::Color color = texture ? sf::Color(particle.color.r, particle.color.g, particle.color.b, alphaByte)
-                                  : sf::Color(255, 255, 255, alphaByte);
+    float targetAspect = kFallbackAspect;
+    if (m_target)
+    {
+        const sf::Vector2u size = m_target->getSize();
+        if (size.x > 0 && size.y > 0)
+        {
+            targetAspect = static_cast<float>(size.x) / static_cast<float>(size.y);
+        }
+    }
 
-        if (texture)
+    // Mirrors Internal::buildViewFromCamera(), boxed around the camera rotation.
+    world.components().view<::Components::CCamera>(
+        [this, targetAspect](Entity, ::Components::CCamera& camera)
         {
-            // Textured quad
-            float cosR = std::cos(particle.rotation);
-            float sinR = std::sin(particle.rotation);
-
-            // Quad corners (centered)
-            sf::Vector2f corners[4] = {
-                sf::Vector2f(-halfSizeWorld, -halfSizeWorld),  // Top-left
-                sf::Vector2f(halfSizeWorld, -halfSizeWorld),   // Top-right
-                sf::Vector2f(halfSizeWorld, halfSizeWorld),    // Bottom-right
-                sf::Vector2f(-halfSizeWorld, halfSizeWorld)    // Bottom-left
-            };
-
-            // Rotate corners
-            for (int i = 0; i < 4; ++i)
+            if (!camera.enabled || !camera.render)
             {
-                float x      = corners[i].x;
-                float y      = corners[i].y;
-                corners[i].x = x * cosR - y * sinR;
-                corners[i].y = x * sinR + y * cosR;
-                corners[i] += worldPos;
+                return;
             }
 
-            // Texture coordinates (in pixels for SFML - confirmed by official docs)
-            sf::Vector2u       texSize      = texture->getSize();
-            const sf::Vector2f texCoords[4] = {
-                sf::Vector2f(0.0f, 0.0f),                                                    // Top-left
-                sf::Vector2f(static_cast<float>(texSize.x), 0.0f),                           // Top-right
-                sf::Vector2f(static_cast<float>(texSize.x), static_cast<float>(texSize.y)),  // Bottom-right
-                sf::Vector2f(0.0f, static_cast<float>(texSize.y))                            // Bottom-left
-            };
+            const auto& viewport = camera.viewport;
+            const float zoom     = camera.zoom > 0.0f ? camera.zoom : 1.0f;
+            const float height   = camera.worldHeight / zoom;
+            const float aspect   = viewport.height > 0.0f ? targetAspect * viewport.width / viewport.height
+                                                      : targetAspect;
+            const float width    = height * aspect;
+            const float cosR     = std::fabs(std::cos(camera.rotationRadians));
+            const float sinR     = std::fabs(std::sin(camera.rotationRadians));
+
+            CameraBounds bounds;
+            bounds.center      = camera.position;
+            bounds.halfExtents = Vec2(0.5f * (cosR * width + sinR * height), 0.5f * (sinR * width + cosR * height));
+            bounds.viewHeight  = height > 0.0f ? height : 1.0f;
+            bounds.cullingMask = camera.cullingMask;
+            m_cameras.push_back(bounds);
+        });
+}
 
-            auto appendTextured = [&](int idx)
-            {
-                sf::Vertex v;
-                v.position  = corners[idx];
-                v.color     = color;
-                v.texCoords = texCoords[idx];
-                m_vertexArray.append(v);
-            };
-
-            // Two triangles: (0,1,2) and (0,2,3)
-            appendTextured(0);
-            appendTextured(1);
-            appendTextured(2);
-            appendTextured(0);
-            appendTextured(2);
-            appendTextured(3);
+void SParticle::applyBudget()
+{
+    if (m_particleBudget == kUnlimitedParticles)
+    {
+        return;
+    }
+
+    std::size_t alive     = 0;
+    std::size_t requested = 0;
+    double      weighted  = 0.0;
+    for (const EmitterJob& job : m_jobs)
+    {
+        alive += job.emitter->getParticles().count();
+        requested += job.spawns;
+        weighted += static_cast<double>(job.weight) * static_cast<double>(job.spawns);
+    }
+
+    const std::size_t room = m_particleBudget > alive ? m_particleBudget - alive : 0;
+    if (requested <= room)
+    {
+        return;
+    }
+
+    // Each emitter keeps room * weight / weighted of every requested spawn (never more than all of
+    // them). The fraction is rounded with the emitter's own stream, so low-rate emitters still
+    // emit now and then instead of always rounding down to nothing; the running total keeps the
+    // rounding from overshooting the room.
+    std::size_t granted = 0;
+    for (EmitterJob& job : m_jobs)
+    {
+        if (job.spawns == 0)
+        {
+            continue;
         }
-        else
+
+        const double share   = weighted > 0.0 ? static_cast<double>(room) * job.weight / weighted : 0.0;
+        const double allowed = static_cast<double>(job.spawns) * std::min(share, 1.0);
+        auto         spawns  = static_cast<std::size_t>(allowed);
+        if (job.emitter->getRandom().nextFloat() < static_cast<float>(allowed - static_cast<double>(spawns)))
         {
-            // Colored quad (no texture)
-            float cosR = std::cos(particle.rotation);
-            float sinR = std::sin(particle.rotation);
+            ++spawns;
+        }
 
-            sf::Vector2f corners[4] = {sf::Vector2f(-halfSizeWorld, -halfSizeWorld),
-                                       sf::Vector2f(halfSizeWorld, -halfSizeWorld),
-                                       sf::Vector2f(halfSizeWorld, halfSizeWorld),
-                                       sf::Vector2f(-halfSizeWorld, halfSizeWorld)};
+        job.spawns = std::min(spawns, room - granted);
+        granted += job.spawns;
+    }
+}
 
-            for (int i = 0; i < 4; ++i)
-            {
-                float x      = corners[i].x;
-                float y      = corners[i].y;
-                corners[i].x = x * cosR - y * sinR;
-                corners[i].y = x * sinR + y * cosR;
-                corners[i] += worldPos;
-            }
+void SParticle::setSeed(std::uint64_t seed)
+{
+    m_seed = seed;
+}
 
-            auto appendColored = [&](int idx)
-            {
-                sf::Vertex v;
-                v.position = corners[idx];
-                v.color    = color;
-                m_vertexArray.append(v);
-            };
-
-            // Two triangles: (0,1,2) and (0,2,3)
-            appendColored(0);
-            appendColored(1);
-            appendColored(2);
-            appendColored(0);
-            appendColored(2);
-            appendColored(3);
-        }
+void SParticle::setWorkerCount(std::size_t workerCount)
+{
+    m_threadPool = std::make_unique<Internal::ThreadPool>(workerCount);
+}
+
+void SParticle::renderEmitter(Entity entity, sf::RenderTarget* target, World& world, RenderStats* stats)
+{
+    renderEmitters(&entity, 1, target, world, stats);
+}
+
+void SParticle::renderEmitters(const Entity*     entities,
+                               std::size_t       count,
+                               sf::RenderTarget* target,
+                               World&            world,
+                               RenderStats*      stats)
+{
+    static uint64_t s_renderEmittersFrameIndex = 0;
+
+    sf::RenderTarget* renderTarget = target ? target : m_target;
+
+    if (m_initialized == false || renderTarget == nullptr || count == 0)
+    {
+        return;
     }
 
-    // Render particles for this emitter
-    if (m_vertexArray.getVertexCount() > 0)
+    // Resolve textures and preassign each emitter its slice of the shared vertex array. This
+    // part stays on the render thread: the texture loader is not thread-safe.
+    auto components = world.components();
+    m_drawEmitters.clear();
+    m_vertexRanges.clear();
+    std::size_t vertexCount = 0;
+    for (std::size_t e = 0; e < count; ++e)
     {
-        sf::RenderStates states;
-        states.blendMode = sf::BlendAlpha;
+        auto* emitter = entities[e].isValid() ? components.tryGet<::Components::CParticleEmitter>(entities[e])
+                                              : nullptr;
+        if (!emitter || emitter->getParticles().empty())
+        {
+            continue;
+        }
 
-        if (texture)
+        // Cache-only in the hot render path: if missing, the loader queues it and we draw the fallback.
+        const sf::Texture* texture = nullptr;
+        if (m_textureLoader && !emitter->getTexturePath().empty())
         {
-            states.texture = texture;
+            if (emitter->getTextureHandle() == kInvalidAssetHandle)
+            {
+                emitter->setTextureHandle(m_textureLoader->resolve(emitter->getTexturePath()));
+            }
+            texture = m_textureLoader->get(emitter->getTextureHandle());
         }
 
-        if (s_renderEmitterFrameIndex < 3)
+        const std::size_t alive = emitter->getParticles().count();
+        for (std::size_t begin = 0; begin < alive; begin += kParallelRangeSize)
         {
-            LOG_INFO("Frame {}: SParticle::renderEmitter draw begin (verts={}, textured={})",
-                     s_renderEmitterFrameIndex,
-                     m_vertexArray.getVertexCount(),
-                     texture ? "yes" : "no");
+            const std::size_t end = std::min(alive, begin + kParallelRangeSize);
+            m_vertexRanges.push_back(ParticleRange{m_drawEmitters.size(), begin, end});
         }
+        m_drawEmitters.push_back(DrawEmitter{&emitter->getParticles(), texture, vertexCount});
+        vertexCount += alive * kVerticesPerParticle;
+    }
 
-        targetWindow->draw(m_vertexArray, states);
+    if (vertexCount == 0)
+    {
+        return;
+    }
 
-        if (s_renderEmitterFrameIndex < 3)
+    // Each range writes only its own vertices, so ranges fill in parallel.
+    m_vertexArray.resize(vertexCount);
+    const bool            parallel = vertexCount / kVerticesPerParticle >= kMinParallelParticles;
+    Internal::ThreadPool* pool     = parallel ? m_threadPool.get() : nullptr;
+    forEachTask(pool,
+                m_vertexRanges.size(),
+                [this](std::size_t r)
+                {
+                    const ParticleRange& range   = m_vertexRanges[r];
+                    const DrawEmitter&   emitter = m_drawEmitters[range.job];
+                    writeParticleVertices(*emitter.particles,
+                                          range.begin,
+                                          range.end,
+                                          emitter.texture,
+                                          &m_vertexArray[emitter.firstVertex + range.begin * kVerticesPerParticle]);
+                });
+
+    // Vertices are in emitter order, so consecutive emitters sharing a texture draw together
+    // without changing how their particles overlap.
+    sf::RenderStates states;
+    states.blendMode = sf::BlendAlpha;
+
+    std::size_t draws = 0;
+    for (std::size_t run = 0; run < m_drawEmitters.size();)
+    {
+        std::size_t runEnd = run + 1;
+        while (runEnd < m_drawEmitters.size() && m_drawEmitters[runEnd].texture == m_drawEmitters[run].texture)
+        {
+            ++runEnd;
+        }
+
+        const std::size_t first = m_drawEmitters[run].firstVertex;
+        const std::size_t last  = runEnd < m_drawEmitters.size() ? m_drawEmitters[runEnd].firstVertex : vertexCount;
+        states.texture          = m_drawEmitters[run].texture;
+        renderTarget->draw(&m_vertexArray[first], last - first, sf::PrimitiveType::Triangles, states);
+        ++draws;
+
+        if (stats)
         {
-            LOG_INFO("Frame {}: SParticle::renderEmitter draw end", s_renderEmitterFrameIndex);
+            stats->recordDraw(states.texture, nullptr, last - first);
+            stats->particleEmitters += runEnd - run;
+            stats->particles += (last - first) / kVerticesPerParticle;
         }
+        run = runEnd;
     }
 
-    if (s_renderEmitterFrameIndex < 3)
+    if (s_renderEmittersFrameIndex < 3)
     {
-        LOG_INFO("Frame {}: SParticle::renderEmitter end E{}:G{}", s_renderEmitterFrameIndex, entity.index, entity.generation);
+        LOG_INFO("Frame {}: SParticle::renderEmitters drew {} emitters ({} verts) in {} draws",
+                 s_renderEmittersFrameIndex,
+                 m_drawEmitters.size(),
+                 vertexCount,
+                 draws);
     }
-
-    ++s_renderEmitterFrameIndex;
+    ++s_renderEmittersFrameIndex;
 }
 
 }  // namespace Systems
@@ -1,11 +1,13 @@
 #include "SRenderer.h"
-#include <SFML/Window/Context.hpp>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <iomanip>
+#include <limits>
 #include <sstream>
-#include <unordered_set>
 #include <vector>
 #include "CCamera.h"
 #include "CCollider2D.h"
@@ -14,12 +16,12 @@
 #include "CRenderable.h"
 #include "CShader.h"
 #include "CTexture.h"
+#include "CTilemap.h"
 #include "CTransform.h"
 #include "CameraView.h"
 #include "ExecutablePaths.h"
 #include "FileUtilities.h"
 #include "Logger.h"
-#include "SFMLResourceLoader.h"
 #include "SParticle.h"
 #include "World.h"
 
@@ -31,6 +33,142 @@ static sf::Color toSFMLColor(const Color& c)
     return sf::Color(c.r, c.g, c.b, c.a);
 }
 
+// splitmix64 finalizer: spreads fingerprints before they are summed into a layer fingerprint.
+static std::uint64_t mixFingerprint(std::uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+}
+
+// FNV-1a over the bytes of a trivially copyable value.
+template <typename T>
+static void hashField(std::uint64_t& hash, const T& value)
+{
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    for (unsigned char byte : bytes)
+    {
+        hash ^= byte;
+        hash *= 1099511628211ull;
+    }
+}
+
+static void uploadMaterialUniform(sf::Shader& shader, const ::Components::MaterialUniform& uniform)
+{
+    switch (uniform.type)
+    {
+        case ::Components::UniformType::Float:
+            shader.setUniform(uniform.name, uniform.x);
+            break;
+        case ::Components::UniformType::Vec2:
+            shader.setUniform(uniform.name, sf::Glsl::Vec2(uniform.x, uniform.y));
+            break;
+        case ::Components::UniformType::Color:
+            shader.setUniform(uniform.name, sf::Glsl::Vec4(uniform.x, uniform.y, uniform.z, uniform.w));
+            break;
+    }
+}
+
+// Axis-aligned bounds of a collider's fixtures in body-local space; false if it has no fixtures.
+static bool colliderLocalBounds(const ::Components::CCollider2D& collider, sf::Vector2f& min, sf::Vector2f& max)
+{
+    if (collider.fixtures.empty())
+    {
+        return false;
+    }
+
+    min = sf::Vector2f{std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()};
+    max = -min;
+
+    auto includePoint = [&](const Vec2& p)
+    {
+        min.x = std::min(min.x, p.x);
+        min.y = std::min(min.y, p.y);
+        max.x = std::max(max.x, p.x);
+        max.y = std::max(max.y, p.y);
+    };
+
+    for (const auto& f : collider.fixtures)
+    {
+        switch (f.shapeType)
+        {
+            case ::Components::ColliderShape::Circle:
+            {
+                const Vec2  c = f.circle.center;
+                const float r = f.circle.radius;
+                includePoint(Vec2{c.x - r, c.y - r});
+                includePoint(Vec2{c.x + r, c.y + r});
+                break;
+            }
+            case ::Components::ColliderShape::Box:
+            {
+                const float hw = f.box.halfWidth;
+                const float hh = f.box.halfHeight;
+                includePoint(Vec2{-hw, -hh});
+                includePoint(Vec2{hw, hh});
+                break;
+            }
+            case ::Components::ColliderShape::Polygon:
+            {
+                for (const auto& v : f.polygon.vertices)
+                {
+                    includePoint(v);
+                }
+                break;
+            }
+            case ::Components::ColliderShape::Segment:
+            {
+                includePoint(f.segment.point1);
+                includePoint(f.segment.point2);
+                break;
+            }
+            case ::Components::ColliderShape::ChainSegment:
+            {
+                includePoint(f.chainSegment.ghost1);
+                includePoint(f.chainSegment.point1);
+                includePoint(f.chainSegment.point2);
+                includePoint(f.chainSegment.ghost2);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+// Pixel region of a texture an entity draws: CTexture::textureRect, or the whole texture if it is unset.
+static sf::FloatRect textureRegion(const sf::Texture& texture, const ::Components::CTexture* textureComp)
+{
+    if (textureComp && !textureComp->textureRect.isEmpty())
+    {
+        const ::Components::TextureRect& rect = textureComp->textureRect;
+        return sf::FloatRect({static_cast<float>(rect.left), static_cast<float>(rect.top)},
+                             {static_cast<float>(rect.width), static_cast<float>(rect.height)});
+    }
+    const sf::Vector2u size = texture.getSize();
+    return sf::FloatRect({0.0f, 0.0f}, {static_cast<float>(size.x), static_cast<float>(size.y)});
+}
+
+// World-space box around everything a view shows (its rotated corners, boxed).
+static sf::FloatRect viewWorldBounds(const sf::View& view)
+{
+    return view.getInverseTransform().transformRect(sf::FloatRect({-1.0f, -1.0f}, {2.0f, 2.0f}));
+}
+
+// Tilemap-local (tile units scaled by tileSize) to world transform.
+static sf::Transform tilemapTransform(const ::Components::CTransform& transform)
+{
+    constexpr float kPi = 3.14159265358979323846f;
+    sf::Transform   mapTransform;
+    mapTransform.translate(sf::Vector2f{transform.position.x, transform.position.y})
+        .rotate(sf::degrees(transform.rotation * 180.0f / kPi))
+        .scale(sf::Vector2f{transform.scale.x, transform.scale.y});
+    return mapTransform;
+}
+
 SRenderer::SRenderer() : System() {}
 
 SRenderer::~SRenderer()
@@ -46,6 +184,23 @@ bool SRenderer::initialize(const WindowConfig& config)
         return true;
     }
 
+    if (config.offscreen)
+    {
+        // No window: draw into a texture. Works under software GL (e.g. Mesa llvmpipe) for CI and benchmarks.
+        m_renderTexture = std::make_unique<sf::RenderTexture>();
+        if (!m_renderTexture->resize(sf::Vector2u{config.width, config.height}, config.getContextSettings()))
+        {
+            LOG_ERROR("SRenderer: Failed to create {}x{} offscreen render target", config.width, config.height);
+            m_renderTexture.reset();
+            return false;
+        }
+        m_target = m_renderTexture.get();
+
+        m_initialized = true;
+        LOG_INFO("SRenderer: Initialized offscreen with size {}x{}", config.width, config.height);
+        return true;
+    }
+
     // Create the window
     m_window = std::make_unique<sf::RenderWindow>(sf::VideoMode(sf::Vector2u{config.width, config.height}),
                                                   config.title,
@@ -67,6 +222,7 @@ bool SRenderer::initialize(const WindowConfig& config)
     {
         m_window->setFramerateLimit(config.frameLimit);
     }
+    m_target = m_window.get();
 
     m_initialized = true;
     LOG_INFO("SRenderer: Initialized with window size {}x{}", config.width, config.height);
@@ -83,11 +239,16 @@ void SRenderer::shutdown()
     clearTextureCache();
     clearShaderCache();
 
+    m_staticLayers.clear();
+    m_tilemaps.clear();
+
+    m_target = nullptr;
     if (m_window)
     {
         m_window->close();
         m_window.reset();
     }
+    m_renderTexture.reset();
 
     m_initialized = false;
     LOG_INFO("SRenderer: Shutdown complete");
@@ -105,14 +266,20 @@ void SRenderer::render(World& world)
 {
     static uint64_t s_renderFrameIndex = 0;
 
-    if (!m_initialized || !m_window || !m_window->isOpen())
+    if (!m_initialized || !hasTarget())
     {
         return;
     }
 
-    // Ensure the window context is active on this thread before doing any GPU work.
+    const auto renderStart = std::chrono::steady_clock::now();
+
+    // Engine-global shader uniforms are uploaded lazily, at most once per shader per frame.
+    ++m_frameIndex;
+    m_stats.reset(m_frameIndex);
+
+    // Ensure the target's context is active on this thread before doing any GPU work.
     // SFML 3 on Windows is stricter about an active context for OpenGL entry points.
-    const bool contextActive = m_window->setActive(true);
+    const bool contextActive = m_target->setActive(true);
     if (s_renderFrameIndex < 3)
     {
         LOG_INFO("Frame {}: SRenderer::render setActive(true) => {}", s_renderFrameIndex, contextActive ? "true" : "false");
@@ -124,42 +291,40 @@ void SRenderer::render(World& world)
         // Continue rendering with cache-only texture usage.
     }
 
-    // Process queued texture loads once per frame (not per-entity).
-    // This keeps file IO + GPU uploads out of hot per-entity render paths.
+    m_textureLoader.beginFrame();
+
+    // Upload decoded textures once per frame (not per-entity).
+    // File IO and decoding run on the loader's worker threads; the particle system shares the same loader.
     if (contextActive)
     {
         if (s_renderFrameIndex < 3)
         {
-            LOG_INFO("Frame {}: SRenderer::render processQueuedTextureLoads begin (queued={})",
+            LOG_INFO("Frame {}: SRenderer::render processQueuedTextureLoads begin (pending={})",
                      s_renderFrameIndex,
-                     m_queuedTextureLoads.size());
+                     m_textureLoader.pendingCount());
         }
         processQueuedTextureLoads();
         if (s_renderFrameIndex < 3)
         {
-            LOG_INFO("Frame {}: SRenderer::render processQueuedTextureLoads end (queued={})",
+            LOG_INFO("Frame {}: SRenderer::render processQueuedTextureLoads end (pending={})",
                      s_renderFrameIndex,
-                     m_queuedTextureLoads.size());
-        }
-        if (m_particleSystem)
-        {
-            if (s_renderFrameIndex < 3)
-            {
-                LOG_INFO("Frame {}: SRenderer::render particle processQueuedTextureLoads begin", s_renderFrameIndex);
-            }
-            m_particleSystem->processQueuedTextureLoads();
-            if (s_renderFrameIndex < 3)
-            {
-                LOG_INFO("Frame {}: SRenderer::render particle processQueuedTextureLoads end", s_renderFrameIndex);
-            }
+                     m_textureLoader.pendingCount());
         }
     }
 
     struct RenderItem
     {
-        Entity entity;
-        int    zIndex;
-        bool   isParticleEmitter;
+        Entity        entity;
+        int           zIndex;
+        bool          isParticleEmitter;
+        bool          isTilemap;     ///< Drawn by renderTilemap()
+        bool          isStatic;      ///< Drawn through a cached static layer
+        AssetHandle   shader;        ///< Batch key: shader handle (kInvalidAssetHandle if none)
+        std::uint64_t uniformsHash;  ///< Batch key: material uniform set fingerprint
+        std::uint32_t layers;        ///< Render layer mask, matched against CCamera::cullingMask
+        bool          bounded;       ///< Whether bounds can be tested against camera views
+        sf::FloatRect bounds;        ///< Conservative world-space bounds
+        AssetHandle   texture;       ///< Batch key: particle texture (emitters only)
     };
 
     std::vector<RenderItem> renderQueue;
@@ -167,21 +332,99 @@ void SRenderer::render(World& world)
     auto components = world.components();
 
     components.view2<::Components::CRenderable, ::Components::CTransform>(
-        [&renderQueue](Entity entity, ::Components::CRenderable& renderable, ::Components::CTransform&)
+        [this, &renderQueue, &components, &world](Entity                     entity,
+                                                  ::Components::CRenderable& renderable,
+                                                  ::Components::CTransform&  transform)
         {
             if (!renderable.isVisible())
             {
                 return;
             }
-            renderQueue.push_back({entity, renderable.getZIndex(), false});
+
+            AssetHandle shaderHandle = kInvalidAssetHandle;
+            if (auto* shaderComp = components.tryGet<::Components::CShader>(entity))
+            {
+                if (shaderComp->shaderHandle == kInvalidAssetHandle)
+                {
+                    shaderComp->shaderHandle = resolveShaderHandle(shaderComp->getVertexShaderPath(),
+                                                                   shaderComp->getFragmentShaderPath());
+                }
+                shaderHandle = shaderComp->shaderHandle;
+            }
+
+            std::uint64_t uniformsHash = 0;
+            const auto*   material     = components.tryGet<::Components::CMaterial>(entity);
+            if (material)
+            {
+                uniformsHash = material->getUniformsHash();
+            }
+
+            // Only shader-less, alpha-blended statics are baked: shaders get u_time every frame, and the
+            // layer is composited with one premultiplied-alpha blend, which Add/Multiply/None cannot survive.
+            const bool cacheable = renderable.isStatic() && shaderHandle == kInvalidAssetHandle
+                                   && (!material || material->getBlendMode() == ::Components::BlendMode::Alpha);
+
+            sf::FloatRect bounds;
+            const bool    bounded = renderableBounds(entity, renderable, transform, world, bounds);
+
+            renderQueue.push_back({entity,
+                                   renderable.getZIndex(),
+                                   false,
+                                   false,
+                                   cacheable,
+                                   shaderHandle,
+                                   uniformsHash,
+                                   renderable.getRenderLayers(),
+                                   bounded,
+                                   bounds,
+                                   kInvalidAssetHandle});
         });
 
+    // Particles drift away from their emitter, so emitters are filtered by layer only. The texture is
+    // resolved here so emitters sharing one can be sorted next to each other and drawn together.
     components.view2<::Components::CParticleEmitter, ::Components::CTransform>(
-        [&renderQueue](Entity entity, ::Components::CParticleEmitter& emitter, ::Components::CTransform&)
+        [this, &renderQueue](Entity entity, ::Components::CParticleEmitter& emitter, ::Components::CTransform&)
         {
             if (emitter.isActive())
             {
-                renderQueue.push_back({entity, emitter.getZIndex(), true});
+                if (emitter.getTextureHandle() == kInvalidAssetHandle && !emitter.getTexturePath().empty())
+                {
+                    emitter.setTextureHandle(m_textureLoader.resolve(emitter.getTexturePath()));
+                }
+                renderQueue.push_back({entity,
+                                       emitter.getZIndex(),
+                                       true,
+                                       false,
+                                       false,
+                                       kInvalidAssetHandle,
+                                       0,
+                                       emitter.getRenderLayers(),
+                                       false,
+                                       sf::FloatRect{},
+                                       emitter.getTextureHandle()});
+            }
+        });
+
+    components.view2<::Components::CTilemap, ::Components::CTransform>(
+        [&renderQueue](Entity entity, ::Components::CTilemap& tilemap, ::Components::CTransform& transform)
+        {
+            if (tilemap.visible && !tilemap.getTiles().empty())
+            {
+                const sf::Vector2f  mapSize{static_cast<float>(tilemap.getWidth()) * tilemap.getTileSize(),
+                                           static_cast<float>(tilemap.getHeight()) * tilemap.getTileSize()};
+                const sf::FloatRect bounds =
+                    tilemapTransform(transform).transformRect(sf::FloatRect({0.0f, 0.0f}, mapSize));
+                renderQueue.push_back({entity,
+                                       tilemap.zIndex,
+                                       false,
+                                       true,
+                                       false,
+                                       kInvalidAssetHandle,
+                                       0,
+                                       tilemap.renderLayers,
+                                       true,
+                                       bounds,
+                                       kInvalidAssetHandle});
             }
         });
 
@@ -189,10 +432,71 @@ void SRenderer::render(World& world)
     {
         LOG_INFO("Frame {}: SRenderer::render queue built ({} items)", s_renderFrameIndex, renderQueue.size());
     }
+    m_stats.renderItems = renderQueue.size();
 
+    // Within a z layer, static scenery comes first (it is the layer's background), then items
+    // sharing a shader and uniform set are grouped so uniform uploads are skipped. Particle emitters
+    // come last in such a group, ordered by texture, so runs of them share one draw call.
     std::sort(renderQueue.begin(),
               renderQueue.end(),
-              [](const RenderItem& a, const RenderItem& b) { return a.zIndex < b.zIndex; });
+              [](const RenderItem& a, const RenderItem& b)
+              {
+                  if (a.zIndex != b.zIndex)
+                  {
+                      return a.zIndex < b.zIndex;
+                  }
+                  if (a.isStatic != b.isStatic)
+                  {
+                      return a.isStatic;
+                  }
+                  if (a.shader != b.shader)
+                  {
+                      return a.shader < b.shader;
+                  }
+                  if (a.uniformsHash != b.uniformsHash)
+                  {
+                      return a.uniformsHash < b.uniformsHash;
+                  }
+                  if (a.isParticleEmitter != b.isParticleEmitter)
+                  {
+                      return b.isParticleEmitter;
+                  }
+                  return a.texture < b.texture;
+              });
+
+    // Static items of one zIndex are contiguous after sorting; each run is one cacheable layer.
+    // Entity fingerprints are computed once per frame; each camera combines those it can see.
+    struct StaticRun
+    {
+        std::size_t queueBegin;   ///< First render queue index of the run
+        std::size_t entityBegin;  ///< Offset into staticEntities
+        std::size_t count;        ///< Entities in the run
+        int         zIndex;       ///< Layer zIndex
+    };
+
+    std::vector<StaticRun>     staticRuns;
+    std::vector<Entity>        staticEntities;
+    std::vector<std::uint64_t> staticFingerprints;  ///< Parallel to staticEntities
+    if (m_staticLayerCaching)
+    {
+        for (std::size_t i = 0; i < renderQueue.size(); ++i)
+        {
+            const RenderItem& item = renderQueue[i];
+            if (!item.isStatic)
+            {
+                continue;
+            }
+            if (staticRuns.empty() || staticRuns.back().zIndex != item.zIndex
+                || staticRuns.back().queueBegin + staticRuns.back().count != i)
+            {
+                staticRuns.push_back({i, staticEntities.size(), 0, item.zIndex});
+            }
+
+            ++staticRuns.back().count;
+            staticEntities.push_back(item.entity);
+            staticFingerprints.push_back(mixFingerprint(staticFingerprint(item.entity, world)));
+        }
+    }
 
     struct CameraItem
     {
@@ -227,6 +531,12 @@ void SRenderer::render(World& world)
         LOG_INFO("Frame {}: SRenderer::render cameras ({} total)", s_renderFrameIndex, cameras.size());
     }
 
+    // Per-camera scratch: render queue indices the camera draws, and the static layer being drawn.
+    std::vector<size_t> visibleItems;
+    std::vector<Entity> layerEntities;
+    std::vector<Entity> emitterEntities;
+    visibleItems.reserve(renderQueue.size());
+
     for (const CameraItem& cameraItem : cameras)
     {
         const ::Components::CCamera& camera = *cameraItem.camera;
@@ -241,7 +551,7 @@ void SRenderer::render(World& world)
             LOG_INFO("Frame {}: SRenderer buildViewFromCamera begin", s_renderFrameIndex);
         }
 
-        const sf::View view = Internal::buildViewFromCamera(camera, m_window->getSize());
+        const sf::View view = Internal::buildViewFromCamera(camera, m_target->getSize());
 
         if (s_renderFrameIndex < 3)
         {
@@ -249,16 +559,70 @@ void SRenderer::render(World& world)
             LOG_INFO("Frame {}: SRenderer setView begin", s_renderFrameIndex);
         }
 
-        m_window->setView(view);
+        m_target->setView(view);
 
         if (s_renderFrameIndex < 3)
         {
             LOG_INFO("Frame {}: SRenderer setView end", s_renderFrameIndex);
         }
 
-        size_t itemIndex = 0;
-        for (const RenderItem& item : renderQueue)
+        // Visibility list: items on this camera's layers whose bounds touch the view. Cached static
+        // items skip the bounds test; their layer texture already covers the view plus a margin.
+        const sf::FloatRect viewBounds  = viewWorldBounds(view);
+        std::size_t         culledItems = 0;
+        visibleItems.clear();
+        for (std::size_t i = 0; i < renderQueue.size(); ++i)
         {
+            const RenderItem& item         = renderQueue[i];
+            const bool        cachedStatic = item.isStatic && m_staticLayerCaching;
+            if ((item.layers & camera.cullingMask) == 0
+                || (!cachedStatic && item.bounded && !item.bounds.findIntersection(viewBounds)))
+            {
+                ++culledItems;
+                continue;
+            }
+            visibleItems.push_back(i);
+        }
+
+        size_t nextRun = 0;
+        for (size_t visibleIndex = 0; visibleIndex < visibleItems.size(); ++visibleIndex)
+        {
+            const size_t      itemIndex = visibleItems[visibleIndex];
+            const RenderItem& item      = renderQueue[itemIndex];
+
+            if (item.isStatic && m_staticLayerCaching)
+            {
+                // The first visible item of a run draws the layer from the run's visible entities;
+                // they are contiguous in the visibility list, so skip past the rest.
+                while (staticRuns[nextRun].queueBegin + staticRuns[nextRun].count <= itemIndex)
+                {
+                    ++nextRun;
+                }
+                const StaticRun& run = staticRuns[nextRun];
+
+                // Order-independent combine: sorting does not keep ties in a stable order.
+                std::uint64_t fingerprint = 0;
+                layerEntities.clear();
+                size_t runEnd = visibleIndex;
+                while (runEnd < visibleItems.size() && visibleItems[runEnd] < run.queueBegin + run.count)
+                {
+                    const size_t offset = run.entityBegin + (visibleItems[runEnd] - run.queueBegin);
+                    layerEntities.push_back(staticEntities[offset]);
+                    fingerprint += staticFingerprints[offset];
+                    ++runEnd;
+                }
+
+                flushBatch();
+                drawStaticLayer({cameraItem.entity.index, cameraItem.entity.generation, run.zIndex},
+                                view,
+                                layerEntities.data(),
+                                layerEntities.size(),
+                                mixFingerprint(fingerprint ^ layerEntities.size()),
+                                world);
+                visibleIndex = runEnd - 1;
+                continue;
+            }
+
             if (s_renderFrameIndex < 3)
             {
                 LOG_INFO("Frame {}: RenderItem {} begin E{}:G{} particle={}",
@@ -269,38 +633,44 @@ void SRenderer::render(World& world)
                          item.isParticleEmitter);
             }
 
+            if (item.isTilemap)
+            {
+                flushBatch();
+                renderTilemap(item.entity, world);
+                continue;
+            }
+
             if (item.isParticleEmitter)
             {
+                // Consecutive visible emitters (same z layer, sorted by texture) render as one batch.
+                size_t runEnd = visibleIndex;
+                emitterEntities.clear();
+                while (runEnd < visibleItems.size() && renderQueue[visibleItems[runEnd]].isParticleEmitter
+                       && renderQueue[visibleItems[runEnd]].zIndex == item.zIndex)
+                {
+                    emitterEntities.push_back(renderQueue[visibleItems[runEnd]].entity);
+                    ++runEnd;
+                }
+
                 if (m_particleSystem && m_particleSystem->isInitialized())
                 {
                     if (s_renderFrameIndex < 3)
                     {
-                        LOG_INFO("Frame {}: RenderItem {} particle render begin E{}:G{}",
+                        LOG_INFO("Frame {}: RenderItem {} particle batch render begin ({} emitters)",
                                  s_renderFrameIndex,
                                  itemIndex,
-                                 item.entity.index,
-                                 item.entity.generation);
+                                 emitterEntities.size());
                     }
-                    m_particleSystem->renderEmitter(item.entity, m_window.get(), world);
+                    flushBatch();
+                    m_particleSystem->renderEmitters(
+                        emitterEntities.data(), emitterEntities.size(), m_target, world, &m_stats);
                     if (s_renderFrameIndex < 3)
                     {
-                        LOG_INFO("Frame {}: RenderItem {} particle render end   E{}:G{}",
-                                 s_renderFrameIndex,
-                                 itemIndex,
-                                 item.entity.index,
-                                 item.entity.generation);
+                        LOG_INFO("Frame {}: RenderItem {} particle batch render end", s_renderFrameIndex, itemIndex);
                     }
                 }
 
-                if (s_renderFrameIndex < 3)
-                {
-                    LOG_INFO("Frame {}: RenderItem {} end   E{}:G{} particle=true",
-                             s_renderFrameIndex,
-                             itemIndex,
-                             item.entity.index,
-                             item.entity.generation);
-                }
-                ++itemIndex;
+                visibleIndex = runEnd - 1;
                 continue;
             }
 
@@ -326,24 +696,55 @@ void SRenderer::render(World& world)
                          item.entity.index,
                          item.entity.generation);
             }
-
-            ++itemIndex;
         }
 
+        // The batch was built under this camera's view.
+        flushBatch();
+
+        CameraRenderStats cameraStats;
+        cameraStats.name           = camera.name;
+        cameraStats.itemsSubmitted = visibleItems.size();
+        cameraStats.itemsCulled    = culledItems;
+        m_stats.cameras.push_back(std::move(cameraStats));
+        m_stats.culledItems += culledItems;
+
         if (s_renderFrameIndex < 3)
         {
             LOG_INFO("Frame {}: SRenderer camera end", s_renderFrameIndex);
         }
     }
 
+    // Drop static layers whose camera is gone, or that went unused for kCacheIdleFrames. A layer that
+    // is skipped for a few frames (hidden, culled by layer mask) keeps its texture.
+    for (auto it = m_staticLayers.begin(); it != m_staticLayers.end();)
+    {
+        const Entity cameraEntity(std::get<0>(it->first), std::get<1>(it->first));
+        const bool   cameraGone = cameraEntity.isValid()
+                                && (!world.isAlive(cameraEntity)
+                                    || !components.tryGet<::Components::CCamera>(cameraEntity));
+        const bool   idle       = it->second.lastUsedFrame + kCacheIdleFrames < m_frameIndex;
+        it                      = cameraGone || idle ? m_staticLayers.erase(it) : std::next(it);
+    }
+    // Tilemap meshes outlive frames where the map is culled or off camera; only a removed map, or one
+    // idle for kCacheIdleFrames, releases its buffers.
+    for (auto it = m_tilemaps.begin(); it != m_tilemaps.end();)
+    {
+        const bool mapGone = !world.isAlive(it->first) || !components.tryGet<::Components::CTilemap>(it->first);
+        const bool idle    = it->second.lastUsedFrame + kCacheIdleFrames < m_frameIndex;
+        it                 = mapGone || idle ? m_tilemaps.erase(it) : std::next(it);
+    }
+
+    m_stats.renderMs =
+        std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - renderStart).count();
+
     ++s_renderFrameIndex;
 }
 
 void SRenderer::clear(const Color& color)
 {
-    if (m_window && m_window->isOpen())
+    if (hasTarget())
     {
-        m_window->clear(toSFMLColor(color));
+        m_target->clear(toSFMLColor(color));
     }
 }
 
@@ -353,6 +754,10 @@ void SRenderer::display()
     {
         m_window->display();
     }
+    else if (m_renderTexture)
+    {
+        m_renderTexture->display();
+    }
 }
 
 bool SRenderer::isWindowOpen() const
@@ -365,130 +770,77 @@ sf::RenderWindow* SRenderer::getWindow()
     return m_window.get();
 }
 
-const sf::Texture* SRenderer::getCachedTexture(const std::string& resolvedKey) const
+sf::RenderTarget* SRenderer::getRenderTarget()
 {
-    auto it = m_textureCache.find(resolvedKey);
-    if (it == m_textureCache.end())
-    {
-        return nullptr;
-    }
-    return &it->second;
+    return m_target;
 }
 
-void SRenderer::requestTextureLoad(const std::string& filepath)
+sf::Image SRenderer::captureFrame()
 {
-    if (filepath.empty())
+    if (m_renderTexture)
     {
-        return;
+        return m_renderTexture->getTexture().copyToImage();
     }
 
-    const std::filesystem::path resolvedPath = Internal::ExecutablePaths::resolveRelativeToExecutableDir(filepath);
-    const std::string           resolvedStr  = resolvedPath.string();
-
-    if (resolvedStr.empty())
+    if (m_window && m_window->isOpen())
     {
-        return;
+        // Reads the back buffer, so call before display().
+        sf::Texture texture;
+        if (texture.resize(m_window->getSize()))
+        {
+            texture.update(*m_window);
+            return texture.copyToImage();
+        }
     }
 
-    // Already cached?
-    if (m_textureCache.find(resolvedStr) != m_textureCache.end())
-    {
-        return;
-    }
+    return sf::Image{};
+}
 
-    m_queuedTextureLoads.insert(resolvedStr);
+bool SRenderer::hasTarget() const
+{
+    return m_window ? m_window->isOpen() : m_renderTexture != nullptr;
+}
+
+AssetHandle SRenderer::resolveTextureHandle(const std::string& filepath)
+{
+    return m_textureLoader.resolve(filepath);
+}
+
+const sf::Texture* SRenderer::getTexture(AssetHandle handle)
+{
+    return m_textureLoader.get(handle);
+}
+
+void SRenderer::requestTextureLoad(const std::string& filepath)
+{
+    (void)m_textureLoader.get(m_textureLoader.resolve(filepath));
 }
 
 void SRenderer::processQueuedTextureLoads()
 {
-    if (!m_window || !m_window->isOpen())
+    if (!hasTarget())
     {
         return;
     }
 
-    if (m_queuedTextureLoads.empty())
+    if (m_textureLoader.pendingCount() == 0 && !m_textureLoader.isOverBudget())
     {
         return;
     }
 
     // Activate once per batch.
-    if (!m_window->setActive(true))
+    if (!m_target->setActive(true))
     {
-        LOG_WARN("SRenderer::processQueuedTextureLoads: setActive(true) failed, deferring {} queued textures",
-                 m_queuedTextureLoads.size());
+        LOG_WARN("SRenderer::processQueuedTextureLoads: setActive(true) failed, deferring {} pending textures",
+                 m_textureLoader.pendingCount());
         return;
     }
 
-    // Load at most N textures per frame to avoid stalls.
-    constexpr size_t kMaxLoadsPerFrame = 4;
-    size_t           loadsThisFrame    = 0;
-
-    static uint64_t s_debugLoadsLogged = 0;
-
-    for (auto it = m_queuedTextureLoads.begin(); it != m_queuedTextureLoads.end() && loadsThisFrame < kMaxLoadsPerFrame;)
-    {
-        const std::string& resolvedStr = *it;
-
-        const std::filesystem::path resolvedPath(resolvedStr);
-
-        const bool logThis = s_debugLoadsLogged < 32;
-        if (logThis)
-        {
-            LOG_INFO("SRenderer::processQueuedTextureLoads: begin '{}'", resolvedStr);
-            ++s_debugLoadsLogged;
-            const auto genTexturesPtr = sf::Context::getFunction("glGenTextures");
-            const auto texImage2DPtr  = sf::Context::getFunction("glTexImage2D");
-            LOG_INFO("SRenderer::processQueuedTextureLoads: glGenTextures={} glTexImage2D={}",
-                     genTexturesPtr ? "ok" : "null",
-                     texImage2DPtr ? "ok" : "null");
-        }
-
-        // Another request might have loaded it already.
-        if (m_textureCache.find(resolvedStr) != m_textureCache.end())
-        {
-            it = m_queuedTextureLoads.erase(it);
-            continue;
-        }
-
-        std::error_code ec;
-        const bool      exists = std::filesystem::exists(resolvedPath, ec);
-        if (ec)
-        {
-            LOG_WARN("SRenderer::processQueuedTextureLoads: exists() error for '{}' : {}", resolvedStr, ec.message());
-        }
-        if (!exists)
-        {
-            LOG_WARN("SRenderer::processQueuedTextureLoads: file does not exist: '{}'", resolvedStr);
-            it = m_queuedTextureLoads.erase(it);
-            continue;
-        }
-
-        if (logThis)
-        {
-            LOG_INFO("SRenderer::processQueuedTextureLoads: loading '{}'", resolvedStr);
-        }
-
-        sf::Texture texture;
-        std::string loadError;
-        const bool  loaded = Internal::SFMLResourceLoader::loadTextureFromFileBytes(resolvedPath, texture, &loadError);
-
-        if (!loaded)
-        {
-            LOG_WARN("SRenderer::processQueuedTextureLoads: failed to load '{}' : {}", resolvedStr, loadError);
-            it = m_queuedTextureLoads.erase(it);
-            continue;
-        }
-
-        m_textureCache.emplace(resolvedStr, std::move(texture));
-
-        if (logThis)
-        {
-            LOG_INFO("SRenderer::processQueuedTextureLoads: cached '{}' (cacheSize={})", resolvedStr, m_textureCache.size());
-        }
-
-        it = m_queuedTextureLoads.erase(it);
-        ++loadsThisFrame;
-    }
+    // Decoding already happened on worker threads; only GPU uploads remain, bounded by bytes
+    // rather than by count so one large atlas and many small sprites cost the same frame time.
+    // Uploading also trims least recently used textures back under the memory budget.
+    constexpr std::size_t kUploadBudgetBytesPerFrame = Internal::TextureLoader::kDefaultUploadBudgetBytes;
+    m_textureLoader.uploadPending(kUploadBudgetBytesPerFrame);
 }
 
 const sf::Texture* SRenderer::loadTexture(const std::string& filepath)
@@ -498,62 +850,34 @@ const sf::Texture* SRenderer::loadTexture(const std::string& filepath)
         return nullptr;
     }
 
-    if (!m_window || !m_window->isOpen())
+    if (!hasTarget())
     {
         return nullptr;
     }
 
-    // Texture creation/upload may touch OpenGL state; ensure the window context is active.
+    // Texture creation/upload may touch OpenGL state; ensure the target's context is active.
     // If activation fails, fail gracefully instead of risking a hard crash.
-    if (!m_window->setActive(true))
+    if (!m_target->setActive(true))
     {
         LOG_WARN("SRenderer::loadTexture: setActive(true) failed, skipping load for '{}'", filepath);
         return nullptr;
     }
 
-    const std::filesystem::path resolvedPath = Internal::ExecutablePaths::resolveRelativeToExecutableDir(filepath);
-    const std::string           resolvedStr  = resolvedPath.string();
-
-    // Check if texture is already cached
-    auto it = m_textureCache.find(resolvedStr);
-    if (it != m_textureCache.end())
-    {
-        return &it->second;
-    }
-
-    {
-        std::error_code ec;
-        const bool      exists = std::filesystem::exists(resolvedPath, ec);
-        if (ec)
-        {
-            LOG_WARN("SRenderer::loadTexture: exists() error for '{}' : {}", resolvedStr, ec.message());
-        }
-        if (!exists)
-        {
-            LOG_WARN("SRenderer::loadTexture: file does not exist: '{}' (original='{}')", resolvedStr, filepath);
-            return nullptr;
-        }
-    }
-
-    sf::Texture texture;
-    std::string loadError;
-    const bool  loaded = Internal::SFMLResourceLoader::loadTextureFromFileBytes(resolvedPath, texture, &loadError);
-    if (!loaded)
-    {
-        LOG_WARN("SRenderer::loadTexture: failed to load '{}' : {}", resolvedStr, loadError);
-        return nullptr;
-    }
-
-    auto [insertedIt, inserted] = m_textureCache.emplace(resolvedStr, std::move(texture));
-    (void)inserted;
-    return &insertedIt->second;
+    return m_textureLoader.loadNow(m_textureLoader.resolve(filepath), "SRenderer::loadTexture");
 }
 
-const sf::Shader* SRenderer::loadShader(const std::string& vertexPath, const std::string& fragmentPath)
+AssetHandle SRenderer::resolveShaderHandle(const std::string& vertexPath, const std::string& fragmentPath)
 {
     if (vertexPath.empty() && fragmentPath.empty())
     {
-        return nullptr;
+        return kInvalidAssetHandle;
+    }
+
+    const std::string requestKey = vertexPath + "|" + fragmentPath;
+    auto              byKey      = m_shaderHandlesByKey.find(requestKey);
+    if (byKey != m_shaderHandlesByKey.end())
+    {
+        return byKey->second;
     }
 
     const std::filesystem::path resolvedVertexPath   = vertexPath.empty()
@@ -567,22 +891,57 @@ const sf::Shader* SRenderer::loadShader(const std::string& vertexPath, const std
     const std::string resolvedFragmentStr = resolvedFragmentPath.empty() ? std::string{} : resolvedFragmentPath.string();
 
     // Create cache key from both paths
-    std::string cacheKey = resolvedVertexStr + "|" + resolvedFragmentStr;
+    const std::string resolvedKey = resolvedVertexStr + "|" + resolvedFragmentStr;
 
-    // Check if shader is already cached
-    auto it = m_shaderCache.find(cacheKey);
-    if (it != m_shaderCache.end())
+    AssetHandle handle     = kInvalidAssetHandle;
+    auto        byResolved = m_shaderHandlesByResolvedKey.find(resolvedKey);
+    if (byResolved != m_shaderHandlesByResolvedKey.end())
     {
-        return it->second.get();
+        handle = byResolved->second;
+    }
+    else
+    {
+        handle = static_cast<AssetHandle>(m_shaderSlots.size());
+        m_shaderHandlesByResolvedKey.emplace(resolvedKey, handle);
+
+        ShaderSlot slot;
+        slot.resolvedVertexPath   = resolvedVertexStr;
+        slot.resolvedFragmentPath = resolvedFragmentStr;
+        m_shaderSlots.push_back(std::move(slot));
+    }
+
+    m_shaderHandlesByKey.emplace(requestKey, handle);
+    return handle;
+}
+
+const sf::Shader* SRenderer::getShader(AssetHandle handle)
+{
+    if (handle >= m_shaderSlots.size())
+    {
+        return nullptr;
+    }
+
+    ShaderSlot& slot = m_shaderSlots[handle];
+    if (slot.shader)
+    {
+        return slot.shader.get();
+    }
+    if (slot.failed)
+    {
+        return nullptr;
     }
 
     // Check if shaders are supported
     if (!sf::Shader::isAvailable())
     {
         LOG_WARN("SRenderer: Shaders are not available on this system");
+        slot.failed = true;
         return nullptr;
     }
 
+    const std::string& resolvedVertexStr   = slot.resolvedVertexPath;
+    const std::string& resolvedFragmentStr = slot.resolvedFragmentPath;
+
     // Load new shader
     auto shader = std::make_unique<sf::Shader>();
     bool loaded = false;
@@ -619,33 +978,676 @@ const sf::Shader* SRenderer::loadShader(const std::string& vertexPath, const std
     if (!loaded)
     {
         LOG_ERROR("SRenderer: Failed to load shader (vertex: '{}', fragment: '{}')", resolvedVertexStr, resolvedFragmentStr);
+        slot.failed = true;
         return nullptr;
     }
 
     // Cache the shader
-    const sf::Shader* shaderPtr = shader.get();
-    m_shaderCache[cacheKey]     = std::move(shader);
+    slot.shader = std::move(shader);
     LOG_DEBUG("SRenderer: Loaded shader (vertex: '{}', fragment: '{}')", resolvedVertexStr, resolvedFragmentStr);
-    return shaderPtr;
+    return slot.shader.get();
+}
+
+const sf::Shader* SRenderer::loadShader(const std::string& vertexPath, const std::string& fragmentPath)
+{
+    return getShader(resolveShaderHandle(vertexPath, fragmentPath));
+}
+
+void SRenderer::setTextureMemoryBudget(std::size_t bytes)
+{
+    m_textureLoader.setMemoryBudget(bytes);
+    LOG_INFO("SRenderer: Texture memory budget set to {} bytes{}", bytes, bytes == 0 ? " (unlimited)" : "");
+}
+
+const Internal::TextureResidencyStats& SRenderer::getTextureStats() const
+{
+    return m_textureLoader.getStats();
 }
 
 void SRenderer::clearTextureCache()
 {
-    m_textureCache.clear();
+    m_textureLoader.clear();
     LOG_DEBUG("SRenderer: Texture cache cleared");
 }
 
 void SRenderer::clearShaderCache()
 {
-    m_shaderCache.clear();
+    for (ShaderSlot& slot : m_shaderSlots)
+    {
+        slot.shader.reset();
+        slot.failed              = false;
+        slot.globalsFrame        = 0;
+        slot.appliedUniformsHash = 0;
+        slot.appliedUniforms.clear();
+    }
     LOG_DEBUG("SRenderer: Shader cache cleared");
 }
 
-void SRenderer::renderEntity(Entity entity, World& world)
+void SRenderer::setStaticLayerCaching(bool enabled)
 {
-    if (!entity.isValid())
+    m_staticLayerCaching = enabled;
+    if (!enabled)
     {
-        return;
+        m_staticLayers.clear();
+    }
+}
+
+void SRenderer::setStaticLayerMargin(float fraction)
+{
+    m_staticLayerMargin = std::max(0.0f, fraction);
+}
+
+void SRenderer::invalidateStaticLayers()
+{
+    for (auto& [key, cache] : m_staticLayers)
+    {
+        cache.fingerprint = 0;
+    }
+}
+
+void SRenderer::renderTilemap(Entity entity, World& world)
+{
+    auto  components = world.components();
+    auto* tilemap    = components.tryGet<::Components::CTilemap>(entity);
+    auto* transform  = components.tryGet<::Components::CTransform>(entity);
+    if (!tilemap || !transform || tilemap->getTilePixelWidth() == 0 || tilemap->getTilePixelHeight() == 0)
+    {
+        return;
+    }
+
+    if (tilemap->atlasHandle == kInvalidAssetHandle)
+    {
+        tilemap->atlasHandle = resolveTextureHandle(tilemap->getAtlasPath());
+    }
+    const sf::Texture* atlas = getTexture(tilemap->atlasHandle);
+    if (!atlas)
+    {
+        return;  // Queued; the map appears once the atlas is resident.
+    }
+
+    TilemapMesh& mesh  = m_tilemaps[entity];
+    mesh.lastUsedFrame = m_frameIndex;
+
+    const std::uint32_t chunksX    = tilemap->getChunksX();
+    const std::uint32_t chunksY    = tilemap->getChunksY();
+    const std::size_t   chunkCount = static_cast<std::size_t>(chunksX) * chunksY;
+    if (mesh.layoutRevision != tilemap->layoutRevision || mesh.atlasSize != atlas->getSize()
+        || mesh.chunks.size() != chunkCount)
+    {
+        mesh.chunks.clear();
+        mesh.chunks.resize(chunkCount);
+        mesh.layoutRevision = tilemap->layoutRevision;
+        mesh.atlasSize      = atlas->getSize();
+    }
+
+    const sf::Transform mapTransform = tilemapTransform(*transform);
+    const sf::FloatRect viewBounds   = viewWorldBounds(m_target->getView());
+
+    sf::RenderStates states;
+    states.texture   = atlas;
+    states.transform = mapTransform;
+
+    const float chunkWorldSize = tilemap->getTileSize() * static_cast<float>(::Components::CTilemap::kChunkSize);
+    for (std::uint32_t cy = 0; cy < chunksY; ++cy)
+    {
+        for (std::uint32_t cx = 0; cx < chunksX; ++cx)
+        {
+            const sf::Vector2f  chunkOrigin{static_cast<float>(cx) * chunkWorldSize,
+                                           static_cast<float>(cy) * chunkWorldSize};
+            const sf::FloatRect localBounds(chunkOrigin, {chunkWorldSize, chunkWorldSize});
+            if (!mapTransform.transformRect(localBounds).findIntersection(viewBounds))
+            {
+                ++m_stats.tileChunksCulled;
+                continue;
+            }
+
+            TilemapChunk& chunk = mesh.chunks[static_cast<std::size_t>(cy) * chunksX + cx];
+            if (chunk.revision != tilemap->getChunkRevision(cx, cy))
+            {
+                buildTilemapChunk(*tilemap, cx, cy, mesh.atlasSize, chunk);
+                ++m_stats.tileChunkBuilds;
+            }
+            if (chunk.vertexCount == 0)
+            {
+                continue;
+            }
+
+            if (chunk.vertices.getVertexCount() == 0)
+            {
+                // The buffer only grows, so a chunk that lost tiles draws just its leading vertices.
+                m_target->draw(chunk.buffer, 0, chunk.vertexCount, states);
+            }
+            else
+            {
+                m_target->draw(chunk.vertices, states);
+            }
+            m_stats.recordDraw(atlas, nullptr, chunk.vertexCount);
+            ++m_stats.tileChunks;
+        }
+    }
+}
+
+void SRenderer::buildTilemapChunk(const ::Components::CTilemap& tilemap,
+                                  std::uint32_t                 chunkX,
+                                  std::uint32_t                 chunkY,
+                                  const sf::Vector2u&           atlasSize,
+                                  TilemapChunk&                 chunk)
+{
+    using ::Components::CTilemap;
+
+    const std::uint32_t columns = std::max(1u, atlasSize.x / tilemap.getTilePixelWidth());
+    const std::uint32_t rows    = std::max(1u, atlasSize.y / tilemap.getTilePixelHeight());
+    const float         size    = tilemap.getTileSize();
+    const float         cellW   = static_cast<float>(tilemap.getTilePixelWidth());
+    const float         cellH   = static_cast<float>(tilemap.getTilePixelHeight());
+
+    const std::uint32_t x0 = chunkX * CTilemap::kChunkSize;
+    const std::uint32_t y0 = chunkY * CTilemap::kChunkSize;
+    const std::uint32_t x1 = std::min(x0 + CTilemap::kChunkSize, tilemap.getWidth());
+    const std::uint32_t y1 = std::min(y0 + CTilemap::kChunkSize, tilemap.getHeight());
+
+    std::vector<sf::Vertex> vertices;
+    vertices.reserve(static_cast<std::size_t>(x1 - x0) * (y1 - y0) * 6u);
+    for (std::uint32_t y = y0; y < y1; ++y)
+    {
+        for (std::uint32_t x = x0; x < x1; ++x)
+        {
+            const std::int32_t tile = tilemap.getTile(x, y);
+            if (tile < 0 || static_cast<std::uint32_t>(tile) >= columns * rows)
+            {
+                continue;
+            }
+
+            const float u = static_cast<float>(static_cast<std::uint32_t>(tile) % columns) * cellW;
+            const float v = static_cast<float>(static_cast<std::uint32_t>(tile) / columns) * cellH;
+
+            // World Y is up while atlas rows run down, so the top edge samples v.
+            const float left   = static_cast<float>(x) * size;
+            const float bottom = static_cast<float>(y) * size;
+            sf::Vertex  bl;
+            bl.position  = {left, bottom};
+            bl.texCoords = {u, v + cellH};
+            sf::Vertex br;
+            br.position  = {left + size, bottom};
+            br.texCoords = {u + cellW, v + cellH};
+            sf::Vertex tl;
+            tl.position  = {left, bottom + size};
+            tl.texCoords = {u, v};
+            sf::Vertex tr;
+            tr.position  = {left + size, bottom + size};
+            tr.texCoords = {u + cellW, v};
+
+            vertices.insert(vertices.end(), {bl, br, tr, bl, tr, tl});
+        }
+    }
+
+    chunk.vertexCount = vertices.size();
+    chunk.revision    = tilemap.getChunkRevision(chunkX, chunkY);
+    chunk.vertices.clear();
+    if (vertices.empty())
+    {
+        return;
+    }
+
+    // Static VBO when the driver supports it; otherwise keep the vertices on the CPU.
+    if (sf::VertexBuffer::isAvailable() && (chunk.buffer.getVertexCount() >= vertices.size()
+                                            || chunk.buffer.create(vertices.size()))
+        && chunk.buffer.update(vertices.data(), vertices.size(), 0))
+    {
+        return;
+    }
+    for (const sf::Vertex& vertex : vertices)
+    {
+        chunk.vertices.append(vertex);
+    }
+}
+
+bool SRenderer::renderableBounds(Entity                           entity,
+                                 const ::Components::CRenderable& renderable,
+                                 const ::Components::CTransform&  transform,
+                                 World&                           world,
+                                 sf::FloatRect&                   bounds)
+{
+    auto components = world.components();
+
+    // Sizes mirror renderEntity(). The radius of a circle around the position covers any rotation.
+    constexpr float kPixelsPerMeter = 100.0f;
+    constexpr float kDefaultHalfM   = 25.0f / kPixelsPerMeter;
+
+    const Vec2  pos      = transform.getPosition();
+    const Vec2  scale    = transform.getScale();
+    const float maxScale = std::max(std::abs(scale.x), std::abs(scale.y));
+    const auto* collider = components.tryGet<::Components::CCollider2D>(entity);
+
+    float radius = 0.0f;
+    switch (renderable.getVisualType())
+    {
+        case ::Components::VisualType::Rectangle:
+            if (collider && collider->getShapeType() == ::Components::ColliderShape::Box)
+            {
+                radius = std::hypot(collider->getBoxHalfWidth(), collider->getBoxHalfHeight());
+            }
+            else
+            {
+                radius = std::hypot(kDefaultHalfM * scale.x, kDefaultHalfM * scale.y);
+            }
+            break;
+
+        case ::Components::VisualType::Circle:
+        {
+            const bool circleCollider = collider && collider->getShapeType() == ::Components::ColliderShape::Circle;
+            radius = (circleCollider ? collider->getCircleRadius() : kDefaultHalfM) * maxScale;
+            break;
+        }
+
+        case ::Components::VisualType::Sprite:
+        {
+            const sf::Texture* texture     = nullptr;
+            auto*              textureComp = components.tryGet<::Components::CTexture>(entity);
+            if (textureComp)
+            {
+                if (textureComp->textureHandle == kInvalidAssetHandle && !textureComp->getTexturePath().empty())
+                {
+                    textureComp->textureHandle = resolveTextureHandle(textureComp->getTexturePath());
+                }
+                texture = getTexture(textureComp->textureHandle);
+            }
+            if (!texture)
+            {
+                radius = std::hypot(kDefaultHalfM * scale.x, kDefaultHalfM * scale.y);
+                break;
+            }
+
+            const sf::FloatRect region    = textureRegion(*texture, textureComp);
+            const float         texWidth  = std::max(1.0f, region.size.x);
+            const float         texHeight = std::max(1.0f, region.size.y);
+            float        unitScale = 1.0f / kPixelsPerMeter;
+            sf::Vector2f colliderMin;
+            sf::Vector2f colliderMax;
+            if (collider && colliderLocalBounds(*collider, colliderMin, colliderMax))
+            {
+                const sf::Vector2f size = colliderMax - colliderMin;
+                if (std::isfinite(size.x) && std::isfinite(size.y) && size.x > 0.0f && size.y > 0.0f)
+                {
+                    // The sprite is anchored at the body origin mapped into the collider bounds.
+                    // If the origin lies outside them, the image can sit anywhere; don't cull it.
+                    if (colliderMin.x > 0.0f || colliderMax.x < 0.0f || colliderMin.y > 0.0f || colliderMax.y < 0.0f)
+                    {
+                        return false;
+                    }
+                    unitScale = std::max(size.x, size.y) / std::min(texWidth, texHeight);
+
+                    // The origin is inside the image, so its full diagonal bounds the reach.
+                    radius = std::hypot(texWidth * unitScale * scale.x, texHeight * unitScale * scale.y);
+                    break;
+                }
+            }
+            radius = 0.5f * std::hypot(texWidth * unitScale * scale.x, texHeight * unitScale * scale.y);
+            break;
+        }
+
+        case ::Components::VisualType::Line:
+        {
+            const Vec2  start = renderable.getLineStart();
+            const Vec2  end   = renderable.getLineEnd();
+            const float reach = std::max(std::hypot(start.x, start.y), std::hypot(end.x, end.y)) * maxScale;
+            radius            = reach + std::max(renderable.getLineThickness(), 1.0f) / kPixelsPerMeter;
+            break;
+        }
+
+        case ::Components::VisualType::Custom:
+        case ::Components::VisualType::None:
+        default:
+            return false;
+    }
+
+    bounds = sf::FloatRect({pos.x - radius, pos.y - radius}, {2.0f * radius, 2.0f * radius});
+    return true;
+}
+
+std::uint64_t SRenderer::staticFingerprint(Entity entity, World& world)
+{
+    auto components = world.components();
+
+    std::uint64_t hash = 14695981039346656037ull;
+    hashField(hash, entity.index);
+    hashField(hash, entity.generation);
+
+    if (const auto* transform = components.tryGet<::Components::CTransform>(entity))
+    {
+        hashField(hash, transform->position.x);
+        hashField(hash, transform->position.y);
+        hashField(hash, transform->scale.x);
+        hashField(hash, transform->scale.y);
+        hashField(hash, transform->rotation);
+    }
+
+    if (const auto* renderable = components.tryGet<::Components::CRenderable>(entity))
+    {
+        hashField(hash, renderable->visualType);
+        hashField(hash, renderable->color);
+        hashField(hash, renderable->lineStart.x);
+        hashField(hash, renderable->lineStart.y);
+        hashField(hash, renderable->lineEnd.x);
+        hashField(hash, renderable->lineEnd.y);
+        hashField(hash, renderable->lineThickness);
+        hashField(hash, renderable->lineCap);
+    }
+
+    if (const auto* material = components.tryGet<::Components::CMaterial>(entity))
+    {
+        hashField(hash, material->getTint());
+        hashField(hash, material->getOpacity());
+        hashField(hash, material->getBlendMode());
+        hashField(hash, material->getUniformsHash());
+    }
+
+    if (auto* textureComp = components.tryGet<::Components::CTexture>(entity))
+    {
+        if (textureComp->textureHandle == kInvalidAssetHandle && !textureComp->getTexturePath().empty())
+        {
+            textureComp->textureHandle = resolveTextureHandle(textureComp->getTexturePath());
+        }
+        // Residency is part of the content: a layer rendered with a fallback re-renders once the
+        // texture arrives. The lookup also keeps the texture's LRU stamp fresh while it is cached.
+        hashField(hash, textureComp->textureHandle);
+        hashField(hash, getTexture(textureComp->textureHandle) != nullptr);
+        hashField(hash, textureComp->textureRect);
+    }
+
+    if (const auto* shaderComp = components.tryGet<::Components::CShader>(entity))
+    {
+        hashField(hash, shaderComp->shaderHandle);
+    }
+
+    if (const auto* collider = components.tryGet<::Components::CCollider2D>(entity))
+    {
+        hashField(hash, collider->getShapeType());
+        hashField(hash, collider->getCircleRadius());
+        hashField(hash, collider->getBoxHalfWidth());
+        hashField(hash, collider->getBoxHalfHeight());
+    }
+
+    return hash;
+}
+
+void SRenderer::drawStaticLayer(const StaticLayerKey& key,
+                                const sf::View&       view,
+                                const Entity*         entities,
+                                std::size_t           count,
+                                std::uint64_t         fingerprint,
+                                World&                world)
+{
+    StaticLayerCache& cache = m_staticLayers[key];
+    cache.lastUsedFrame     = m_frameIndex;
+
+    // The cache covers the camera's viewport plus the margin on every side, at the same pixel density.
+    const float          grow         = 1.0f + 2.0f * m_staticLayerMargin;
+    const sf::Vector2u   targetSize   = m_target->getSize();
+    const sf::FloatRect& viewport     = view.getViewport();
+    const unsigned int   maxSize      = sf::Texture::getMaximumSize();
+    const auto           scaledPixels = [grow, maxSize](float fraction, unsigned int pixels)
+    {
+        const float size = std::round(fraction * static_cast<float>(pixels) * grow);
+        return std::clamp(static_cast<unsigned int>(std::max(size, 1.0f)), 1u, maxSize);
+    };
+    const sf::Vector2u textureSize{scaledPixels(viewport.size.x, targetSize.x),
+                                   scaledPixels(viewport.size.y, targetSize.y)};
+    const sf::Vector2f cacheViewSize = view.getSize() * grow;
+
+    bool reuse = cache.texture && cache.fingerprint == fingerprint && cache.texture->getSize() == textureSize
+                 && cache.view.getSize() == cacheViewSize
+                 && cache.view.getRotation().asDegrees() == view.getRotation().asDegrees();
+    if (reuse)
+    {
+        // Valid while the current view still lies inside the cached area (measured in view space).
+        const sf::Vector2f delta = sf::Transform()
+                                       .rotate(sf::degrees(-view.getRotation().asDegrees()))
+                                       .transformPoint(view.getCenter() - cache.view.getCenter());
+        reuse = std::abs(delta.x) <= std::abs(view.getSize().x) * m_staticLayerMargin
+                && std::abs(delta.y) <= std::abs(view.getSize().y) * m_staticLayerMargin;
+    }
+
+    if (!reuse)
+    {
+        if (!cache.texture || cache.texture->getSize() != textureSize)
+        {
+            cache.texture = std::make_unique<sf::RenderTexture>();
+            if (!cache.texture->resize(textureSize))
+            {
+                LOG_WARN("SRenderer: failed to create {}x{} static layer cache, drawing layer directly",
+                         textureSize.x,
+                         textureSize.y);
+                m_staticLayers.erase(key);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    renderEntity(entities[i], world);
+                }
+                return;
+            }
+        }
+
+        cache.view = view;
+        cache.view.setSize(cacheViewSize);
+        cache.view.setViewport(sf::FloatRect({0.0f, 0.0f}, {1.0f, 1.0f}));
+
+        // Render the layer through the normal entity path, redirected into the cache.
+        sf::RenderTarget* const previousTarget = m_target;
+        m_target                               = cache.texture.get();
+        cache.texture->clear(sf::Color::Transparent);
+        cache.texture->setView(cache.view);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            renderEntity(entities[i], world);
+        }
+        flushBatch();
+        cache.texture->display();
+        m_target = previousTarget;
+
+        cache.fingerprint = fingerprint;
+        ++m_stats.staticRebuilds;
+    }
+
+    // Map cache pixels back to world space: pixels -> normalized device coordinates -> cached view inverse.
+    const float         width  = static_cast<float>(textureSize.x);
+    const float         height = static_cast<float>(textureSize.y);
+    const sf::Transform pixelsToNdc(2.0f / width, 0.0f, -1.0f, 0.0f, -2.0f / height, 1.0f, 0.0f, 0.0f, 1.0f);
+
+    sf::RenderStates states;
+    states.transform = cache.view.getInverseTransform();
+    states.transform.combine(pixelsToNdc);
+    // Layer pixels were alpha-blended onto a transparent texture, so they are premultiplied.
+    states.blendMode = sf::BlendMode(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+
+    const sf::Texture& texture = cache.texture->getTexture();
+    m_target->draw(sf::Sprite(texture), states);
+    m_stats.recordDraw(&texture, nullptr, 4);
+    ++m_stats.staticLayers;
+}
+
+void SRenderer::applyShaderUniforms(AssetHandle handle, const ::Components::CMaterial* material)
+{
+    if (handle >= m_shaderSlots.size() || !m_shaderSlots[handle].shader)
+    {
+        return;
+    }
+
+    ShaderSlot& slot   = m_shaderSlots[handle];
+    sf::Shader& shader = *slot.shader;
+
+    // Engine-global parameter block: once per shader per frame.
+    if (slot.globalsFrame != m_frameIndex)
+    {
+        slot.globalsFrame = m_frameIndex;
+
+        // Time uniform (elapsed time since renderer creation)
+        shader.setUniform("u_time", m_shaderClock.getElapsedTime().asSeconds());
+
+        // Resolution uniform (screen dimensions)
+        const sf::Vector2u windowSize = m_target ? m_target->getSize() : sf::Vector2u{};
+        shader.setUniform("u_resolution",
+                          sf::Vector2f(static_cast<float>(windowSize.x), static_cast<float>(windowSize.y)));
+    }
+
+    // Material uniform set: only when it differs from what this shader last received. A material
+    // without uniforms (or no material) counts as the empty set, so it also clears the previous one.
+    const std::uint64_t uniformsHash = material ? material->getUniformsHash() : 0;
+    if (uniformsHash == slot.appliedUniformsHash)
+    {
+        return;
+    }
+    slot.appliedUniformsHash = uniformsHash;
+
+    static const std::vector<::Components::MaterialUniform> kNoUniforms;
+    const std::vector<::Components::MaterialUniform>&       uniforms = material ? material->getUniforms() : kNoUniforms;
+
+    // Reset what the previous set held and this one does not, so values cannot leak between materials.
+    for (const auto& applied : slot.appliedUniforms)
+    {
+        auto sameName = [&applied](const ::Components::MaterialUniform& u) { return u.name == applied.first; };
+        if (std::none_of(uniforms.begin(), uniforms.end(), sameName))
+        {
+            uploadMaterialUniform(shader, ::Components::MaterialUniform{applied.first, applied.second});
+        }
+    }
+
+    slot.appliedUniforms.clear();
+    for (const ::Components::MaterialUniform& uniform : uniforms)
+    {
+        uploadMaterialUniform(shader, uniform);
+        slot.appliedUniforms.emplace_back(uniform.name, uniform.type);
+    }
+}
+
+namespace
+{
+
+// Triangle fan around the origin over [startAngle, startAngle + sweep], expanded to a list.
+void appendUnitFan(std::vector<sf::Vector2f>& positions, int segments, float startAngle, float sweep)
+{
+    const float step = sweep / static_cast<float>(segments);
+    for (int i = 0; i < segments; ++i)
+    {
+        const float a0 = startAngle + step * static_cast<float>(i);
+        const float a1 = a0 + step;
+        positions.emplace_back(0.0f, 0.0f);
+        positions.emplace_back(0.5f * std::cos(a0), 0.5f * std::sin(a0));
+        positions.emplace_back(0.5f * std::cos(a1), 0.5f * std::sin(a1));
+    }
+}
+
+// Unit-space positions span [-0.5, 0.5], so texture coordinates are the position shifted by half.
+void fillUnitUvs(std::vector<sf::Vector2f>& uvs, const std::vector<sf::Vector2f>& positions)
+{
+    uvs.reserve(positions.size());
+    for (const sf::Vector2f& p : positions)
+    {
+        uvs.emplace_back(p.x + 0.5f, p.y + 0.5f);
+    }
+}
+
+constexpr int   kCircleSegments = 30;  ///< Matches sf::CircleShape's default point count
+constexpr float kMeshPi         = 3.14159265358979323846f;
+
+}  // namespace
+
+const SRenderer::UnitMesh& SRenderer::unitQuad()
+{
+    static const UnitMesh mesh = []
+    {
+        UnitMesh m;
+        m.positions = {{-0.5f, -0.5f}, {0.5f, -0.5f}, {0.5f, 0.5f}, {-0.5f, -0.5f}, {0.5f, 0.5f}, {-0.5f, 0.5f}};
+        fillUnitUvs(m.uvs, m.positions);
+        return m;
+    }();
+    return mesh;
+}
+
+const SRenderer::UnitMesh& SRenderer::unitCircle()
+{
+    static const UnitMesh mesh = []
+    {
+        UnitMesh m;
+        appendUnitFan(m.positions, kCircleSegments, 0.0f, 2.0f * kMeshPi);
+        fillUnitUvs(m.uvs, m.positions);
+        return m;
+    }();
+    return mesh;
+}
+
+const SRenderer::UnitMesh& SRenderer::unitHalfCircle()
+{
+    static const UnitMesh mesh = []
+    {
+        UnitMesh m;
+        appendUnitFan(m.positions, kCircleSegments / 2, -0.5f * kMeshPi, kMeshPi);
+        fillUnitUvs(m.uvs, m.positions);
+        return m;
+    }();
+    return mesh;
+}
+
+void SRenderer::batchMesh(const sf::RenderStates& states,
+                          const UnitMesh&         mesh,
+                          const sf::Transform&    transform,
+                          sf::Color               color,
+                          const sf::FloatRect*    textureRect)
+{
+    if (states.texture != m_batchStates.texture || states.shader != m_batchStates.shader
+        || states.blendMode != m_batchStates.blendMode)
+    {
+        flushBatch();
+        m_batchStates = states;
+    }
+
+    // Unit UVs map onto the texture region in pixels (the whole texture unless a rect is given).
+    sf::FloatRect region;
+    if (textureRect)
+    {
+        region = *textureRect;
+    }
+    else if (states.texture)
+    {
+        const sf::Vector2u size = states.texture->getSize();
+        region.size             = sf::Vector2f(static_cast<float>(size.x), static_cast<float>(size.y));
+    }
+
+    for (std::size_t i = 0; i < mesh.positions.size(); ++i)
+    {
+        const sf::Vector2f& uv = mesh.uvs[i];
+        m_batchVertices.append(sf::Vertex{transform.transformPoint(mesh.positions[i]),
+                                          color,
+                                          {region.position.x + uv.x * region.size.x,
+                                           region.position.y + uv.y * region.size.y}});
+    }
+
+    // Uniforms are per entity, so shaded meshes cannot share a draw.
+    if (states.shader)
+    {
+        flushBatch();
+    }
+}
+
+void SRenderer::flushBatch()
+{
+    if (m_batchVertices.getVertexCount() == 0)
+    {
+        return;
+    }
+
+    if (m_target)
+    {
+        m_target->draw(m_batchVertices, m_batchStates);
+        m_stats.recordDraw(m_batchStates.texture, m_batchStates.shader, m_batchVertices.getVertexCount());
+    }
+    m_batchVertices.clear();
+}
+
+void SRenderer::renderEntity(Entity entity, World& world)
+{
+    if (!entity.isValid())
+    {
+        return;
     }
 
     auto components = world.components();
@@ -692,34 +1694,32 @@ void SRenderer::renderEntity(Entity entity, World& world)
     }
 
     // Get texture if available (independent of material)
-    const sf::Texture* texture = nullptr;
+    const sf::Texture* texture     = nullptr;
+    auto*              textureComp = components.tryGet<::Components::CTexture>(entity);
+    if (textureComp)
     {
-        auto* textureComp = components.tryGet<::Components::CTexture>(entity);
-        if (textureComp)
+        // Resolve the path once; afterwards the hot path is a table lookup.
+        if (textureComp->textureHandle == kInvalidAssetHandle && !textureComp->getTexturePath().empty())
         {
-            const std::string& texturePath = textureComp->getTexturePath();
-            if (!texturePath.empty())
-            {
-                // Cache-only in the hot render path: if missing, queue it and draw fallback.
-                const std::filesystem::path resolvedPath = Internal::ExecutablePaths::resolveRelativeToExecutableDir(texturePath);
-                const std::string resolvedStr = resolvedPath.string();
-                texture                       = getCachedTexture(resolvedStr);
-                if (!texture)
-                {
-                    requestTextureLoad(texturePath);
-                }
-            }
+            textureComp->textureHandle = resolveTextureHandle(textureComp->getTexturePath());
         }
+        // Cache-only in the hot render path: if missing, it is queued and the fallback is drawn.
+        texture = getTexture(textureComp->textureHandle);
     }
 
     // Get shader if available (independent of material)
-    const sf::Shader* shader = nullptr;
+    AssetHandle       shaderHandle = kInvalidAssetHandle;
+    const sf::Shader* shader       = nullptr;
+    if (auto* shaderComp = components.tryGet<::Components::CShader>(entity))
     {
-        auto* shaderComp = components.tryGet<::Components::CShader>(entity);
-        if (shaderComp)
+        // Normally already resolved while building the render queue.
+        if (shaderComp->shaderHandle == kInvalidAssetHandle)
         {
-            shader = loadShader(shaderComp->getVertexShaderPath(), shaderComp->getFragmentShaderPath());
+            shaderComp->shaderHandle = resolveShaderHandle(shaderComp->getVertexShaderPath(),
+                                                           shaderComp->getFragmentShaderPath());
         }
+        shaderHandle = shaderComp->shaderHandle;
+        shader       = getShader(shaderHandle);
     }
 
     // Prepare render states
@@ -731,19 +1731,7 @@ void SRenderer::renderEntity(Entity entity, World& world)
     if (shader)
     {
         states.shader = shader;
-
-        // Set common shader uniforms
-        sf::Shader* mutableShader = const_cast<sf::Shader*>(shader);
-
-        // Time uniform (elapsed time since program start)
-        static sf::Clock shaderClock;
-        float            time = shaderClock.getElapsedTime().asSeconds();
-        mutableShader->setUniform("u_time", time);
-
-        // Resolution uniform (screen dimensions)
-        sf::Vector2u windowSize = m_window->getSize();
-        mutableShader->setUniform("u_resolution",
-                                  sf::Vector2f(static_cast<float>(windowSize.x), static_cast<float>(windowSize.y)));
+        applyShaderUniforms(shaderHandle, material);
     }
 
     // Render based on visual type
@@ -753,42 +1741,32 @@ void SRenderer::renderEntity(Entity entity, World& world)
     {
         case ::Components::VisualType::Rectangle:
         {
-            sf::RectangleShape rect;
+            sf::Vector2f size;
 
             // If we have a collider, use its size
             auto* collider = components.tryGet<::Components::CCollider2D>(entity);
             if (collider && collider->getShapeType() == ::Components::ColliderShape::Box)
             {
-                float halfWidth  = collider->getBoxHalfWidth();
-                float halfHeight = collider->getBoxHalfHeight();
-                rect.setSize(sf::Vector2f(halfWidth * 2.0f, halfHeight * 2.0f));
-                rect.setOrigin(sf::Vector2f{halfWidth, halfHeight});
+                size = sf::Vector2f(collider->getBoxHalfWidth() * 2.0f, collider->getBoxHalfHeight() * 2.0f);
             }
             else
             {
                 // Default rectangle size (pixels converted to meters)
                 constexpr float kDefaultSizeM = 50.0f / kPixelsPerMeter;
-                rect.setSize(sf::Vector2f(kDefaultSizeM * scale.x, kDefaultSizeM * scale.y));
-                rect.setOrigin(sf::Vector2f{(kDefaultSizeM * 0.5f) * scale.x, (kDefaultSizeM * 0.5f) * scale.y});
+                size                          = sf::Vector2f(kDefaultSizeM * scale.x, kDefaultSizeM * scale.y);
             }
 
-            rect.setPosition(sf::Vector2f{pos.x, pos.y});
-            rect.setRotation(sf::degrees(rotationDegrees));
-            rect.setFillColor(toSFMLColor(finalColor));
-
-            if (texture)
-            {
-                rect.setTexture(texture);
-            }
+            sf::Transform shapeTransform;
+            shapeTransform.translate(sf::Vector2f{pos.x, pos.y}).rotate(sf::degrees(rotationDegrees)).scale(size);
 
-            m_window->draw(rect, states);
+            sf::RenderStates shapeStates = states;
+            shapeStates.texture          = texture;
+            batchMesh(shapeStates, unitQuad(), shapeTransform, toSFMLColor(finalColor));
             break;
         }
 
         case ::Components::VisualType::Circle:
         {
-            sf::CircleShape circle;
-
             // If we have a collider, use its radius
             auto* collider = components.tryGet<::Components::CCollider2D>(entity);
             float radius   = 25.0f;
@@ -802,19 +1780,14 @@ void SRenderer::renderEntity(Entity entity, World& world)
                 radius = 25.0f / kPixelsPerMeter;
             }
 
-            circle.setRadius(radius);
-            circle.setOrigin(sf::Vector2f{radius, radius});
-            circle.setPosition(sf::Vector2f{pos.x, pos.y});
-            circle.setScale(sf::Vector2f{scale.x, scale.y});
-            circle.setRotation(sf::degrees(rotationDegrees));
-            circle.setFillColor(toSFMLColor(finalColor));
-
-            if (texture)
-            {
-                circle.setTexture(texture);
-            }
+            sf::Transform shapeTransform;
+            shapeTransform.translate(sf::Vector2f{pos.x, pos.y})
+                .rotate(sf::degrees(rotationDegrees))
+                .scale(sf::Vector2f{2.0f * radius * scale.x, 2.0f * radius * scale.y});
 
-            m_window->draw(circle, states);
+            sf::RenderStates shapeStates = states;
+            shapeStates.texture          = texture;
+            batchMesh(shapeStates, unitCircle(), shapeTransform, toSFMLColor(finalColor));
             break;
         }
 
@@ -822,71 +1795,24 @@ void SRenderer::renderEntity(Entity entity, World& world)
         {
             if (texture)
             {
-                sf::Sprite    sprite(*texture);
-                sf::FloatRect bounds = sprite.getLocalBounds();
+                // Drawn as a batched quad over the texture region (the whole texture, or an
+                // animation frame), laid out like an sf::Sprite over that region.
+                const sf::FloatRect region = textureRegion(*texture, textureComp);
+                const sf::FloatRect bounds({0.0f, 0.0f}, region.size);
+                sf::Vector2f        spriteScale;
+                sf::Vector2f        spriteOrigin;
 
                 // Align sprite to the physics collider by using the collider's local bounds.
                 // This ensures CTransform.position acts as the shared origin for physics + rendering.
                 auto* collider = components.tryGet<::Components::CCollider2D>(entity);
-                if (collider && !collider->fixtures.empty())
+                sf::Vector2f colliderMin;
+                sf::Vector2f colliderMax;
+                if (collider && colliderLocalBounds(*collider, colliderMin, colliderMax))
                 {
-                    float minX = std::numeric_limits<float>::infinity();
-                    float minY = std::numeric_limits<float>::infinity();
-                    float maxX = -std::numeric_limits<float>::infinity();
-                    float maxY = -std::numeric_limits<float>::infinity();
-
-                    auto includePoint = [&](const Vec2& p)
-                    {
-                        minX = std::min(minX, p.x);
-                        minY = std::min(minY, p.y);
-                        maxX = std::max(maxX, p.x);
-                        maxY = std::max(maxY, p.y);
-                    };
-
-                    for (const auto& f : collider->fixtures)
-                    {
-                        switch (f.shapeType)
-                        {
-                            case ::Components::ColliderShape::Circle:
-                            {
-                                const Vec2  c = f.circle.center;
-                                const float r = f.circle.radius;
-                                includePoint(Vec2{c.x - r, c.y - r});
-                                includePoint(Vec2{c.x + r, c.y + r});
-                                break;
-                            }
-                            case ::Components::ColliderShape::Box:
-                            {
-                                const float hw = f.box.halfWidth;
-                                const float hh = f.box.halfHeight;
-                                includePoint(Vec2{-hw, -hh});
-                                includePoint(Vec2{hw, hh});
-                                break;
-                            }
-                            case ::Components::ColliderShape::Polygon:
-                            {
-                                for (const auto& v : f.polygon.vertices)
-                                {
-                                    includePoint(v);
-                                }
-                                break;
-                            }
-                            case ::Components::ColliderShape::Segment:
-                            {
-                                includePoint(f.segment.point1);
-                                includePoint(f.segment.point2);
-                                break;
-                            }
-                            case ::Components::ColliderShape::ChainSegment:
-                            {
-                                includePoint(f.chainSegment.ghost1);
-                                includePoint(f.chainSegment.point1);
-                                includePoint(f.chainSegment.point2);
-                                includePoint(f.chainSegment.ghost2);
-                                break;
-                            }
-                        }
-                    }
+                    const float minX = colliderMin.x;
+                    const float minY = colliderMin.y;
+                    const float maxX = colliderMax.x;
+                    const float maxY = colliderMax.y;
 
                     const float worldWidth  = maxX - minX;
                     const float worldHeight = maxY - minY;
@@ -901,47 +1827,52 @@ void SRenderer::renderEntity(Entity entity, World& world)
                         const float targetWorld  = std::max(worldWidth, worldHeight);
                         const float spriteSizePx = std::max(1.0f, std::min(texWidthPx, texHeightPx));
                         const float uniformScale = targetWorld / spriteSizePx;
-                        sprite.setScale(sf::Vector2f{uniformScale * scale.x, uniformScale * scale.y});
+                        spriteScale              = sf::Vector2f{uniformScale * scale.x, uniformScale * scale.y};
 
                         // Map the body origin (0,0) into the collider bounds and use that as the sprite origin.
                         const float originXPx = bounds.position.x + ((0.0f - minX) / worldWidth) * texWidthPx;
                         const float originYPx = bounds.position.y + ((0.0f - minY) / worldHeight) * texHeightPx;
-                        sprite.setOrigin(sf::Vector2f{originXPx, originYPx});
+                        spriteOrigin          = sf::Vector2f{originXPx, originYPx};
                     }
                     else
                     {
                         const float baseScale = 1.0f / kPixelsPerMeter;
-                        sprite.setScale(sf::Vector2f{baseScale * scale.x, baseScale * scale.y});
-                        sprite.setOrigin(sf::Vector2f{bounds.position.x + bounds.size.x / 2.0f,
-                                                      bounds.position.y + bounds.size.y / 2.0f});
+                        spriteScale           = sf::Vector2f{baseScale * scale.x, baseScale * scale.y};
+                        spriteOrigin          = sf::Vector2f{bounds.position.x + bounds.size.x / 2.0f,
+                                                             bounds.position.y + bounds.size.y / 2.0f};
                     }
                 }
                 else
                 {
                     const float baseScale = 1.0f / kPixelsPerMeter;
-                    sprite.setScale(sf::Vector2f{baseScale * scale.x, baseScale * scale.y});
-                    sprite.setOrigin(sf::Vector2f{bounds.position.x + bounds.size.x / 2.0f,
-                                                  bounds.position.y + bounds.size.y / 2.0f});
+                    spriteScale           = sf::Vector2f{baseScale * scale.x, baseScale * scale.y};
+                    spriteOrigin          = sf::Vector2f{bounds.position.x + bounds.size.x / 2.0f,
+                                                         bounds.position.y + bounds.size.y / 2.0f};
                 }
 
-                sprite.setPosition(sf::Vector2f{pos.x, pos.y});
                 // Convention: +Y is forward at 0 radians. Most existing Example textures were authored
                 // "forward" pointing down (screen-space), so apply a 180° flip at render time.
-                sprite.setRotation(sf::degrees(rotationDegrees + 180.0f));
-                sprite.setColor(toSFMLColor(finalColor));
-
-                m_window->draw(sprite, states);
+                sf::Transform spriteTransform;
+                spriteTransform.translate(sf::Vector2f{pos.x, pos.y})
+                    .rotate(sf::degrees(rotationDegrees + 180.0f))
+                    .scale(spriteScale)
+                    .translate(-spriteOrigin)
+                    .scale(region.size)
+                    .translate(sf::Vector2f{0.5f, 0.5f});
+
+                sf::RenderStates spriteStates = states;
+                spriteStates.texture          = texture;
+                batchMesh(spriteStates, unitQuad(), spriteTransform, toSFMLColor(finalColor), &region);
             }
             else
             {
                 // Fallback: draw a rectangle if no texture
-                constexpr float    kDefaultSizeM = 50.0f / kPixelsPerMeter;
-                sf::RectangleShape rect(sf::Vector2f(kDefaultSizeM * scale.x, kDefaultSizeM * scale.y));
-                rect.setOrigin(sf::Vector2f{(kDefaultSizeM * 0.5f) * scale.x, (kDefaultSizeM * 0.5f) * scale.y});
-                rect.setPosition(sf::Vector2f{pos.x, pos.y});
-                rect.setRotation(sf::degrees(rotationDegrees));
-                rect.setFillColor(toSFMLColor(finalColor));
-                m_window->draw(rect, states);
+                constexpr float kDefaultSizeM = 50.0f / kPixelsPerMeter;
+                sf::Transform   shapeTransform;
+                shapeTransform.translate(sf::Vector2f{pos.x, pos.y})
+                    .rotate(sf::degrees(rotationDegrees))
+                    .scale(sf::Vector2f{kDefaultSizeM * scale.x, kDefaultSizeM * scale.y});
+                batchMesh(states, unitQuad(), shapeTransform, toSFMLColor(finalColor));
             }
             break;
         }
@@ -973,41 +1904,39 @@ void SRenderer::renderEntity(Entity entity, World& world)
             worldEnd.x = pos.x + (rotatedEnd.x * scale.x);
             worldEnd.y = pos.y + (rotatedEnd.y * scale.y);
 
-            // Create line using VertexArray
-            float           thickness = renderable->getLineThickness();
-            sf::Color       lineColor = toSFMLColor(finalColor);
-            sf::VertexArray line(sf::PrimitiveType::Lines, 2);
-            line[0].position = worldStart;
-            line[0].color    = lineColor;
-            line[1].position = worldEnd;
-            line[1].color    = lineColor;
-
-            // Draw the line (for thickness > 1, draw multiple times with offset)
-            if (thickness <= 1.0f)
+            // One quad per line. Thickness is in pixels at the nominal scale, like the default shape sizes.
+            const float     thickness = std::max(renderable->getLineThickness(), 1.0f) / kPixelsPerMeter;
+            const sf::Color lineColor = toSFMLColor(finalColor);
+
+            const sf::Vector2f direction = worldEnd - worldStart;
+            const float        length    = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+            if (length <= 0.0f)
             {
-                m_window->draw(line, states);
+                break;
             }
-            else
-            {
-                // Calculate perpendicular offset for thickness
-                sf::Vector2f direction = worldEnd - worldStart;
-                float        length    = std::sqrt(direction.x * direction.x + direction.y * direction.y);
-                if (length > 0.0f)
-                {
-                    sf::Vector2f perpendicular(-direction.y / length, direction.x / length);
 
-                    // Draw multiple lines with offset to simulate thickness
-                    int halfThickness = static_cast<int>(thickness / 2.0f);
-                    for (int offset = -halfThickness; offset <= halfThickness; ++offset)
-                    {
-                        sf::VertexArray thickLine(sf::PrimitiveType::Lines, 2);
-                        thickLine[0].position = worldStart + perpendicular * static_cast<float>(offset);
-                        thickLine[0].color    = lineColor;
-                        thickLine[1].position = worldEnd + perpendicular * static_cast<float>(offset);
-                        thickLine[1].color    = lineColor;
-                        m_window->draw(thickLine, states);
-                    }
-                }
+            const ::Components::LineCap cap       = renderable->getLineCap();
+            const sf::Angle             angle     = sf::radians(std::atan2(direction.y, direction.x));
+            const float                 extension = cap == ::Components::LineCap::Square ? thickness : 0.0f;
+
+            sf::Transform lineTransform;
+            lineTransform.translate((worldStart + worldEnd) * 0.5f)
+                .rotate(angle)
+                .scale(sf::Vector2f{length + extension, thickness});
+            batchMesh(states, unitQuad(), lineTransform, lineColor);
+
+            if (cap == ::Components::LineCap::Round)
+            {
+                // Half discs facing away from the line so translucent lines don't double-blend.
+                sf::Transform endCap;
+                endCap.translate(worldEnd).rotate(angle).scale(sf::Vector2f{thickness, thickness});
+                batchMesh(states, unitHalfCircle(), endCap, lineColor);
+
+                sf::Transform startCap;
+                startCap.translate(worldStart)
+                    .rotate(angle + sf::degrees(180.0f))
+                    .scale(sf::Vector2f{thickness, thickness});
+                batchMesh(states, unitHalfCircle(), startCap, lineColor);
             }
             break;
         }
@@ -36,6 +36,25 @@ Vec2 vec2FromJson(const json& j, const Vec2& fallback = Vec2{0.0f, 0.0f})
     return Vec2{j.value("x", fallback.x), j.value("y", fallback.y)};
 }
 
+json textureRectToJson(const Components::TextureRect& r)
+{
+    return json{{"left", r.left}, {"top", r.top}, {"width", r.width}, {"height", r.height}};
+}
+
+Components::TextureRect textureRectFromJson(const json& j)
+{
+    Components::TextureRect r;
+    if (!j.is_object())
+    {
+        return r;
+    }
+    r.left   = j.value("left", r.left);
+    r.top    = j.value("top", r.top);
+    r.width  = j.value("width", r.width);
+    r.height = j.value("height", r.height);
+    return r;
+}
+
 json colorToJson(const Color& c)
 {
     return json{{"r", c.r}, {"g", c.g}, {"b", c.b}, {"a", c.a}};
@@ -121,6 +140,31 @@ Components::VisualType visualTypeFromJson(const json& j)
     return enumFromIntOrString(j, Components::VisualType::None, byName);
 }
 
+std::string lineCapToString(Components::LineCap c)
+{
+    using LC = Components::LineCap;
+    switch (c)
+    {
+        case LC::Butt:
+            return "Butt";
+        case LC::Square:
+            return "Square";
+        case LC::Round:
+            return "Round";
+    }
+    return "Butt";
+}
+
+Components::LineCap lineCapFromJson(const json& j)
+{
+    static const std::unordered_map<std::string, Components::LineCap> byName = {
+        {"Butt", Components::LineCap::Butt},
+        {"Square", Components::LineCap::Square},
+        {"Round", Components::LineCap::Round},
+    };
+    return enumFromIntOrString(j, Components::LineCap::Butt, byName);
+}
+
 std::string blendModeToString(Components::BlendMode m)
 {
     using BM = Components::BlendMode;
@@ -149,6 +193,31 @@ Components::BlendMode blendModeFromJson(const json& j)
     return enumFromIntOrString(j, Components::BlendMode::Alpha, byName);
 }
 
+std::string uniformTypeToString(Components::UniformType t)
+{
+    using UT = Components::UniformType;
+    switch (t)
+    {
+        case UT::Float:
+            return "Float";
+        case UT::Vec2:
+            return "Vec2";
+        case UT::Color:
+            return "Color";
+    }
+    return "Float";
+}
+
+Components::UniformType uniformTypeFromJson(const json& j)
+{
+    static const std::unordered_map<std::string, Components::UniformType> byName = {
+        {"Float", Components::UniformType::Float},
+        {"Vec2", Components::UniformType::Vec2},
+        {"Color", Components::UniformType::Color},
+    };
+    return enumFromIntOrString(j, Components::UniformType::Float, byName);
+}
+
 std::string bodyTypeToString(Components::BodyType t)
 {
     using BT = Components::BodyType;
@@ -236,6 +305,80 @@ Components::EmissionShape emissionShapeFromJson(const json& j)
     return enumFromIntOrString(j, Components::EmissionShape::Point, byName);
 }
 
+std::string particleCollisionToString(Components::ParticleCollision c)
+{
+    using PC = Components::ParticleCollision;
+    switch (c)
+    {
+        case PC::None:
+            return "None";
+        case PC::Bounce:
+            return "Bounce";
+        case PC::Die:
+            return "Die";
+        case PC::Stick:
+            return "Stick";
+    }
+    return "None";
+}
+
+Components::ParticleCollision particleCollisionFromJson(const json& j)
+{
+    static const std::unordered_map<std::string, Components::ParticleCollision> byName = {
+        {"None", Components::ParticleCollision::None},
+        {"Bounce", Components::ParticleCollision::Bounce},
+        {"Die", Components::ParticleCollision::Die},
+        {"Stick", Components::ParticleCollision::Stick},
+    };
+    return enumFromIntOrString(j, Components::ParticleCollision::None, byName);
+}
+
+json floatCurveToJson(const Components::FloatCurve& curve)
+{
+    json keys = json::array();
+    for (const auto& key : curve.keys)
+    {
+        keys.push_back(json{{"time", key.time}, {"value", key.value}});
+    }
+    return keys;
+}
+
+Components::FloatCurve floatCurveFromJson(const json& j)
+{
+    Components::FloatCurve curve;
+    if (j.is_array())
+    {
+        for (const auto& key : j)
+        {
+            curve.addKey(key.value("time", 0.0f), key.value("value", 0.0f));
+        }
+    }
+    return curve;
+}
+
+json colorGradientToJson(const Components::ColorGradient& gradient)
+{
+    json keys = json::array();
+    for (const auto& key : gradient.keys)
+    {
+        keys.push_back(json{{"time", key.time}, {"color", colorToJson(key.color)}});
+    }
+    return keys;
+}
+
+Components::ColorGradient colorGradientFromJson(const json& j)
+{
+    Components::ColorGradient gradient;
+    if (j.is_array())
+    {
+        for (const auto& key : j)
+        {
+            gradient.addKey(key.value("time", 0.0f), colorFromJson(key.value("color", json{}), Color::White));
+        }
+    }
+    return gradient;
+}
+
 std::string actionTriggerToString(ActionTrigger t)
 {
     switch (t)
@@ -363,6 +506,9 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
                 {"lineStart", vec2ToJson(c->lineStart)},
                 {"lineEnd", vec2ToJson(c->lineEnd)},
                 {"lineThickness", c->lineThickness},
+                {"lineCap", lineCapToString(c->lineCap)},
+                {"static", c->staticLayer},
+                {"renderLayers", c->renderLayers},
             };
         },
         [](World& w, Entity e, const json& data, const LoadContext&)
@@ -375,6 +521,9 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
             r.lineStart     = vec2FromJson(data.value("lineStart", json{}), r.lineStart);
             r.lineEnd       = vec2FromJson(data.value("lineEnd", json{}), r.lineEnd);
             r.lineThickness = data.value("lineThickness", r.lineThickness);
+            r.lineCap       = lineCapFromJson(data.value("lineCap", json{}));
+            r.staticLayer   = data.value("static", r.staticLayer);
+            r.renderLayers  = data.value("renderLayers", r.renderLayers);
             w.add<Components::CRenderable>(e, r);
         });
 
@@ -401,15 +550,100 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
         [](const World& w, Entity e, const SaveContext&) -> json
         {
             const auto* c = w.get<Components::CTexture>(e);
-            return json{{"texturePath", c->texturePath}};
+            return json{{"texturePath", c->getTexturePath()}, {"textureRect", textureRectToJson(c->textureRect)}};
         },
         [](World& w, Entity e, const json& data, const LoadContext&)
         {
             Components::CTexture t;
-            t.texturePath = data.value("texturePath", t.texturePath);
+            t.setTexturePath(data.value("texturePath", t.getTexturePath()));
+            t.textureRect = textureRectFromJson(data.value("textureRect", json{}));
             w.add<Components::CTexture>(e, t);
         });
 
+    // CSpriteAnimation (frame table and playback settings; playback position is runtime only)
+    registry.registerComponent(
+        "CSpriteAnimation",
+        [](const World& w, Entity e) { return w.has<Components::CSpriteAnimation>(e); },
+        [](const World& w, Entity e, const SaveContext&) -> json
+        {
+            const auto* c      = w.get<Components::CSpriteAnimation>(e);
+            json        frames = json::array();
+            for (const auto& frame : c->frames)
+            {
+                frames.push_back(json{
+                    {"rect", textureRectToJson(frame.rect)},
+                    {"duration", frame.duration},
+                    {"event", frame.event},
+                });
+            }
+            return json{
+                {"frames", std::move(frames)},
+                {"speed", c->speed},
+                {"loop", c->loop},
+                {"playing", c->playing},
+            };
+        },
+        [](World& w, Entity e, const json& data, const LoadContext&)
+        {
+            Components::CSpriteAnimation a;
+            if (data.contains("frames") && data["frames"].is_array())
+            {
+                for (const auto& fj : data["frames"])
+                {
+                    Components::SpriteFrame frame;
+                    frame.rect     = textureRectFromJson(fj.value("rect", json{}));
+                    frame.duration = fj.value("duration", frame.duration);
+                    frame.event    = fj.value("event", frame.event);
+                    a.frames.push_back(std::move(frame));
+                }
+            }
+            a.speed   = data.value("speed", a.speed);
+            a.loop    = data.value("loop", a.loop);
+            a.playing = data.value("playing", a.playing);
+            w.add<Components::CSpriteAnimation>(e, a);
+        });
+
+    // CTilemap (chunk revisions and the resolved atlas handle are runtime only)
+    registry.registerComponent(
+        "CTilemap",
+        [](const World& w, Entity e) { return w.has<Components::CTilemap>(e); },
+        [](const World& w, Entity e, const SaveContext&) -> json
+        {
+            const auto* c = w.get<Components::CTilemap>(e);
+            return json{
+                {"atlasPath", c->getAtlasPath()},
+                {"tilePixelWidth", c->getTilePixelWidth()},
+                {"tilePixelHeight", c->getTilePixelHeight()},
+                {"tileSize", c->getTileSize()},
+                {"zIndex", c->zIndex},
+                {"visible", c->visible},
+                {"renderLayers", c->renderLayers},
+                {"width", c->getWidth()},
+                {"height", c->getHeight()},
+                {"tiles", c->getTiles()},
+            };
+        },
+        [](World& w, Entity e, const json& data, const LoadContext&)
+        {
+            Components::CTilemap t;
+            t.setAtlasPath(data.value("atlasPath", t.getAtlasPath()));
+            t.setTilePixelSize(data.value("tilePixelWidth", t.getTilePixelWidth()),
+                               data.value("tilePixelHeight", t.getTilePixelHeight()));
+            t.setTileSize(data.value("tileSize", t.getTileSize()));
+            t.zIndex       = data.value("zIndex", t.zIndex);
+            t.visible      = data.value("visible", t.visible);
+            t.renderLayers = data.value("renderLayers", t.renderLayers);
+            t.resize(data.value("width", 0u), data.value("height", 0u));
+
+            const auto tiles = data.value("tiles", std::vector<std::int32_t>{});
+            if (!t.setTiles(tiles) && !tiles.empty())
+            {
+                LOG_WARN(
+                    "CTilemap: expected {} tiles but found {}; map left empty", t.getTiles().size(), tiles.size());
+            }
+            w.add<Components::CTilemap>(e, t);
+        });
+
     // CShader
     registry.registerComponent(
         "CShader",
@@ -417,13 +651,14 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
         [](const World& w, Entity e, const SaveContext&) -> json
         {
             const auto* c = w.get<Components::CShader>(e);
-            return json{{"vertexShaderPath", c->vertexShaderPath}, {"fragmentShaderPath", c->fragmentShaderPath}};
+            return json{{"vertexShaderPath", c->getVertexShaderPath()},
+                        {"fragmentShaderPath", c->getFragmentShaderPath()}};
         },
         [](World& w, Entity e, const json& data, const LoadContext&)
         {
             Components::CShader s;
-            s.vertexShaderPath   = data.value("vertexShaderPath", s.vertexShaderPath);
-            s.fragmentShaderPath = data.value("fragmentShaderPath", s.fragmentShaderPath);
+            s.setVertexShaderPath(data.value("vertexShaderPath", s.getVertexShaderPath()));
+            s.setFragmentShaderPath(data.value("fragmentShaderPath", s.getFragmentShaderPath()));
             w.add<Components::CShader>(e, s);
         });
 
@@ -434,11 +669,25 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
         [](const World& w, Entity e, const SaveContext&) -> json
         {
             const auto* c = w.get<Components::CMaterial>(e);
-            return json{
+            json        j = json{
                 {"tint", colorToJson(c->tint)},
                 {"blendMode", blendModeToString(c->blendMode)},
                 {"opacity", c->opacity},
             };
+            if (!c->getUniforms().empty())
+            {
+                json uniforms = json::array();
+                for (const auto& u : c->getUniforms())
+                {
+                    uniforms.push_back(json{
+                        {"name", u.name},
+                        {"type", uniformTypeToString(u.type)},
+                        {"value", json::array({u.x, u.y, u.z, u.w})},
+                    });
+                }
+                j["uniforms"] = std::move(uniforms);
+            }
+            return j;
         },
         [](World& w, Entity e, const json& data, const LoadContext&)
         {
@@ -446,6 +695,42 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
             m.tint      = colorFromJson(data.value("tint", json{}), m.tint);
             m.blendMode = blendModeFromJson(data.value("blendMode", json{}));
             m.opacity   = data.value("opacity", m.opacity);
+            if (data.contains("uniforms") && data["uniforms"].is_array())
+            {
+                for (const auto& u : data["uniforms"])
+                {
+                    const std::string name = u.value("name", std::string{});
+                    if (name.empty())
+                    {
+                        continue;
+                    }
+                    float v[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+                    if (u.contains("value") && u["value"].is_array())
+                    {
+                        for (size_t i = 0; i < 4 && i < u["value"].size(); ++i)
+                        {
+                            v[i] = u["value"][i].get<float>();
+                        }
+                    }
+                    // Route through the setters so the uniform fingerprint stays current.
+                    switch (uniformTypeFromJson(u.value("type", json{})))
+                    {
+                        case Components::UniformType::Float:
+                            m.setUniform(name, v[0]);
+                            break;
+                        case Components::UniformType::Vec2:
+                            m.setUniform(name, Vec2(v[0], v[1]));
+                            break;
+                        case Components::UniformType::Color:
+                            m.setUniform(name,
+                                         Color(static_cast<uint8_t>(v[0] * 255.0f + 0.5f),
+                                               static_cast<uint8_t>(v[1] * 255.0f + 0.5f),
+                                               static_cast<uint8_t>(v[2] * 255.0f + 0.5f),
+                                               static_cast<uint8_t>(v[3] * 255.0f + 0.5f)));
+                            break;
+                    }
+                }
+            }
             w.add<Components::CMaterial>(e, m);
         });
 
@@ -520,16 +805,20 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
                 {"density", c->density},
                 {"friction", c->friction},
                 {"restitution", c->restitution},
+                {"categoryBits", c->categoryBits},
+                {"maskBits", c->maskBits},
                 {"fixtures", std::move(fixtures)},
             };
         },
         [](World& w, Entity e, const json& data, const LoadContext&)
         {
             Components::CCollider2D c;
-            c.sensor      = data.value("sensor", c.sensor);
-            c.density     = data.value("density", c.density);
-            c.friction    = data.value("friction", c.friction);
-            c.restitution = data.value("restitution", c.restitution);
+            c.sensor       = data.value("sensor", c.sensor);
+            c.density      = data.value("density", c.density);
+            c.friction     = data.value("friction", c.friction);
+            c.restitution  = data.value("restitution", c.restitution);
+            c.categoryBits = data.value("categoryBits", c.categoryBits);
+            c.maskBits     = data.value("maskBits", c.maskBits);
 
             if (data.contains("fixtures") && data["fixtures"].is_array())
             {
@@ -680,23 +969,31 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
             w.add<Components::CInputController>(e, c);
         });
 
-    // CAudioSource (persist configuration only; runtime play/stop requests are not persisted)
+    // CAudioSource (persist configuration only; playback is runtime state)
     registry.registerComponent(
         "CAudioSource",
         [](const World& w, Entity e) { return w.has<Components::CAudioSource>(e); },
         [](const World& w, Entity e, const SaveContext&) -> json
         {
             const auto* c = w.get<Components::CAudioSource>(e);
-            return json{{"clipId", c->clipId}, {"volume", c->volume}, {"loop", c->loop}};
+            return json{{"clipId", c->clipId},
+                        {"volume", c->volume},
+                        {"priority", c->priority},
+                        {"loop", c->loop},
+                        {"spatial", c->spatial},
+                        {"minDistance", c->minDistance},
+                        {"maxDistance", c->maxDistance}};
         },
         [](World& w, Entity e, const json& data, const LoadContext&)
         {
             Components::CAudioSource a;
-            a.clipId        = data.value("clipId", a.clipId);
-            a.volume        = data.value("volume", a.volume);
-            a.loop          = data.value("loop", a.loop);
-            a.playRequested = false;
-            a.stopRequested = false;
+            a.clipId      = data.value("clipId", a.clipId);
+            a.volume      = data.value("volume", a.volume);
+            a.priority    = data.value("priority", a.priority);
+            a.loop        = data.value("loop", a.loop);
+            a.spatial     = data.value("spatial", a.spatial);
+            a.minDistance = data.value("minDistance", a.minDistance);
+            a.maxDistance = data.value("maxDistance", a.maxDistance);
             w.add<Components::CAudioSource>(e, a);
         });
 
@@ -707,13 +1004,15 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
         [](const World& w, Entity e, const SaveContext&) -> json
         {
             const auto* c = w.get<Components::CAudioListener>(e);
-            return json{{"masterVolume", c->masterVolume}, {"musicVolume", c->musicVolume}};
+            return json{
+                {"masterVolume", c->masterVolume}, {"musicVolume", c->musicVolume}, {"panDistance", c->panDistance}};
         },
         [](World& w, Entity e, const json& data, const LoadContext&)
         {
             Components::CAudioListener l;
             l.masterVolume = data.value("masterVolume", l.masterVolume);
             l.musicVolume  = data.value("musicVolume", l.musicVolume);
+            l.panDistance  = data.value("panDistance", l.panDistance);
             w.add<Components::CAudioListener>(e, l);
         });
 
@@ -762,6 +1061,7 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
                 {"enabled", c->enabled},
                 {"render", c->render},
                 {"renderOrder", c->renderOrder},
+                {"cullingMask", c->cullingMask},
                 {"followTarget", entityRefToJson(c->followTarget, ctx)},
                 {"followEnabled", c->followEnabled},
                 {"followOffset", vec2ToJson(c->followOffset)},
@@ -781,6 +1081,7 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
             c.enabled     = data.value("enabled", c.enabled);
             c.render      = data.value("render", c.render);
             c.renderOrder = data.value("renderOrder", c.renderOrder);
+            c.cullingMask = data.value("cullingMask", c.cullingMask);
 
             c.followTarget  = entityRefFromJson(data.value("followTarget", json{}), ctx);
             c.followEnabled = data.value("followEnabled", c.followEnabled);
@@ -848,7 +1149,17 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
                 {"fadeOut", c->getFadeOut()},
                 {"shrink", c->getShrink()},
                 {"shrinkEndScale", c->getShrinkEndScale()},
+                {"colorGradient", colorGradientToJson(c->getColorGradient())},
+                {"alphaCurve", floatCurveToJson(c->getAlphaCurve())},
+                {"sizeCurve", floatCurveToJson(c->getSizeCurve())},
+                {"speedCurve", floatCurveToJson(c->getSpeedCurve())},
                 {"maxParticles", c->getMaxParticles()},
+                {"importance", c->getImportance()},
+                {"collisionMode", particleCollisionToString(c->getCollisionMode())},
+                {"collisionCategory", c->getCollisionCategory()},
+                {"collisionMask", c->getCollisionMask()},
+                {"collisionRestitution", c->getCollisionRestitution()},
+                {"collisionFriction", c->getCollisionFriction()},
                 {"positionOffset", vec2ToJson(c->getPositionOffset())},
                 {"emissionShape", emissionShapeToString(c->getEmissionShape())},
                 {"shapeRadius", c->getShapeRadius()},
@@ -860,6 +1171,7 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
                 {"polygonVertices", std::move(polygon)},
                 {"texturePath", c->getTexturePath()},
                 {"zIndex", c->getZIndex()},
+                {"renderLayers", c->getRenderLayers()},
             };
         },
         [](World& w, Entity e, const json& data, const LoadContext&)
@@ -886,7 +1198,17 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
             p.setFadeOut(data.value("fadeOut", p.getFadeOut()));
             p.setShrink(data.value("shrink", p.getShrink()));
             p.setShrinkEndScale(data.value("shrinkEndScale", p.getShrinkEndScale()));
+            p.setColorGradient(colorGradientFromJson(data.value("colorGradient", json{})));
+            p.setAlphaCurve(floatCurveFromJson(data.value("alphaCurve", json{})));
+            p.setSizeCurve(floatCurveFromJson(data.value("sizeCurve", json{})));
+            p.setSpeedCurve(floatCurveFromJson(data.value("speedCurve", json{})));
             p.setMaxParticles(data.value("maxParticles", p.getMaxParticles()));
+            p.setImportance(data.value("importance", p.getImportance()));
+            p.setCollisionMode(particleCollisionFromJson(data.value("collisionMode", json{})));
+            p.setCollisionCategory(data.value("collisionCategory", p.getCollisionCategory()));
+            p.setCollisionMask(data.value("collisionMask", p.getCollisionMask()));
+            p.setCollisionRestitution(data.value("collisionRestitution", p.getCollisionRestitution()));
+            p.setCollisionFriction(data.value("collisionFriction", p.getCollisionFriction()));
             p.setPositionOffset(vec2FromJson(data.value("positionOffset", json{}), p.getPositionOffset()));
 
             p.setEmissionShape(emissionShapeFromJson(data.value("emissionShape", json{})));
@@ -911,6 +1233,7 @@ void registerBuiltInJsonComponentSerializers(ComponentSerializationRegistry& reg
 
             p.setTexturePath(data.value("texturePath", p.getTexturePath()));
             p.setZIndex(data.value("zIndex", p.getZIndex()));
+            p.setRenderLayers(data.value("renderLayers", p.getRenderLayers()));
 
             // Runtime state intentionally reset.
             p.getParticles().clear();
@@ -5,9 +5,9 @@
 #include <vector>
 
 #include <SFML/Graphics/Font.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 
 #include <Logger.h>
 #include <SRenderer.h>
@@ -73,16 +73,16 @@ void UIRenderer::setDefaultFontPath(std::string fontPath)
 
 void UIRenderer::render(const UIContext& context, Systems::SRenderer& renderer)
 {
-    sf::RenderWindow* window = renderer.getWindow();
-    if (!window)
+    sf::RenderTarget* target = renderer.getRenderTarget();
+    if (!target)
     {
         return;
     }
 
     // UI is screen-space (pixels), so ensure default view.
-    window->setView(window->getDefaultView());
+    target->setView(target->getDefaultView());
 
-    const auto   winSize = window->getSize();
+    const auto   winSize = target->getSize();
     const UIRect viewportRectPx{0.0f, 0.0f, static_cast<float>(winSize.x), static_cast<float>(winSize.y)};
     context.setViewportRectPx(viewportRectPx);
     context.layout(viewportRectPx);
@@ -95,17 +95,46 @@ void UIRenderer::render(const UIContext& context, Systems::SRenderer& renderer)
                      commands.end(),
                      [](const UIDrawCommand& a, const UIDrawCommand& b) { return a.z < b.z; });
 
+    Systems::RenderStats& stats = renderer.getRenderStats();
+    stats.uiCommands += commands.size();
+
+    // Consecutive rects share one draw; text breaks the batch to keep z order.
+    sf::VertexArray rects(sf::PrimitiveType::Triangles);
+    auto            flushRects = [&]()
+    {
+        if (rects.getVertexCount() > 0)
+        {
+            target->draw(rects);
+            stats.recordDraw(nullptr, nullptr, rects.getVertexCount());
+            rects.clear();
+        }
+    };
+
     for (const auto& cmd : commands)
     {
         if (std::holds_alternative<UIDrawRect>(cmd.payload))
         {
             const auto& r = std::get<UIDrawRect>(cmd.payload);
 
-            sf::RectangleShape rect;
-            rect.setPosition(sf::Vector2f{r.rectPx.x, r.rectPx.y});
-            rect.setSize(sf::Vector2f{r.rectPx.w, r.rectPx.h});
-            rect.setFillColor(toSFMLColor(r.color));
-            window->draw(rect);
+            const sf::Color    color = toSFMLColor(r.color);
+            const sf::Vector2f topLeft{r.rectPx.x, r.rectPx.y};
+            const sf::Vector2f topRight{r.rectPx.x + r.rectPx.w, r.rectPx.y};
+            const sf::Vector2f bottomRight{r.rectPx.x + r.rectPx.w, r.rectPx.y + r.rectPx.h};
+            const sf::Vector2f bottomLeft{r.rectPx.x, r.rectPx.y + r.rectPx.h};
+
+            auto appendVertex = [&rects, &color](const sf::Vector2f& position)
+            {
+                sf::Vertex vertex;
+                vertex.position = position;
+                vertex.color    = color;
+                rects.append(vertex);
+            };
+            appendVertex(topLeft);
+            appendVertex(topRight);
+            appendVertex(bottomRight);
+            appendVertex(topLeft);
+            appendVertex(bottomRight);
+            appendVertex(bottomLeft);
             continue;
         }
 
@@ -120,13 +149,18 @@ void UIRenderer::render(const UIContext& context, Systems::SRenderer& renderer)
                 continue;
             }
 
+            flushRects();
             sf::Text text(*font, sf::String(t.text), t.sizePx);
             text.setFillColor(toSFMLColor(t.color));
             text.setPosition(sf::Vector2f{t.positionPx.x, t.positionPx.y});
-            window->draw(text);
+            target->draw(text);
+            // Approximate: one glyph quad per character.
+            stats.recordDraw(&font->getTexture(t.sizePx), nullptr, t.text.size() * 6);
             continue;
         }
     }
+
+    flushRects();
 }
 
 }  // namespace UI
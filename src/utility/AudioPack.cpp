@@ -0,0 +1,302 @@
+#include "AudioPack.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "FileUtilities.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Internal
+{
+
+namespace
+{
+
+constexpr char        kMagic[4]       = {'E', 'F', 'A', 'P'};
+constexpr std::size_t kHeaderSize     = 16;  ///< Magic, version, entry count, index size
+constexpr std::size_t kIndexEntrySize = 24;  ///< Offset, size, name offset, name length
+
+std::uint32_t readU32(const std::uint8_t* p)
+{
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8u)
+           | (static_cast<std::uint32_t>(p[2]) << 16u) | (static_cast<std::uint32_t>(p[3]) << 24u);
+}
+
+std::uint64_t readU64(const std::uint8_t* p)
+{
+    return static_cast<std::uint64_t>(readU32(p)) | (static_cast<std::uint64_t>(readU32(p + 4)) << 32u);
+}
+
+void appendU32(std::vector<std::uint8_t>& out, std::uint32_t value)
+{
+    for (unsigned int shift = 0; shift < 32u; shift += 8u)
+    {
+        out.push_back(static_cast<std::uint8_t>(value >> shift));
+    }
+}
+
+void appendU64(std::vector<std::uint8_t>& out, std::uint64_t value)
+{
+    appendU32(out, static_cast<std::uint32_t>(value));
+    appendU32(out, static_cast<std::uint32_t>(value >> 32u));
+}
+
+std::size_t alignUp(std::size_t value)
+{
+    return (value + AudioPack::kPayloadAlignment - 1) & ~(AudioPack::kPayloadAlignment - 1);
+}
+
+}  // namespace
+
+AudioPack::~AudioPack()
+{
+    close();
+}
+
+bool AudioPack::open(const std::filesystem::path& path, std::string* outError)
+{
+    close();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileW(
+        path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return fail(outError, "could not open '" + path.string() + "'");
+    }
+    m_file = file;
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        return fail(outError, "could not size '" + path.string() + "'");
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        return fail(outError, "could not map '" + path.string() + "'");
+    }
+    m_mapping = mapping;
+
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        return fail(outError, "could not map '" + path.string() + "'");
+    }
+    m_data = static_cast<const std::uint8_t*>(view);
+    m_size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return fail(outError, "could not open '" + path.string() + "'");
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0)
+    {
+        ::close(fd);
+        return fail(outError, "could not size '" + path.string() + "'");
+    }
+
+    // The mapping keeps its own reference to the file, so the descriptor can go right away.
+    void* view = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED)
+    {
+        return fail(outError, "could not map '" + path.string() + "'");
+    }
+    m_data = static_cast<const std::uint8_t*>(view);
+    m_size = static_cast<std::size_t>(info.st_size);
+#endif
+
+    if (m_size < kHeaderSize || !std::equal(kMagic, kMagic + 4, m_data))
+    {
+        return fail(outError, "'" + path.string() + "' is not an audio pack");
+    }
+    if (readU32(m_data + 4) != kVersion)
+    {
+        return fail(outError, "'" + path.string() + "' has unsupported version " + std::to_string(readU32(m_data + 4)));
+    }
+
+    const std::size_t count      = readU32(m_data + 8);
+    const std::size_t indexSize  = readU32(m_data + 12);
+    const std::size_t namesBegin = kHeaderSize + count * kIndexEntrySize;
+    if (namesBegin > kHeaderSize + indexSize || kHeaderSize + indexSize > m_size)
+    {
+        return fail(outError, "'" + path.string() + "' has a truncated index");
+    }
+
+    m_entries.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::uint8_t* entry      = m_data + kHeaderSize + i * kIndexEntrySize;
+        const std::uint64_t offset     = readU64(entry);
+        const std::uint64_t size       = readU64(entry + 8);
+        const std::size_t   nameOffset = readU32(entry + 16);
+        const std::size_t   nameLength = readU32(entry + 20);
+
+        if (namesBegin + nameOffset + nameLength > kHeaderSize + indexSize || offset > m_size || size > m_size - offset)
+        {
+            return fail(outError, "'" + path.string() + "' has an entry out of bounds");
+        }
+
+        std::string name(reinterpret_cast<const char*>(m_data + namesBegin + nameOffset), nameLength);
+        m_entries.emplace(std::move(name),
+                          AudioPackView{m_data + static_cast<std::size_t>(offset), static_cast<std::size_t>(size)});
+    }
+    return true;
+}
+
+void AudioPack::close()
+{
+    m_entries.clear();
+#if defined(_WIN32)
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mapping)
+    {
+        CloseHandle(static_cast<HANDLE>(m_mapping));
+    }
+    if (m_file)
+    {
+        CloseHandle(static_cast<HANDLE>(m_file));
+    }
+    m_mapping = nullptr;
+    m_file    = nullptr;
+#else
+    if (m_data)
+    {
+        ::munmap(const_cast<std::uint8_t*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+}
+
+const AudioPackView* AudioPack::find(const std::string& name) const
+{
+    auto it = m_entries.find(normalizeName(name));
+    return it != m_entries.end() ? &it->second : nullptr;
+}
+
+std::string AudioPack::normalizeName(const std::string& name)
+{
+    std::string normalized = name;
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    while (normalized.compare(0, 2, "./") == 0)
+    {
+        normalized.erase(0, 2);
+    }
+    return normalized;
+}
+
+bool AudioPack::write(const std::filesystem::path&        outPath,
+                      const std::vector<AudioPackSource>& sources,
+                      std::string*                        outError)
+{
+    auto setError = [outError](const std::string& message)
+    {
+        if (outError)
+        {
+            *outError = message;
+        }
+        return false;
+    };
+
+    std::vector<std::string>               names;
+    std::vector<std::vector<std::uint8_t>> payloads;
+    std::unordered_set<std::string>        seen;
+    std::size_t                            nameBytes = 0;
+    for (const AudioPackSource& source : sources)
+    {
+        std::string name = normalizeName(source.name);
+        if (!seen.insert(name).second)
+        {
+            return setError("duplicate entry '" + name + "'");
+        }
+        try
+        {
+            payloads.push_back(FileUtilities::readFileBinary(source.file));
+        }
+        catch (const std::exception& e)
+        {
+            return setError(e.what());
+        }
+        nameBytes += name.size();
+        names.push_back(std::move(name));
+    }
+
+    const std::size_t indexSize = names.size() * kIndexEntrySize + nameBytes;
+
+    std::vector<std::uint8_t> head;
+    head.insert(head.end(), kMagic, kMagic + 4);
+    appendU32(head, kVersion);
+    appendU32(head, static_cast<std::uint32_t>(names.size()));
+    appendU32(head, static_cast<std::uint32_t>(indexSize));
+
+    std::vector<std::size_t> offsets;
+    std::size_t              offset     = alignUp(kHeaderSize + indexSize);
+    std::size_t              nameOffset = 0;
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        offsets.push_back(offset);
+        appendU64(head, offset);
+        appendU64(head, payloads[i].size());
+        appendU32(head, static_cast<std::uint32_t>(nameOffset));
+        appendU32(head, static_cast<std::uint32_t>(names[i].size()));
+        nameOffset += names[i].size();
+        offset = alignUp(offset + payloads[i].size());
+    }
+    for (const std::string& name : names)
+    {
+        head.insert(head.end(), name.begin(), name.end());
+    }
+
+    std::ofstream out(outPath, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        return setError("could not create '" + outPath.string() + "'");
+    }
+    out.write(reinterpret_cast<const char*>(head.data()), static_cast<std::streamsize>(head.size()));
+
+    std::size_t written = head.size();
+    for (std::size_t i = 0; i < payloads.size(); ++i)
+    {
+        const std::vector<char> padding(offsets[i] - written, '\0');
+        out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        out.write(reinterpret_cast<const char*>(payloads[i].data()), static_cast<std::streamsize>(payloads[i].size()));
+        written = offsets[i] + payloads[i].size();
+    }
+
+    if (!out)
+    {
+        return setError("could not write '" + outPath.string() + "'");
+    }
+    return true;
+}
+
+bool AudioPack::fail(std::string* outError, const std::string& message)
+{
+    close();
+    if (outError)
+    {
+        *outError = message;
+    }
+    return false;
+}
+
+}  // namespace Internal
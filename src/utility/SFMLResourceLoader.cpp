@@ -104,10 +104,18 @@ bool SFMLResourceLoader::loadSoundBufferFromFileBytes(const std::filesystem::pat
         return false;
     }
 
+    return loadSoundBufferFromMemory(bytes.data(), bytes.size(), outBuffer, outError);
+}
+
+bool SFMLResourceLoader::loadSoundBufferFromMemory(const void*      data,
+                                                   std::size_t      size,
+                                                   sf::SoundBuffer& outBuffer,
+                                                   std::string*     outError)
+{
     bool loaded = false;
     try
     {
-        loaded = outBuffer.loadFromMemory(bytes.data(), bytes.size());
+        loaded = outBuffer.loadFromMemory(data, size);
     }
     catch (const std::exception& e)
     {
@@ -0,0 +1,151 @@
+#include "SoundBankLoader.h"
+
+#include <algorithm>
+#include <filesystem>
+
+#include "SFMLResourceLoader.h"
+
+namespace Internal
+{
+
+SoundBankLoader::SoundBankLoader(std::size_t workerCount) : m_workerCount(workerCount)
+{
+    if (m_workerCount == 0)
+    {
+        // Decoding is IO-heavy and bursty (level loads); keep most cores for the game loop.
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        m_workerCount               = std::clamp<std::size_t>(hardware / 2u, 1u, 4u);
+    }
+}
+
+SoundBankLoader::~SoundBankLoader()
+{
+    stopWorkers();
+}
+
+void SoundBankLoader::request(const std::string& id, const std::string& resolvedPath, std::uint64_t ticket)
+{
+    ensureWorkers();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(DecodeJob{id, resolvedPath, ticket, m_generation, nullptr, 0});
+    }
+    ++m_pendingCount;
+    m_jobsReady.notify_one();
+}
+
+void SoundBankLoader::requestFromMemory(const std::string& id, const void* data, std::size_t size, std::uint64_t ticket)
+{
+    ensureWorkers();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(DecodeJob{id, std::string{}, ticket, m_generation, data, size});
+    }
+    ++m_pendingCount;
+    m_jobsReady.notify_one();
+}
+
+std::size_t SoundBankLoader::collect(std::vector<SoundLoadResult>& out)
+{
+    if (m_readyCount.load(std::memory_order_acquire) == 0)
+    {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const std::size_t           count = m_results.size();
+    for (SoundLoadResult& result : m_results)
+    {
+        out.push_back(std::move(result));
+    }
+    m_results.clear();
+    m_readyCount.store(0, std::memory_order_relaxed);
+    m_pendingCount -= std::min(m_pendingCount, count);
+    return count;
+}
+
+void SoundBankLoader::cancelAll()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_generation;
+    m_jobs.clear();
+    m_results.clear();
+    m_readyCount.store(0, std::memory_order_relaxed);
+    m_pendingCount = 0;
+}
+
+void SoundBankLoader::ensureWorkers()
+{
+    if (!m_workers.empty())
+    {
+        return;
+    }
+
+    m_workers.reserve(m_workerCount);
+    for (std::size_t i = 0; i < m_workerCount; ++i)
+    {
+        m_workers.emplace_back(&SoundBankLoader::workerLoop, this);
+    }
+}
+
+void SoundBankLoader::workerLoop()
+{
+    for (;;)
+    {
+        DecodeJob job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobsReady.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+            if (m_stopping)
+            {
+                return;
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        // CPU-only work: file IO and decoding. No audio device calls on this thread.
+        SoundLoadResult result{job.id, job.path, job.ticket, false, sf::SoundBuffer{}, std::string{}};
+
+        std::error_code ec;
+        if (job.data)
+        {
+            result.ok = SFMLResourceLoader::loadSoundBufferFromMemory(job.data, job.size, result.buffer, &result.error);
+        }
+        else if (!std::filesystem::exists(job.path, ec))
+        {
+            result.error = ec ? ec.message() : std::string("file does not exist");
+        }
+        else
+        {
+            result.ok = SFMLResourceLoader::loadSoundBufferFromFileBytes(job.path, result.buffer, &result.error);
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (job.generation == m_generation)
+        {
+            m_results.push_back(std::move(result));
+            m_readyCount.store(m_results.size(), std::memory_order_release);
+        }
+    }
+}
+
+void SoundBankLoader::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_jobsReady.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    m_workers.clear();
+}
+
+}  // namespace Internal
@@ -0,0 +1,413 @@
+#include "TextureLoader.h"
+
+#include <algorithm>
+#include <filesystem>
+
+#include "ExecutablePaths.h"
+#include "Logger.h"
+#include "SFMLResourceLoader.h"
+
+namespace Internal
+{
+
+namespace
+{
+
+std::size_t imageBytes(const sf::Image& image)
+{
+    const sf::Vector2u size = image.getSize();
+    return static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4u;
+}
+
+}  // namespace
+
+TextureLoader::TextureLoader(std::size_t workerCount) : m_workerCount(workerCount)
+{
+    if (m_workerCount == 0)
+    {
+        // Decoding is bursty; a couple of threads keep up without competing with the game loop.
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        m_workerCount               = std::clamp<std::size_t>(hardware / 2u, 1u, 4u);
+    }
+}
+
+TextureLoader::~TextureLoader()
+{
+    stopWorkers();
+}
+
+AssetHandle TextureLoader::resolve(const std::string& filepath)
+{
+    if (filepath.empty())
+    {
+        return kInvalidAssetHandle;
+    }
+
+    auto byPath = m_handlesByPath.find(filepath);
+    if (byPath != m_handlesByPath.end())
+    {
+        return byPath->second;
+    }
+
+    const std::filesystem::path resolvedPath = ExecutablePaths::resolveRelativeToExecutableDir(filepath);
+    std::string                 resolvedStr  = resolvedPath.string();
+
+    if (resolvedStr.empty())
+    {
+        return kInvalidAssetHandle;
+    }
+
+    // Different spellings of the same file share one slot.
+    AssetHandle handle     = kInvalidAssetHandle;
+    auto        byResolved = m_handlesByResolvedPath.find(resolvedStr);
+    if (byResolved != m_handlesByResolvedPath.end())
+    {
+        handle = byResolved->second;
+    }
+    else
+    {
+        handle = static_cast<AssetHandle>(m_slots.size());
+        m_handlesByResolvedPath.emplace(resolvedStr, handle);
+
+        Slot slot;
+        slot.resolvedPath = std::move(resolvedStr);
+        m_slots.push_back(std::move(slot));
+    }
+
+    m_handlesByPath.emplace(filepath, handle);
+    return handle;
+}
+
+const sf::Texture* TextureLoader::get(AssetHandle handle)
+{
+    if (handle >= m_slots.size())
+    {
+        return nullptr;
+    }
+
+    Slot& slot         = m_slots[handle];
+    slot.lastUsedFrame = m_frame;
+    if (slot.state == SlotState::Resident)
+    {
+        ++m_stats.hits;
+        lruTouch(handle);
+        return slot.texture.get();
+    }
+
+    ++m_stats.misses;
+    if (slot.state == SlotState::Unloaded)
+    {
+        setState(slot, SlotState::Pending);
+        ensureWorkers();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_jobs.push_back(DecodeJob{handle, m_generation, slot.resolvedPath});
+        }
+        m_jobsReady.notify_one();
+    }
+    return nullptr;
+}
+
+const sf::Texture* TextureLoader::loadNow(AssetHandle handle, const char* context)
+{
+    if (handle >= m_slots.size())
+    {
+        return nullptr;
+    }
+
+    Slot& slot         = m_slots[handle];
+    slot.lastUsedFrame = m_frame;
+    if (slot.state == SlotState::Resident)
+    {
+        ++m_stats.hits;
+        lruTouch(handle);
+        return slot.texture.get();
+    }
+
+    ++m_stats.misses;
+    // If a decode is already in flight its result is dropped on arrival (the slot is resident by then).
+    sf::Image   image;
+    std::string loadError;
+    if (!SFMLResourceLoader::loadImageFromFileBytes(slot.resolvedPath, image, &loadError))
+    {
+        LOG_WARN("{}: failed to load '{}' : {}", context, slot.resolvedPath, loadError);
+        setState(slot, SlotState::Failed);
+        return nullptr;
+    }
+
+    if (!upload(handle, image, context))
+    {
+        return nullptr;
+    }
+    return slot.texture.get();
+}
+
+std::size_t TextureLoader::uploadPending(std::size_t byteBudget)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (DecodeResult& result : m_results)
+        {
+            m_decoded.push_back(std::move(result));
+        }
+        m_results.clear();
+    }
+
+    static uint64_t s_debugUploadsLogged = 0;
+
+    std::size_t uploaded     = 0;
+    std::size_t uploadsCount = 0;
+    while (!m_decoded.empty())
+    {
+        DecodeResult& result = m_decoded.front();
+
+        // Drop results from before a clear() or for slots that were loaded synchronously meanwhile.
+        if (result.generation != m_generation || result.handle >= m_slots.size()
+            || m_slots[result.handle].state != SlotState::Pending)
+        {
+            m_decoded.pop_front();
+            continue;
+        }
+
+        Slot& slot = m_slots[result.handle];
+        if (!result.ok)
+        {
+            LOG_WARN("TextureLoader: failed to load '{}' : {}", slot.resolvedPath, result.error);
+            setState(slot, SlotState::Failed);
+            m_decoded.pop_front();
+            continue;
+        }
+
+        const std::size_t bytes = imageBytes(result.image);
+        if (uploaded + bytes > byteBudget && (uploadsCount > 0 || byteBudget == 0))
+        {
+            break;
+        }
+
+        if (upload(result.handle, result.image, "TextureLoader::uploadPending"))
+        {
+            uploaded += bytes;
+            ++uploadsCount;
+
+            if (s_debugUploadsLogged < 32)
+            {
+                LOG_INFO("TextureLoader::uploadPending: cached '{}' ({} bytes)", slot.resolvedPath, bytes);
+                ++s_debugUploadsLogged;
+            }
+        }
+        m_decoded.pop_front();
+    }
+
+    trimToBudget();
+    return uploaded;
+}
+
+std::size_t TextureLoader::trimToBudget()
+{
+    if (!isOverBudget())
+    {
+        return 0;
+    }
+
+    // Walk from the least recently used end. The list is ordered by last use, so the first texture
+    // used this frame or last frame marks the start of the working set and ends the walk.
+    std::size_t evicted = 0;
+    while (isOverBudget() && m_lruHead != kInvalidAssetHandle)
+    {
+        const AssetHandle handle = m_lruHead;
+        const Slot&       slot   = m_slots[handle];
+        if (slot.lastUsedFrame + 1 >= m_frame)
+        {
+            break;
+        }
+        LOG_DEBUG("TextureLoader: evicting '{}' ({} bytes, idle since frame {})",
+                  slot.resolvedPath,
+                  slot.bytes,
+                  slot.lastUsedFrame);
+        release(handle);
+        ++m_stats.evictions;
+        ++evicted;
+    }
+    return evicted;
+}
+
+void TextureLoader::clear()
+{
+    // Handles stay valid; slots simply become non-resident and reload on next use.
+    for (AssetHandle handle = 0; handle < m_slots.size(); ++handle)
+    {
+        release(handle);
+    }
+
+    ++m_generation;
+    m_decoded.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.clear();
+        m_results.clear();
+    }
+}
+
+void TextureLoader::ensureWorkers()
+{
+    if (!m_workers.empty())
+    {
+        return;
+    }
+
+    m_workers.reserve(m_workerCount);
+    for (std::size_t i = 0; i < m_workerCount; ++i)
+    {
+        m_workers.emplace_back(&TextureLoader::workerLoop, this);
+    }
+}
+
+void TextureLoader::workerLoop()
+{
+    for (;;)
+    {
+        DecodeJob job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobsReady.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+            if (m_stopping)
+            {
+                return;
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        // CPU-only work: file IO and image decode. No OpenGL calls on this thread.
+        DecodeResult result{job.handle, job.generation, false, sf::Image{}, std::string{}};
+
+        std::error_code ec;
+        if (!std::filesystem::exists(job.path, ec))
+        {
+            result.error = ec ? ec.message() : std::string("file does not exist");
+        }
+        else
+        {
+            result.ok = SFMLResourceLoader::loadImageFromFileBytes(job.path, result.image, &result.error);
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_results.push_back(std::move(result));
+    }
+}
+
+void TextureLoader::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_jobsReady.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    m_workers.clear();
+}
+
+bool TextureLoader::upload(AssetHandle handle, const sf::Image& image, const char* context)
+{
+    Slot& slot = m_slots[handle];
+    auto texture = std::make_unique<sf::Texture>();
+    bool loaded  = false;
+    try
+    {
+        loaded = texture->loadFromImage(image);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARN("{}: exception uploading '{}' : {}", context, slot.resolvedPath, e.what());
+    }
+
+    if (!loaded)
+    {
+        LOG_WARN("{}: failed to upload '{}'", context, slot.resolvedPath);
+        setState(slot, SlotState::Failed);
+        return false;
+    }
+
+    slot.texture = std::move(texture);
+    slot.bytes   = imageBytes(image);
+    setState(slot, SlotState::Resident);
+
+    // A fresh upload counts as used now, which keeps the LRU list ordered by lastUsedFrame.
+    slot.lastUsedFrame = m_frame;
+    lruLink(handle);
+
+    m_stats.residentBytes += slot.bytes;
+    ++m_stats.residentCount;
+    ++m_stats.uploads;
+    return true;
+}
+
+void TextureLoader::release(AssetHandle handle)
+{
+    Slot& slot = m_slots[handle];
+    if (slot.state == SlotState::Resident)
+    {
+        m_stats.residentBytes -= slot.bytes;
+        --m_stats.residentCount;
+        lruUnlink(handle);
+    }
+    slot.texture.reset();
+    slot.bytes = 0;
+    setState(slot, SlotState::Unloaded);
+}
+
+void TextureLoader::lruLink(AssetHandle handle)
+{
+    Slot& slot   = m_slots[handle];
+    slot.lruPrev = m_lruTail;
+    slot.lruNext = kInvalidAssetHandle;
+    if (m_lruTail != kInvalidAssetHandle)
+    {
+        m_slots[m_lruTail].lruNext = handle;
+    }
+    else
+    {
+        m_lruHead = handle;
+    }
+    m_lruTail = handle;
+}
+
+void TextureLoader::lruUnlink(AssetHandle handle)
+{
+    Slot& slot = m_slots[handle];
+    (slot.lruPrev != kInvalidAssetHandle ? m_slots[slot.lruPrev].lruNext : m_lruHead) = slot.lruNext;
+    (slot.lruNext != kInvalidAssetHandle ? m_slots[slot.lruNext].lruPrev : m_lruTail) = slot.lruPrev;
+    slot.lruPrev = kInvalidAssetHandle;
+    slot.lruNext = kInvalidAssetHandle;
+}
+
+void TextureLoader::lruTouch(AssetHandle handle)
+{
+    if (handle != m_lruTail)
+    {
+        lruUnlink(handle);
+        lruLink(handle);
+    }
+}
+
+void TextureLoader::setState(Slot& slot, SlotState state)
+{
+    if (slot.state == SlotState::Pending)
+    {
+        --m_pendingCount;
+    }
+    if (state == SlotState::Pending)
+    {
+        ++m_pendingCount;
+    }
+    slot.state = state;
+}
+
+}  // namespace Internal
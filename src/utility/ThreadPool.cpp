@@ -0,0 +1,121 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace Internal
+{
+
+ThreadPool::ThreadPool(std::size_t workerCount) : m_workerCount(workerCount)
+{
+    if (m_workerCount == 0)
+    {
+        // The caller runs tasks too, so leave it a core.
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        m_workerCount               = std::clamp<std::size_t>(hardware > 1u ? hardware - 1u : 0u, 0u, 7u);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_batchReady.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& task)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (count == 1 || m_workerCount == 0)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    ensureWorkers();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task  = &task;
+        m_count = count;
+        m_next.store(0, std::memory_order_relaxed);
+        m_pending = m_workers.size();
+        ++m_batch;
+    }
+    m_batchReady.notify_all();
+
+    drain();
+
+    // Every worker checks in once per batch, so none can still be reading m_task afterwards.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_batchDone.wait(lock, [this] { return m_pending == 0; });
+    m_task = nullptr;
+}
+
+void ThreadPool::ensureWorkers()
+{
+    if (!m_workers.empty())
+    {
+        return;
+    }
+
+    m_workers.reserve(m_workerCount);
+    for (std::size_t i = 0; i < m_workerCount; ++i)
+    {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+void ThreadPool::workerLoop()
+{
+    std::uint64_t seenBatch = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_batchReady.wait(lock, [this, seenBatch] { return m_stopping || m_batch != seenBatch; });
+            if (m_stopping)
+            {
+                return;
+            }
+            seenBatch = m_batch;
+        }
+
+        drain();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_pending;
+        }
+        m_batchDone.notify_one();
+    }
+}
+
+void ThreadPool::drain()
+{
+    for (;;)
+    {
+        const std::size_t index = m_next.fetch_add(1, std::memory_order_relaxed);
+        if (index >= m_count)
+        {
+            return;
+        }
+        (*m_task)(index);
+    }
+}
+
+}  // namespace Internal
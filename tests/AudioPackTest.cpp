@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "AudioPack.h"
+
+namespace
+{
+
+std::filesystem::path makeTempPath(const std::string& filename)
+{
+    return std::filesystem::temp_directory_path() / filename;
+}
+
+void writeBinaryFile(const std::filesystem::path& path, const std::vector<std::uint8_t>& bytes)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    ASSERT_TRUE(out.is_open()) << "Failed to open temp file for writing: " << path.string();
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    ASSERT_TRUE(out.good()) << "Failed to write bytes to: " << path.string();
+}
+
+}  // namespace
+
+TEST(AudioPackTest, WrittenPackMapsPayloadsInPlaceAndAligned)
+{
+    const auto jump  = makeTempPath("audio_pack_test_jump.bin");
+    const auto theme = makeTempPath("audio_pack_test_theme.bin");
+    const auto pack  = makeTempPath("audio_pack_test.eap");
+
+    const std::vector<std::uint8_t> jumpBytes{1, 2, 3};
+    std::vector<std::uint8_t>       themeBytes(1000);
+    for (std::size_t i = 0; i < themeBytes.size(); ++i)
+    {
+        themeBytes[i] = static_cast<std::uint8_t>(i * 7u);
+    }
+    writeBinaryFile(jump, jumpBytes);
+    writeBinaryFile(theme, themeBytes);
+
+    std::string error;
+    ASSERT_TRUE(Internal::AudioPack::write(
+        pack, {{"assets\\audio\\jump.wav", jump}, {"./assets/audio/theme.ogg", theme}}, &error))
+        << error;
+
+    Internal::AudioPack audioPack;
+    ASSERT_TRUE(audioPack.open(pack, &error)) << error;
+    EXPECT_EQ(audioPack.entryCount(), 2u);
+
+    // Lookups normalize the same way as the writer.
+    const Internal::AudioPackView* jumpView = audioPack.find("./assets/audio/jump.wav");
+    ASSERT_NE(jumpView, nullptr);
+    ASSERT_EQ(jumpView->size, jumpBytes.size());
+    EXPECT_EQ(std::vector<std::uint8_t>(jumpView->data, jumpView->data + jumpView->size), jumpBytes);
+
+    const Internal::AudioPackView* themeView = audioPack.find("assets\\audio\\theme.ogg");
+    ASSERT_NE(themeView, nullptr);
+    ASSERT_EQ(themeView->size, themeBytes.size());
+    EXPECT_EQ(std::vector<std::uint8_t>(themeView->data, themeView->data + themeView->size), themeBytes);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(jumpView->data) % Internal::AudioPack::kPayloadAlignment, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(themeView->data) % Internal::AudioPack::kPayloadAlignment, 0u);
+    EXPECT_EQ(audioPack.find("assets/audio/missing.wav"), nullptr);
+
+    audioPack.close();
+    EXPECT_FALSE(audioPack.isOpen());
+
+    std::error_code ec;
+    std::filesystem::remove(jump, ec);
+    std::filesystem::remove(theme, ec);
+    std::filesystem::remove(pack, ec);
+}
+
+TEST(AudioPackTest, RejectsDuplicatesAndMalformedFiles)
+{
+    const auto source = makeTempPath("audio_pack_test_source.bin");
+    const auto pack   = makeTempPath("audio_pack_test_bad.eap");
+    writeBinaryFile(source, {9, 9, 9});
+
+    std::string error;
+    EXPECT_FALSE(Internal::AudioPack::write(pack, {{"a.wav", source}, {"./a.wav", source}}, &error));
+    EXPECT_NE(error.find("duplicate"), std::string::npos);
+
+    Internal::AudioPack audioPack;
+    writeBinaryFile(pack, {'R', 'I', 'F', 'F', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
+    EXPECT_FALSE(audioPack.open(pack, &error));
+    EXPECT_FALSE(audioPack.isOpen());
+
+    // Claims one entry but the index is cut off.
+    writeBinaryFile(pack, {'E', 'F', 'A', 'P', 1, 0, 0, 0, 1, 0, 0, 0, 24, 0, 0, 0});
+    EXPECT_FALSE(audioPack.open(pack, &error));
+    EXPECT_FALSE(audioPack.isOpen());
+
+    EXPECT_FALSE(audioPack.open(makeTempPath("audio_pack_test_missing.eap"), &error));
+
+    std::error_code ec;
+    std::filesystem::remove(source, ec);
+    std::filesystem::remove(pack, ec);
+}
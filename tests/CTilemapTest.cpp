@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <CTilemap.h>
+
+using Components::CTilemap;
+
+TEST(CTilemapTest, ResizeClearsTilesAndCountsChunks)
+{
+    CTilemap tilemap(70, 33, 1.0f, "atlas.png");
+
+    EXPECT_EQ(tilemap.getWidth(), 70u);
+    EXPECT_EQ(tilemap.getHeight(), 33u);
+    EXPECT_EQ(tilemap.getTiles().size(), 70u * 33u);
+    EXPECT_EQ(tilemap.getChunksX(), 3u);
+    EXPECT_EQ(tilemap.getChunksY(), 2u);
+    EXPECT_EQ(tilemap.getTile(69, 32), CTilemap::kEmptyTile);
+}
+
+TEST(CTilemapTest, SetTileBumpsOnlyItsChunkRevision)
+{
+    CTilemap tilemap(64, 64, 1.0f, "atlas.png");
+
+    const std::uint32_t layout = tilemap.layoutRevision;
+    const std::uint32_t before = tilemap.getChunkRevision(1, 0);
+    const std::uint32_t other  = tilemap.getChunkRevision(0, 1);
+
+    tilemap.setTile(40, 3, 7);
+
+    EXPECT_EQ(tilemap.getTile(40, 3), 7);
+    EXPECT_NE(tilemap.getChunkRevision(1, 0), before);
+    EXPECT_EQ(tilemap.getChunkRevision(0, 1), other);
+    EXPECT_EQ(tilemap.layoutRevision, layout);
+}
+
+TEST(CTilemapTest, UnchangedOrOutOfBoundsSetIsNoOp)
+{
+    CTilemap tilemap(8, 8, 1.0f, "atlas.png");
+    tilemap.setTile(2, 2, 4);
+    const std::uint32_t revision = tilemap.getChunkRevision(0, 0);
+
+    tilemap.setTile(2, 2, 4);
+    tilemap.setTile(8, 0, 1);
+    tilemap.setTile(0, 100, 1);
+
+    EXPECT_EQ(tilemap.getChunkRevision(0, 0), revision);
+    EXPECT_EQ(tilemap.getTile(8, 0), CTilemap::kEmptyTile);
+}
+
+TEST(CTilemapTest, BulkEditsInvalidateLayout)
+{
+    CTilemap tilemap(8, 8, 1.0f, "atlas.png");
+    const std::uint32_t layout = tilemap.layoutRevision;
+
+    tilemap.fill(3);
+    EXPECT_EQ(tilemap.getTile(7, 7), 3);
+    EXPECT_NE(tilemap.layoutRevision, layout);
+
+    const std::uint32_t afterFill = tilemap.layoutRevision;
+    EXPECT_FALSE(tilemap.setTiles(std::vector<std::int32_t>(3, 1)));
+    EXPECT_EQ(tilemap.layoutRevision, afterFill);
+    EXPECT_TRUE(tilemap.setTiles(std::vector<std::int32_t>(64, 1)));
+    EXPECT_EQ(tilemap.getTile(7, 7), 1);
+    EXPECT_NE(tilemap.layoutRevision, afterFill);
+
+    const std::uint32_t afterSet = tilemap.layoutRevision;
+    tilemap.atlasHandle          = 2;
+    tilemap.setAtlasPath("other.png");
+    EXPECT_NE(tilemap.layoutRevision, afterSet);
+    EXPECT_EQ(tilemap.atlasHandle, kInvalidAssetHandle);
+}
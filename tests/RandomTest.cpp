@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Random.h"
+
+TEST(RandomTest, SameSeedGivesSameSequence)
+{
+    Random a(1234);
+    Random b(1234);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(a.nextUInt(), b.nextUInt());
+    }
+
+    Random otherSeed(1235);
+    Random otherStream(1234, 7);
+    Random c(1234);
+    int    sameSeed   = 0;
+    int    sameStream = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto value = c.nextUInt();
+        sameSeed += value == otherSeed.nextUInt() ? 1 : 0;
+        sameStream += value == otherStream.nextUInt() ? 1 : 0;
+    }
+    EXPECT_LT(sameSeed, 5);
+    EXPECT_LT(sameStream, 5);
+}
+
+TEST(RandomTest, FloatsStayInRange)
+{
+    Random random(99);
+    for (int i = 0; i < 10000; ++i)
+    {
+        const float u = random.nextFloat();
+        EXPECT_GE(u, 0.0f);
+        EXPECT_LT(u, 1.0f);
+
+        const float r = random.range(-2.0f, 3.0f);
+        EXPECT_GE(r, -2.0f);
+        EXPECT_LT(r, 3.0f);
+    }
+}
+
+TEST(RandomTest, FillMatchesSequentialDraws)
+{
+    Random batched(5);
+    Random sequential(5);
+
+    std::vector<float> values(37);
+    batched.fill(values.data(), values.size());
+    for (float value : values)
+    {
+        EXPECT_EQ(value, sequential.nextFloat());
+    }
+    EXPECT_EQ(batched.nextUInt(), sequential.nextUInt());
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include <AnimationEvents.h>
+#include <CSpriteAnimation.h>
+#include <CTexture.h>
+#include <EventBus.h>
+#include <SAnimation.h>
+#include <World.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+
+Components::CSpriteAnimation makeAnimation(std::uint32_t frames, float duration)
+{
+    Components::CSpriteAnimation animation;
+    animation.addGridFrames(16, 16, 4, 0, frames, duration);
+    return animation;
+}
+
+}  // namespace
+
+TEST(SAnimationTest, GridFramesFollowAtlasRows)
+{
+    Components::CSpriteAnimation animation;
+    animation.addGridFrames(16, 8, 3, 2, 3, 0.1f);
+
+    ASSERT_EQ(animation.frames.size(), 3u);
+    EXPECT_EQ(animation.frames[0].rect.left, 32);
+    EXPECT_EQ(animation.frames[0].rect.top, 0);
+    EXPECT_EQ(animation.frames[1].rect.left, 0);
+    EXPECT_EQ(animation.frames[1].rect.top, 8);
+    EXPECT_EQ(animation.frames[2].rect.width, 16);
+    EXPECT_EQ(animation.frames[2].rect.height, 8);
+}
+
+TEST(SAnimationTest, AppliesFirstFrameAndAdvancesOnlyTheRect)
+{
+    World  world;
+    Entity e = world.createEntity();
+    world.add<Components::CTexture>(e, Components::CTexture{"atlas.png"});
+    world.add<Components::CSpriteAnimation>(e, makeAnimation(4, 0.1f));
+
+    Systems::SAnimation system;
+    system.update(0.0f, world);
+
+    const auto* texture = world.get<Components::CTexture>(e);
+    EXPECT_EQ(texture->textureRect, (Components::TextureRect{0, 0, 16, 16}));
+
+    system.update(0.25f, world);
+    EXPECT_EQ(world.get<Components::CSpriteAnimation>(e)->getCurrentFrame(), 2u);
+    EXPECT_EQ(texture->textureRect, (Components::TextureRect{32, 0, 16, 16}));
+    EXPECT_EQ(texture->getTexturePath(), "atlas.png");
+}
+
+TEST(SAnimationTest, LoopsAndStopsOneShotOnLastFrame)
+{
+    World  world;
+    Entity looping = world.createEntity();
+    world.add<Components::CSpriteAnimation>(looping, makeAnimation(3, 0.1f));
+
+    Entity oneShot = world.createEntity();
+    auto   anim    = makeAnimation(3, 0.1f);
+    anim.loop      = false;
+    world.add<Components::CSpriteAnimation>(oneShot, anim);
+
+    std::vector<Entity> finished;
+    world.events().subscribe<Systems::SpriteAnimationFinished>(
+        [&finished](const Systems::SpriteAnimationFinished& ev, World&) { finished.push_back(ev.entity); });
+
+    Systems::SAnimation system;
+    for (int i = 0; i < 7; ++i)
+    {
+        system.update(0.05f, world);
+    }
+    world.events().pump(EventStage::PreFlush, world);
+
+    EXPECT_EQ(world.get<Components::CSpriteAnimation>(looping)->getCurrentFrame(), 0u);
+    const auto* stopped = world.get<Components::CSpriteAnimation>(oneShot);
+    EXPECT_EQ(stopped->getCurrentFrame(), 2u);
+    EXPECT_TRUE(stopped->isFinished());
+    ASSERT_EQ(finished.size(), 1u);
+    EXPECT_EQ(finished[0], oneShot);
+}
+
+TEST(SAnimationTest, EmitsFrameEvents)
+{
+    World  world;
+    Entity e    = world.createEntity();
+    auto   anim = makeAnimation(3, 0.1f);
+    anim.frames[1].event = "footstep";
+    world.add<Components::CSpriteAnimation>(e, anim);
+
+    std::vector<std::string> events;
+    world.events().subscribe<Systems::SpriteAnimationEvent>(
+        [&events](const Systems::SpriteAnimationEvent& ev, World&)
+        {
+            EXPECT_EQ(ev.frame, 1u);
+            events.push_back(ev.event);
+        });
+
+    Systems::SAnimation system;
+    system.update(0.35f, world);  // Crosses frames 1 and 2, then wraps to 0
+    world.events().pump(EventStage::PreFlush, world);
+
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0], "footstep");
+}
+
+TEST(SAnimationTest, PausedOrZeroSpeedHoldsFrame)
+{
+    World  world;
+    Entity e    = world.createEntity();
+    auto   anim = makeAnimation(3, 0.1f);
+    anim.speed  = 0.0f;
+    world.add<Components::CSpriteAnimation>(e, anim);
+
+    Systems::SAnimation system;
+    system.update(1.0f, world);
+    EXPECT_EQ(world.get<Components::CSpriteAnimation>(e)->getCurrentFrame(), 0u);
+
+    auto* animation  = world.get<Components::CSpriteAnimation>(e);
+    animation->speed = 1.0f;
+    animation->pause();
+    system.update(1.0f, world);
+    EXPECT_EQ(animation->getCurrentFrame(), 0u);
+
+    animation->play();
+    system.update(0.1f, world);
+    EXPECT_EQ(animation->getCurrentFrame(), 1u);
+}
+
+TEST(SAnimationTest, EmitsFirstFrameEventOnStartAndRestart)
+{
+    World  world;
+    Entity e    = world.createEntity();
+    auto   anim = makeAnimation(2, 0.1f);
+    anim.loop   = false;
+    anim.frames[0].event = "windup";
+    world.add<Components::CSpriteAnimation>(e, anim);
+
+    std::vector<std::uint32_t> frames;
+    world.events().subscribe<Systems::SpriteAnimationEvent>(
+        [&frames](const Systems::SpriteAnimationEvent& ev, World&)
+        {
+            EXPECT_EQ(ev.event, "windup");
+            frames.push_back(ev.frame);
+        });
+
+    Systems::SAnimation system;
+    system.update(0.0f, world);
+    system.update(0.05f, world);
+    world.events().pump(EventStage::PreFlush, world);
+    ASSERT_EQ(frames.size(), 1u);
+    EXPECT_EQ(frames[0], 0u);
+
+    // Finishing and restarting enters frame 0 again.
+    system.update(0.5f, world);
+    world.get<Components::CSpriteAnimation>(e)->play();
+    system.update(0.0f, world);
+    world.events().pump(EventStage::PreFlush, world);
+    EXPECT_EQ(frames.size(), 2u);
+}
+
+TEST(SAnimationTest, RectIsAppliedOnceTextureArrives)
+{
+    World  world;
+    Entity e = world.createEntity();
+    world.add<Components::CSpriteAnimation>(e, makeAnimation(4, 0.1f));
+
+    Systems::SAnimation system;
+    system.update(0.15f, world);
+    EXPECT_TRUE(world.get<Components::CSpriteAnimation>(e)->rectDirty);
+
+    world.add<Components::CTexture>(e, Components::CTexture{"atlas.png"});
+    system.update(0.0f, world);
+    EXPECT_EQ(world.get<Components::CTexture>(e)->textureRect, (Components::TextureRect{16, 0, 16, 16}));
+    EXPECT_FALSE(world.get<Components::CSpriteAnimation>(e)->rectDirty);
+}
@@ -0,0 +1,419 @@
+#include <gtest/gtest.h>
+
+#include <SFML/Audio.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <AudioEvents.h>
+#include <CAudioListener.h>
+#include <CAudioSettings.h>
+#include <CAudioSource.h>
+#include <CTransform.h>
+#include <World.h>
+
+#define private public
+#include <SAudio.h>
+#undef private
+
+// These tests never call initialize(): no audio device is opened and no sf::Sound is created. The
+// system is marked initialized by hand and voices are placed directly, audible ones on slots without
+// a sound.
+namespace
+{
+
+void markInitialized(Systems::SAudio& audio, size_t slots)
+{
+    audio.m_initialized = true;
+    audio.m_soundPool.resize(slots);
+    audio.m_soundBuffers.emplace("clip", sf::SoundBuffer());
+}
+
+void addVoice(Systems::SAudio& audio, Entity owner, int priority, int slot = -1)
+{
+    Systems::SAudio::Voice voice;
+    voice.owner    = owner;
+    voice.priority = priority;
+    voice.slot     = slot;
+    voice.duration = 10.0f;
+    if (slot >= 0)
+    {
+        audio.m_soundPool[static_cast<size_t>(slot)].owner = owner;
+    }
+    audio.m_entityToVoice[owner] = audio.m_voices.size();
+    audio.m_voices.push_back(voice);
+}
+
+void fillVirtualVoices(Systems::SAudio& audio, int priority)
+{
+    for (size_t i = audio.getVirtualVoiceCount(); i < AudioConstants::MAX_VIRTUAL_VOICES; ++i)
+    {
+        addVoice(audio, Entity(static_cast<uint32_t>(1000 + i), 0), priority);
+    }
+}
+
+Systems::SAudio::Voice candidate(Entity owner, int priority)
+{
+    Systems::SAudio::Voice voice;
+    voice.owner    = owner;
+    voice.priority = priority;
+    return voice;
+}
+
+// A quarter second of 8 kHz mono 16-bit silence, for the decode paths.
+std::string writeTestWav()
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "entityforge_test_clip.wav").string();
+
+    const std::uint32_t sampleRate = 8000;
+    const std::uint32_t dataSize   = sampleRate / 4 * 2;
+    std::ofstream       file(path, std::ios::binary);
+    const auto          put = [&file](std::uint32_t value, int bytes)
+    {
+        for (int i = 0; i < bytes; ++i)
+        {
+            file.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    };
+    file.write("RIFF", 4);
+    put(36 + dataSize, 4);
+    file.write("WAVEfmt ", 8);
+    put(16, 4);              // fmt chunk size
+    put(1, 2);               // PCM
+    put(1, 2);               // Mono
+    put(sampleRate, 4);      // Sample rate
+    put(sampleRate * 2, 4);  // Byte rate
+    put(2, 2);               // Block align
+    put(16, 2);              // Bits per sample
+    file.write("data", 4);
+    put(dataSize, 4);
+    for (std::uint32_t i = 0; i < dataSize; ++i)
+    {
+        file.put(0);
+    }
+    return path;
+}
+
+// Collects finished decodes until the loader has none in flight.
+bool waitForLoads(Systems::SAudio& audio)
+{
+    for (int i = 0; i < 500; ++i)
+    {
+        audio.collectLoadedSounds();
+        if (audio.m_bankLoader.pendingCount() == 0)
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+}  // namespace
+
+TEST(SAudioVoiceTest, RefusedPlayKeepsTheEntitysCurrentVoice)
+{
+    Systems::SAudio audio(0);
+    markInitialized(audio, 0);
+
+    const Entity player(1, 0);
+    addVoice(audio, player, 10);
+    fillVirtualVoices(audio, 10);
+    addVoice(audio, Entity(2, 0), 10);  // One over the cap, excluding the player's own voice
+
+    EXPECT_FALSE(audio.playSfx(player, "clip", false, 1.0f, 0));
+    ASSERT_EQ(audio.m_entityToVoice.count(player), 1u);
+    EXPECT_EQ(audio.m_voices[audio.m_entityToVoice.at(player)].priority, 10);
+
+    // A stronger play replaces the voice and pushes out the weakest other virtual voice.
+    const size_t before = audio.getVirtualVoiceCount();
+    EXPECT_TRUE(audio.playSfx(player, "clip", false, 1.0f, 20));
+    EXPECT_EQ(audio.m_voices[audio.m_entityToVoice.at(player)].priority, 20);
+    EXPECT_EQ(audio.getVirtualVoiceCount(), before - 1);
+}
+
+TEST(SAudioVoiceTest, NewcomerStealsTheWeakestSlotAndLosersGoVirtual)
+{
+    Systems::SAudio audio(0);
+    markInitialized(audio, 2);
+
+    const Entity weak(1, 0);
+    const Entity strong(2, 0);
+    addVoice(audio, weak, 0, 0);
+    addVoice(audio, strong, 1, 1);
+
+    Systems::SAudio::VoicePlan plan = audio.planVoice(Entity(3, 0), candidate(Entity(3, 0), 5));
+    EXPECT_TRUE(plan.accepted);
+    EXPECT_TRUE(plan.audible);
+    EXPECT_EQ(plan.victim, weak);
+    EXPECT_FALSE(plan.dropVictim);
+    EXPECT_FALSE(plan.dropped.isValid());
+
+    // Not outranking any audible voice: it starts virtual.
+    plan = audio.planVoice(Entity(3, 0), candidate(Entity(3, 0), 0));
+    EXPECT_TRUE(plan.accepted);
+    EXPECT_FALSE(plan.audible);
+
+    // Replacing an audible voice reuses its slot without stealing.
+    plan = audio.planVoice(weak, candidate(weak, -5));
+    EXPECT_TRUE(plan.audible);
+    EXPECT_FALSE(plan.victim.isValid());
+}
+
+TEST(SAudioVoiceTest, StealingRespectsTheVirtualVoiceCap)
+{
+    Systems::SAudio audio(0);
+    markInitialized(audio, 1);
+
+    const Entity victim(1, 0);
+    const Entity newcomer(2, 0);
+    addVoice(audio, victim, 0, 0);
+
+    // Weaker virtual voices make room for the victim.
+    fillVirtualVoices(audio, -1);
+    Systems::SAudio::VoicePlan plan = audio.planVoice(newcomer, candidate(newcomer, 5));
+    EXPECT_TRUE(plan.accepted);
+    EXPECT_EQ(plan.victim, victim);
+    EXPECT_FALSE(plan.dropVictim);
+    ASSERT_TRUE(plan.dropped.isValid());
+    EXPECT_EQ(audio.m_voices[audio.m_entityToVoice.at(plan.dropped)].priority, -1);
+
+    // Stronger virtual voices: the victim is released instead of exceeding the cap.
+    for (Systems::SAudio::Voice& voice : audio.m_voices)
+    {
+        voice.priority = voice.slot < 0 ? 3 : voice.priority;
+    }
+    plan = audio.planVoice(newcomer, candidate(newcomer, 5));
+    EXPECT_TRUE(plan.accepted);
+    EXPECT_EQ(plan.victim, victim);
+    EXPECT_TRUE(plan.dropVictim);
+    EXPECT_FALSE(plan.dropped.isValid());
+
+    // A newcomer weaker than everything is refused.
+    plan = audio.planVoice(newcomer, candidate(newcomer, -10));
+    EXPECT_FALSE(plan.accepted);
+}
+
+TEST(SAudioVoiceTest, SpatialGainFallsOffLinearlyAndPanFollowsTheSide)
+{
+    Systems::SAudio audio(0);
+    audio.m_hasListener      = true;
+    audio.m_listenerPosition = Vec2(0.0f, 0.0f);
+    audio.m_panDistance      = 10.0f;
+
+    Systems::SAudio::Voice voice;
+    voice.spatial     = true;
+    voice.minDistance = 2.0f;
+    voice.maxDistance = 10.0f;
+
+    const auto gainAt = [&audio, &voice](float x, float y)
+    {
+        voice.position = Vec2(x, y);
+        audio.spatialize(voice);
+        return voice.gain;
+    };
+    EXPECT_FLOAT_EQ(gainAt(1.0f, 0.0f), 1.0f);
+    EXPECT_FLOAT_EQ(gainAt(0.0f, 2.0f), 1.0f);  // minDistance
+    EXPECT_FLOAT_EQ(gainAt(6.0f, 0.0f), 0.5f);
+    EXPECT_FLOAT_EQ(gainAt(0.0f, 10.0f), 0.0f);  // maxDistance
+    EXPECT_FLOAT_EQ(gainAt(12.0f, 0.0f), 0.0f);
+
+    gainAt(6.0f, 0.0f);
+    EXPECT_FLOAT_EQ(voice.pan, 0.6f);
+    gainAt(-6.0f, 0.0f);
+    EXPECT_FLOAT_EQ(voice.pan, -0.6f);
+    gainAt(0.0f, 6.0f);
+    EXPECT_FLOAT_EQ(voice.pan, 0.0f);
+
+    // Without a listener spatial voices play unattenuated and centered.
+    audio.m_hasListener = false;
+    EXPECT_FLOAT_EQ(gainAt(-6.0f, 0.0f), 1.0f);
+    EXPECT_FLOAT_EQ(voice.pan, 0.0f);
+}
+
+TEST(SAudioVoiceTest, OutOfRangeVoiceBecomesPromotableWhenTheListenerApproaches)
+{
+    Systems::SAudio audio(0);
+    markInitialized(audio, 0);
+
+    World  world;
+    Entity listener = world.createEntity();
+    world.components().add<Components::CAudioListener>(listener);
+    world.components().add<Components::CTransform>(listener, Vec2(100.0f, 0.0f), Vec2(1.0f, 1.0f), 0.0f);
+
+    Entity source = world.createEntity();
+    world.components().add<Components::CTransform>(source, Vec2(0.0f, 0.0f), Vec2(1.0f, 1.0f), 0.0f);
+    Components::CAudioSource settings;
+    settings.spatial     = true;
+    settings.minDistance = 1.0f;
+    settings.maxDistance = 10.0f;
+
+    audio.updateSpatialVoices(world);
+    ASSERT_TRUE(audio.playSource(source, settings, "clip", world));
+    const Systems::SAudio::Voice& voice = audio.m_voices[audio.m_entityToVoice.at(source)];
+    EXPECT_EQ(voice.slot, -1);
+    EXPECT_FLOAT_EQ(voice.gain, 0.0f);
+
+    // Inaudible voices are never candidates for a slot.
+    audio.promoteVirtualVoices();
+    EXPECT_TRUE(audio.m_virtualScratch.empty());
+
+    // The listener walks up to the right of the source.
+    world.components().get<Components::CTransform>(listener)->setPosition(Vec2(5.5f, 0.0f));
+    audio.updateSpatialVoices(world);
+    EXPECT_FLOAT_EQ(voice.gain, 0.5f);
+    EXPECT_LT(voice.pan, 0.0f);
+    audio.promoteVirtualVoices();
+    ASSERT_EQ(audio.m_virtualScratch.size(), 1u);
+    EXPECT_EQ(audio.m_voices[audio.m_virtualScratch[0]].owner, source);
+}
+
+TEST(SAudioVoiceTest, AudibleVoiceLeavingRangeGivesUpItsSlot)
+{
+    Systems::SAudio audio(0);
+    markInitialized(audio, 1);
+
+    World  world;
+    Entity listener = world.createEntity();
+    world.components().add<Components::CAudioListener>(listener);
+    world.components().add<Components::CTransform>(listener, Vec2(0.0f, 0.0f), Vec2(1.0f, 1.0f), 0.0f);
+    Entity source = world.createEntity();
+    world.components().add<Components::CTransform>(source, Vec2(50.0f, 0.0f), Vec2(1.0f, 1.0f), 0.0f);
+
+    addVoice(audio, source, 0, 0);
+    audio.m_voices[0].spatial = true;
+
+    audio.updateSpatialVoices(world);
+    EXPECT_EQ(audio.m_voices[0].slot, -1);
+    EXPECT_EQ(audio.m_freeSlots.size(), 1u);
+    EXPECT_EQ(audio.getAudibleVoiceCount(), 0u);
+}
+
+TEST(SAudioVoiceTest, RequestsPumpedBeforeTheFirstUpdatePlayAndStop)
+{
+    Systems::SAudio audio(0);
+    markInitialized(audio, 0);
+
+    World  world;
+    Entity source = world.createEntity();
+    world.components().add<Components::CAudioSource>(source)->clipId = "clip";
+
+    // Emitted and pumped before the first updateEcs, as on the engine's first frame.
+    audio.bindWorld(world);
+    world.events().emit(Systems::AudioPlayRequest{source, ""});
+    EXPECT_EQ(audio.m_entityToVoice.count(source), 0u);
+
+    world.events().pump(EventStage::PreFlush, world);
+    audio.updateEcs(0.0f, world);
+    ASSERT_EQ(audio.m_entityToVoice.count(source), 1u);
+    audio.m_voices[audio.m_entityToVoice.at(source)].duration = 10.0f;  // The test buffer is empty
+
+    world.events().emit(Systems::AudioStopRequest{source});
+    world.events().pump(EventStage::PreFlush, world);
+    audio.updateEcs(0.0f, world);
+    EXPECT_EQ(audio.m_entityToVoice.count(source), 0u);
+    EXPECT_TRUE(audio.m_voices.empty());
+}
+
+TEST(SAudioVoiceTest, VolumeSettingsApplyOnlyWhenTheyChange)
+{
+    Systems::SAudio audio(0);
+    markInitialized(audio, 0);
+
+    World  world;
+    Entity settingsEntity = world.createEntity();
+    auto*  settings       = world.components().add<Components::CAudioSettings>(settingsEntity);
+
+    settings->masterVolume = 0.5f;
+    settings->sfxVolume    = 0.5f;
+
+    audio.updateEcs(0.0f, world);
+    EXPECT_FLOAT_EQ(audio.getMasterVolume(), 0.5f);
+    EXPECT_FLOAT_EQ(audio.m_sfxVolume, 0.5f);
+    EXPECT_FLOAT_EQ(audio.calculateEffectiveSfxVolume(1.0f), 0.25f);
+
+    // Unchanged settings leave the mix alone.
+    audio.updateEcs(0.0f, world);
+    EXPECT_FLOAT_EQ(audio.calculateEffectiveSfxVolume(1.0f), 0.25f);
+
+    world.components().get<Components::CAudioSettings>(settingsEntity)->sfxVolume = 1.0f;
+    audio.updateEcs(0.0f, world);
+    EXPECT_FLOAT_EQ(audio.getMasterVolume(), 0.5f);
+    EXPECT_FLOAT_EQ(audio.calculateEffectiveSfxVolume(1.0f), 0.5f);
+}
+
+TEST(SAudioVoiceTest, AsyncDecodeIsAdoptedAndStartsQueuedPlays)
+{
+    Systems::SAudio audio(0);
+    markInitialized(audio, 0);
+    const std::string path = writeTestWav();
+
+    const Entity queued(1, 0);
+    const Entity skipped(2, 0);
+    ASSERT_TRUE(audio.loadSoundAsync("wav", path));
+    EXPECT_TRUE(audio.isSoundLoading("wav"));
+
+    // Still loading until collected on this thread, so both policies are exercised deterministically.
+    EXPECT_TRUE(audio.playSfx(queued, "wav"));
+    EXPECT_EQ(audio.m_queuedPlays.size(), 1u);
+    EXPECT_EQ(audio.m_entityToVoice.count(queued), 0u);
+    audio.setLoadingPlayPolicy(LoadingPlayPolicy::Skip);
+    EXPECT_FALSE(audio.playSfx(skipped, "wav"));
+    EXPECT_EQ(audio.m_queuedPlays.size(), 1u);
+
+    ASSERT_TRUE(waitForLoads(audio));
+    EXPECT_FALSE(audio.isSoundLoading("wav"));
+    ASSERT_EQ(audio.m_soundBuffers.count("wav"), 1u);
+    EXPECT_TRUE(audio.m_queuedPlays.empty());
+    ASSERT_EQ(audio.m_entityToVoice.count(queued), 1u);
+    EXPECT_EQ(audio.m_voices[audio.m_entityToVoice.at(queued)].buffer, &audio.m_soundBuffers.at("wav"));
+    EXPECT_EQ(audio.m_entityToVoice.count(skipped), 0u);
+}
+
+TEST(SAudioVoiceTest, UnloadDuringLoadDropsTheStaleDecode)
+{
+    Systems::SAudio audio(0);
+    markInitialized(audio, 0);
+    const std::string path = writeTestWav();
+
+    const Entity owner(1, 0);
+    ASSERT_TRUE(audio.loadSoundAsync("wav", path));
+    EXPECT_TRUE(audio.playSfx(owner, "wav"));
+
+    audio.unloadSound("wav");
+    EXPECT_FALSE(audio.isSoundLoading("wav"));
+    EXPECT_TRUE(audio.m_queuedPlays.empty());
+
+    ASSERT_TRUE(waitForLoads(audio));
+    EXPECT_EQ(audio.m_soundBuffers.count("wav"), 0u);
+    EXPECT_EQ(audio.m_entityToVoice.count(owner), 0u);
+}
+
+TEST(SAudioVoiceTest, SynchronousLoadOvertakesAnAsyncLoad)
+{
+    Systems::SAudio audio(0);
+    markInitialized(audio, 0);
+    const std::string path = writeTestWav();
+
+    const Entity owner(1, 0);
+    ASSERT_TRUE(audio.loadSoundAsync("wav", path));
+    EXPECT_TRUE(audio.playSfx(owner, "wav"));
+
+    // The queued play starts from the synchronous buffer right away.
+    ASSERT_TRUE(audio.loadSound("wav", path, AudioType::SFX));
+    EXPECT_FALSE(audio.isSoundLoading("wav"));
+    EXPECT_TRUE(audio.m_queuedPlays.empty());
+    ASSERT_EQ(audio.m_entityToVoice.count(owner), 1u);
+    const sf::SoundBuffer* buffer = &audio.m_soundBuffers.at("wav");
+    EXPECT_EQ(audio.m_voices[audio.m_entityToVoice.at(owner)].buffer, buffer);
+
+    // The late async decode is discarded and the playing voice keeps its buffer.
+    ASSERT_TRUE(waitForLoads(audio));
+    ASSERT_EQ(audio.m_soundBuffers.count("wav"), 1u);
+    EXPECT_EQ(&audio.m_soundBuffers.at("wav"), buffer);
+    EXPECT_EQ(audio.m_voices[audio.m_entityToVoice.at(owner)].buffer, buffer);
+}
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+
+#define private public
+#include "SInput.h"
+#undef private
+
+#include "CInputController.h"
+#include "EventBus.h"
+#include "World.h"
+
+#include <vector>
+
+namespace
+{
+
+void addController(World& world, Entity entity, const std::string& action, KeyCode key)
+{
+    auto*         controller = world.components().add<Components::CInputController>(entity);
+    ActionBinding binding;
+    binding.keys.push_back(key);
+    controller->bindings[action].push_back({binding, 0});
+}
+
+// Component storage may move on add/remove, so the controller is looked up again for every check.
+ActionState controllerState(World& world, Entity entity, const std::string& action)
+{
+    return world.components().get<Components::CInputController>(entity)->actionStates.at(action);
+}
+
+// One SInput::update() worth of controller work, with the key state the window events would have produced.
+void step(Systems::SInput& input, World& world, KeyCode key, bool down, bool pressed, bool released)
+{
+    input.m_keyDown[key]     = down;
+    input.m_keyPressed[key]  = pressed;
+    input.m_keyReleased[key] = released;
+    input.registerControllerBindings(world);
+    input.updateControllerStates(world);
+}
+
+TEST(SInputControllerActionsTest, ControllerActionsFollowPressHoldReleaseWithoutCollidingAcrossEntities)
+{
+    World           world;
+    Systems::SInput input;
+
+    Entity player = world.createEntity();
+    Entity other  = world.createEntity();
+    addController(world, player, "Jump", KeyCode::Space);
+    addController(world, other, "Jump", KeyCode::W);
+
+    step(input, world, KeyCode::Space, true, true, false);
+    EXPECT_NE(world.components().get<Components::CInputController>(player)->bindings.at("Jump")[0].bindingId, 0u);
+    EXPECT_EQ(controllerState(world, player, "Jump"), ActionState::Pressed);
+    EXPECT_EQ(controllerState(world, other, "Jump"), ActionState::None);
+
+    const ActionId jumpId = input.getActionId("Jump");
+    ASSERT_NE(jumpId, kInvalidActionId);
+    EXPECT_EQ(input.getActionId("Crouch"), kInvalidActionId);
+    EXPECT_EQ(input.m_actionNames.size(), 1u);
+    EXPECT_EQ(input.getActionState(player, jumpId), ActionState::Pressed);
+    EXPECT_EQ(input.getActionState(other, jumpId), ActionState::None);
+
+    step(input, world, KeyCode::Space, true, false, false);
+    EXPECT_EQ(controllerState(world, player, "Jump"), ActionState::Held);
+
+    step(input, world, KeyCode::Space, false, false, true);
+    EXPECT_EQ(controllerState(world, player, "Jump"), ActionState::Released);
+
+    step(input, world, KeyCode::Space, false, false, false);
+    EXPECT_EQ(controllerState(world, player, "Jump"), ActionState::None);
+    EXPECT_EQ(input.getActionState(player, jumpId), ActionState::None);
+}
+
+TEST(SInputControllerActionsTest, RecordsOfRemovedControllersAreDropped)
+{
+    World           world;
+    Systems::SInput input;
+
+    Entity first  = world.createEntity();
+    Entity second = world.createEntity();
+    addController(world, first, "Fire", KeyCode::F);
+    addController(world, second, "Fire", KeyCode::F);
+
+    step(input, world, KeyCode::F, true, true, false);
+    EXPECT_EQ(input.m_controllers.size(), 2u);
+
+    world.components().remove<Components::CInputController>(first);
+    step(input, world, KeyCode::F, true, false, false);
+    ASSERT_EQ(input.m_controllers.size(), 1u);
+    EXPECT_EQ(input.m_controllers[0].entity, second);
+    EXPECT_EQ(input.m_controllerIndex.at(second), 0u);
+    EXPECT_EQ(controllerState(world, second, "Fire"), ActionState::Held);
+    EXPECT_EQ(input.getActionState(first, input.getActionId("Fire")), ActionState::None);
+}
+
+TEST(SInputControllerActionsTest, ActiveActionsDispatchEveryFrameWithTheOwningEntity)
+{
+    World           world;
+    Systems::SInput input;
+
+    struct Listener : IInputListener
+    {
+        std::vector<ActionEvent> actions;
+        void                     onAction(const ActionEvent& ev) override
+        {
+            actions.push_back(ev);
+        }
+    } listener;
+    input.addListener(&listener);
+
+    std::vector<ActionEvent> busActions;
+    world.events().subscribe<InputEvent>(
+        [&busActions](const InputEvent& ev, World&)
+        {
+            if (ev.type == InputEventType::Action)
+                busActions.push_back(ev.action);
+        });
+
+    Entity player = world.createEntity();
+    addController(world, player, "Jump", KeyCode::Space);
+
+    step(input, world, KeyCode::Space, true, true, false);
+    step(input, world, KeyCode::Space, true, false, false);
+    step(input, world, KeyCode::Space, true, false, false);
+    step(input, world, KeyCode::Space, false, false, true);
+    step(input, world, KeyCode::Space, false, false, false);  // Back to None: no event
+    step(input, world, KeyCode::Space, false, false, false);
+    world.events().pump(EventStage::PreFlush, world);
+
+    ASSERT_EQ(listener.actions.size(), 4u);
+    EXPECT_EQ(listener.actions[0].actionName, "Jump");
+    EXPECT_EQ(listener.actions[0].entity, player);
+    EXPECT_EQ(listener.actions[0].state, ActionState::Pressed);
+    EXPECT_EQ(listener.actions[1].state, ActionState::Held);
+    EXPECT_EQ(listener.actions[2].state, ActionState::Held);
+    EXPECT_EQ(listener.actions[3].state, ActionState::Released);
+    EXPECT_EQ(controllerState(world, player, "Jump"), ActionState::None);
+
+    ASSERT_EQ(busActions.size(), 4u);
+    EXPECT_EQ(busActions[3].entity, player);
+    EXPECT_EQ(busActions[3].state, ActionState::Released);
+
+    input.removeListener(&listener);
+}
+
+TEST(SInputControllerActionsTest, CopiedOrReaddedControllersRegisterTheirBindings)
+{
+    World           world;
+    Systems::SInput input;
+
+    Entity original = world.createEntity();
+    addController(world, original, "Fire", KeyCode::F);
+    step(input, world, KeyCode::F, false, false, false);
+
+    // A copy carries the original's nonzero binding IDs.
+    Entity copy = world.createEntity();
+    world.components().add<Components::CInputController>(
+        copy, *world.components().get<Components::CInputController>(original));
+    step(input, world, KeyCode::F, true, true, false);
+    EXPECT_EQ(controllerState(world, original, "Fire"), ActionState::Pressed);
+    EXPECT_EQ(controllerState(world, copy, "Fire"), ActionState::Pressed);
+
+    // Removed for a frame, then re-added with the stale IDs.
+    Components::CInputController saved = *world.components().get<Components::CInputController>(original);
+    world.components().remove<Components::CInputController>(original);
+    step(input, world, KeyCode::F, false, false, false);
+    world.components().add<Components::CInputController>(original, saved);
+    step(input, world, KeyCode::F, true, true, false);
+    EXPECT_EQ(input.getActionState(original, input.getActionId("Fire")), ActionState::Pressed);
+
+    // A binding removed from a live controller stops driving the action.
+    world.components().get<Components::CInputController>(copy)->bindings.at("Fire").clear();
+    step(input, world, KeyCode::F, true, false, false);
+    EXPECT_EQ(controllerState(world, copy, "Fire"), ActionState::Released);
+    EXPECT_EQ(controllerState(world, original, "Fire"), ActionState::Held);
+}
+
+}  // namespace
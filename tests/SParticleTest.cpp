@@ -1,7 +1,17 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <CCamera.h>
+#include <CCollider2D.h>
 #include <CParticleEmitter.h>
+#include <CPhysicsBody2D.h>
 #include <CTransform.h>
+#include <ParticleCurve.h>
+#include <ParticleKernel.h>
+#include <S2DPhysics.h>
 #include <SParticle.h>
 #include <World.h>
 
@@ -52,8 +62,7 @@ TEST(SParticleTest, UpdateAppliesRotatedEmitterOffsetToSpawnPosition)
     ASSERT_EQ(emitter->getAliveCount(), 1u);
     ASSERT_FALSE(emitter->getParticles().empty());
 
-    const auto& p = emitter->getParticles().front();
-    ASSERT_TRUE(p.alive);
+    const auto p = emitter->getParticles().get(0);
 
     EXPECT_NEAR(p.position.x, 2.0f, 1e-5f);
     EXPECT_NEAR(p.position.y, 4.0f, 1e-5f);
@@ -71,20 +80,18 @@ TEST(SParticleTest, UpdateKillsExpiredParticlesWhenEmissionDisabled)
     emitter->setEmissionRate(0.0f);
 
     Components::Particle particle;
-    particle.alive    = true;
     particle.age      = 0.0f;
     particle.lifetime = 0.25f;
     particle.position = Vec2(0.0f, 0.0f);
     particle.velocity = Vec2(0.0f, 0.0f);
     particle.acceleration = Vec2(0.0f, 0.0f);
-    emitter->getParticles().push_back(particle);
+    emitter->getParticles().push(particle);
 
     Systems::SParticle system;
     system.initialize(nullptr);
     system.update(1.0f, world);
 
-    ASSERT_FALSE(emitter->getParticles().empty());
-    EXPECT_FALSE(emitter->getParticles().front().alive);
+    EXPECT_TRUE(emitter->getParticles().empty());
     EXPECT_EQ(emitter->getAliveCount(), 0u);
 }
 
@@ -105,7 +112,6 @@ TEST(SParticleTest, UpdateAdvancesParticlePhysicsAndEffects)
     emitter->setShrinkEndScale(0.5f);
 
     Components::Particle particle;
-    particle.alive        = true;
     particle.age          = 0.0f;
     particle.lifetime     = 2.0f;
     particle.position     = Vec2(0.0f, 0.0f);
@@ -116,7 +122,7 @@ TEST(SParticleTest, UpdateAdvancesParticlePhysicsAndEffects)
     particle.rotation     = 0.0f;
     particle.rotationSpeed = 1.0f;
     particle.alpha        = 1.0f;
-    emitter->getParticles().push_back(particle);
+    emitter->getParticles().push(particle);
 
     Systems::SParticle system;
     system.initialize(nullptr);
@@ -124,8 +130,8 @@ TEST(SParticleTest, UpdateAdvancesParticlePhysicsAndEffects)
     constexpr float dt = 0.5f;
     system.update(dt, world);
 
-    const auto& p = emitter->getParticles().front();
-    ASSERT_TRUE(p.alive);
+    ASSERT_EQ(emitter->getAliveCount(), 1u);
+    const auto p = emitter->getParticles().get(0);
 
     // Velocity integrates acceleration first.
     const float expectedVx = 1.0f + 0.1f * dt;
@@ -145,3 +151,440 @@ TEST(SParticleTest, UpdateAdvancesParticlePhysicsAndEffects)
     EXPECT_LT(p.alpha, 1.0f);
     EXPECT_LT(p.size, 1.0f);
 }
+
+TEST(SParticleTest, UpdateSamplesLifetimeCurves)
+{
+    World world;
+
+    Entity entity = world.createEntity();
+    world.components().add<Components::CTransform>(entity);
+    auto* emitter = world.components().add<Components::CParticleEmitter>(entity);
+    emitter->setEmissionRate(0.0f);
+    emitter->setGravity(Vec2(0.0f, 0.0f));
+    emitter->setFadeOut(true);
+    emitter->setShrink(true);
+    emitter->setColorGradient(Components::ColorGradient().addKey(0.0f, Color::Red));
+    emitter->setAlphaCurve(Components::FloatCurve().addKey(1.0f, 0.0f).addKey(0.0f, 1.0f));
+    emitter->setSizeCurve(Components::FloatCurve().addKey(0.0f, 2.0f));
+    emitter->setSpeedCurve(Components::FloatCurve().addKey(0.0f, 0.5f));
+
+    Components::Particle particle;
+    particle.lifetime    = 2.0f;
+    particle.velocity    = Vec2(1.0f, 2.0f);
+    particle.initialSize = 1.0f;
+    particle.size        = 1.0f;
+    emitter->getParticles().push(particle);
+
+    Systems::SParticle system;
+    system.initialize(nullptr);
+
+    constexpr float dt = 0.5f;
+    system.update(dt, world);
+
+    ASSERT_EQ(emitter->getAliveCount(), 1u);
+    const auto p = emitter->getParticles().get(0);
+
+    // Curves replace the start/end blends and the shrink scale.
+    EXPECT_EQ(p.color, Color::Red);
+    EXPECT_NEAR(p.alpha, 0.75f, 1.0f / static_cast<float>(Components::kParticleCurveSamples - 1));
+    EXPECT_FLOAT_EQ(p.size, 2.0f);
+
+    // The speed curve halves the distance moved.
+    EXPECT_NEAR(p.position.x, 1.0f * dt * 0.5f, 1e-5f);
+    EXPECT_NEAR(p.position.y, 2.0f * dt * 0.5f, 1e-5f);
+}
+
+TEST(SParticleTest, UpdateEmitsEveryDueParticleInOneStep)
+{
+    World world;
+
+    Entity entity = world.createEntity();
+    world.components().add<Components::CTransform>(entity);
+    auto* emitter = world.components().add<Components::CParticleEmitter>(entity);
+    emitter->setEmissionRate(1024.0f);
+    emitter->setMaxParticles(10000);
+    emitter->setMinLifetime(10.0f);
+    emitter->setMaxLifetime(10.0f);
+
+    Systems::SParticle system;
+    system.initialize(nullptr);
+    system.update(0.5f, world);
+
+    EXPECT_EQ(emitter->getAliveCount(), 512u);
+    EXPECT_LT(emitter->getEmissionTimer(), 1.0f / 1024.0f);
+}
+
+TEST(SParticleTest, BurstSpawnsQueuedParticlesClampedToLimit)
+{
+    World world;
+
+    Entity entity = world.createEntity();
+    world.components().add<Components::CTransform>(entity);
+    auto* emitter = world.components().add<Components::CParticleEmitter>(entity);
+    emitter->setEmissionRate(0.0f);
+    emitter->setMaxParticles(50);
+    emitter->setMinLifetime(10.0f);
+    emitter->setMaxLifetime(10.0f);
+    emitter->setBurstCount(30.0f);
+
+    Systems::SParticle system;
+    system.initialize(nullptr);
+
+    emitter->triggerBurst();
+    system.update(0.1f, world);
+    EXPECT_EQ(emitter->getAliveCount(), 30u);
+    EXPECT_EQ(emitter->getPendingBurst(), 0);
+
+    // Second burst only has room for 20 more.
+    emitter->triggerBurst();
+    system.update(0.1f, world);
+    EXPECT_EQ(emitter->getAliveCount(), 50u);
+    EXPECT_EQ(emitter->getParticles().capacity(), 50u);
+
+    // Inactive emitters keep their burst queued.
+    emitter->getParticles().clear();
+    emitter->setActive(false);
+    emitter->burst(5);
+    system.update(0.1f, world);
+    EXPECT_EQ(emitter->getAliveCount(), 0u);
+    EXPECT_EQ(emitter->getPendingBurst(), 5);
+}
+
+namespace
+{
+
+// Two emitters: one large enough to be split into ranges, one small.
+std::vector<Components::Particle> simulateSeeded(std::uint64_t seed, std::size_t workers)
+{
+    World world;
+    for (int i = 0; i < 2; ++i)
+    {
+        Entity entity = world.createEntity();
+        world.components().add<Components::CTransform>(entity);
+        auto* emitter = world.components().add<Components::CParticleEmitter>(entity);
+        emitter->setEmissionShape(Components::EmissionShape::Circle);
+        emitter->setEmissionRate(i == 0 ? 0.0f : 256.0f);
+        emitter->setMaxParticles(100000);
+        emitter->setMinLifetime(0.5f);
+        emitter->setMaxLifetime(2.0f);
+        if (i == 0)
+        {
+            emitter->burst(static_cast<int>(Systems::SParticle::kParallelRangeSize * 2 + 100));
+        }
+    }
+
+    Systems::SParticle system;
+    system.initialize(nullptr);
+    system.setWorkerCount(workers);
+    system.setSeed(seed);
+    for (int step = 0; step < 30; ++step)
+    {
+        system.update(1.0f / 30.0f, world);
+    }
+
+    std::vector<Components::Particle> result;
+    world.components().each<Components::CParticleEmitter>(
+        [&result](Entity, Components::CParticleEmitter& emitter)
+        {
+            const auto& particles = emitter.getParticles();
+            for (std::size_t i = 0; i < particles.count(); ++i)
+            {
+                result.push_back(particles.get(i));
+            }
+        });
+    return result;
+}
+
+}  // namespace
+
+TEST(SParticleTest, SeededUpdateIsIndependentOfWorkerCount)
+{
+    const auto serial   = simulateSeeded(42, 1);
+    const auto parallel = simulateSeeded(42, 4);
+
+    ASSERT_FALSE(serial.empty());
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (std::size_t i = 0; i < serial.size(); ++i)
+    {
+        EXPECT_EQ(serial[i].position.x, parallel[i].position.x);
+        EXPECT_EQ(serial[i].position.y, parallel[i].position.y);
+        EXPECT_EQ(serial[i].velocity.x, parallel[i].velocity.x);
+        EXPECT_EQ(serial[i].age, parallel[i].age);
+        EXPECT_EQ(serial[i].lifetime, parallel[i].lifetime);
+    }
+
+    const auto reseeded = simulateSeeded(43, 4);
+    ASSERT_FALSE(reseeded.empty());
+    EXPECT_NE(serial.front().lifetime, reseeded.front().lifetime);
+}
+
+TEST(SParticleTest, EmitterSeedOverridesSystemSeed)
+{
+    auto spawnOne = [](std::uint64_t systemSeed)
+    {
+        World  world;
+        Entity entity = world.createEntity();
+        world.components().add<Components::CTransform>(entity);
+        auto* emitter = world.components().add<Components::CParticleEmitter>(entity);
+        emitter->setEmissionRate(0.0f);
+        emitter->setRandomSeed(7);
+        emitter->burst(1);
+
+        Systems::SParticle system;
+        system.initialize(nullptr);
+        system.setSeed(systemSeed);
+        system.update(0.0f, world);
+        return emitter->getParticles().get(0);
+    };
+
+    const auto a = spawnOne(1);
+    const auto b = spawnOne(2);
+    EXPECT_EQ(a.lifetime, b.lifetime);
+    EXPECT_EQ(a.velocity.x, b.velocity.x);
+    EXPECT_EQ(a.rotation, b.rotation);
+}
+
+TEST(SParticleTest, OffscreenEmitterOnlyAgesParticles)
+{
+    World world;
+
+    Entity cameraEntity = world.createEntity();
+    world.components().add<Components::CCamera>(cameraEntity);
+
+    auto addEmitter = [&world](float x)
+    {
+        Entity entity       = world.createEntity();
+        auto*  transform    = world.components().add<Components::CTransform>(entity);
+        transform->position = Vec2(x, 0.0f);
+        auto* emitter       = world.components().add<Components::CParticleEmitter>(entity);
+        emitter->setEmissionRate(64.0f);
+
+        Components::Particle particle;
+        particle.lifetime = 2.0f;
+        particle.position = Vec2(x, 0.0f);
+        particle.velocity = Vec2(1.0f, 0.0f);
+        emitter->getParticles().push(particle);
+        return entity;
+    };
+    Entity onScreenEntity  = addEmitter(0.0f);
+    Entity offScreenEntity = addEmitter(1000.0f);
+
+    // Component storage may move while adding, so look emitters up afterwards.
+    auto* onScreen  = world.components().get<Components::CParticleEmitter>(onScreenEntity);
+    auto* offScreen = world.components().get<Components::CParticleEmitter>(offScreenEntity);
+    offScreen->burst(10);
+
+    Systems::SParticle system;
+    system.initialize(nullptr);
+    system.setSeed(1);
+    system.update(0.5f, world);
+
+    EXPECT_EQ(system.getCulledEmitterCount(), 1u);
+    EXPECT_GT(onScreen->getAliveCount(), 1u);
+
+    // Aged only: no motion, no emission, and the queued burst is dropped.
+    ASSERT_EQ(offScreen->getAliveCount(), 1u);
+    EXPECT_FLOAT_EQ(offScreen->getParticles().get(0).age, 0.5f);
+    EXPECT_FLOAT_EQ(offScreen->getParticles().get(0).position.x, 1000.0f);
+    EXPECT_EQ(offScreen->getPendingBurst(), 0);
+
+    // Expiry still happens off-screen.
+    system.update(2.0f, world);
+    EXPECT_EQ(offScreen->getAliveCount(), 0u);
+
+    system.setCullingEnabled(false);
+    system.update(0.5f, world);
+    EXPECT_EQ(system.getCulledEmitterCount(), 0u);
+    EXPECT_GT(offScreen->getAliveCount(), 0u);
+}
+
+TEST(SParticleTest, ParticleBudgetSharesSpawnsByImportance)
+{
+    World world;
+
+    auto addEmitter = [&world](float importance)
+    {
+        Entity entity = world.createEntity();
+        world.components().add<Components::CTransform>(entity);
+        auto* emitter = world.components().add<Components::CParticleEmitter>(entity);
+        emitter->setEmissionRate(0.0f);
+        emitter->setMaxParticles(1000);
+        emitter->setImportance(importance);
+        emitter->burst(100);
+        return entity;
+    };
+    Entity importantEntity = addEmitter(3.0f);
+    Entity minorEntity     = addEmitter(1.0f);
+    auto*  important       = world.components().get<Components::CParticleEmitter>(importantEntity);
+    auto*  minor           = world.components().get<Components::CParticleEmitter>(minorEntity);
+
+    Systems::SParticle system;
+    system.initialize(nullptr);
+    system.setParticleBudget(100);
+    system.update(0.0f, world);
+
+    EXPECT_EQ(important->getAliveCount(), 75u);
+    EXPECT_EQ(minor->getAliveCount(), 25u);
+
+    // A full budget admits nothing new until particles expire.
+    important->burst(10);
+    system.update(0.0f, world);
+    EXPECT_EQ(important->getAliveCount() + minor->getAliveCount(), 100u);
+}
+
+namespace
+{
+
+/// Fires one particle from x = 0.5 into a static wall spanning x = [0.9, 1.1] and returns it (if alive)
+std::vector<Components::Particle> fireAtWall(Components::ParticleCollision mode, std::uint64_t mask = ~0ull)
+{
+    World               world;
+    Systems::S2DPhysics physics;
+    physics.bindWorld(&world);
+
+    Entity wall = world.createEntity();
+    world.add<Components::CTransform>(wall, Components::CTransform{{1.0f, 0.0f}, {1.0f, 1.0f}, 0.0f});
+    {
+        Components::CPhysicsBody2D body;
+        body.bodyType = Components::BodyType::Static;
+        world.add<Components::CPhysicsBody2D>(wall, body);
+    }
+    {
+        Components::CCollider2D collider;
+        collider.createBox(0.1f, 5.0f);
+        world.add<Components::CCollider2D>(wall, collider);
+    }
+    physics.fixedUpdate(physics.getTimeStep(), world);
+
+    Entity entity = world.createEntity();
+    world.components().add<Components::CTransform>(entity);
+    auto* emitter = world.components().add<Components::CParticleEmitter>(entity);
+    emitter->setEmissionRate(0.0f);
+    emitter->setCollisionMode(mode);
+    emitter->setCollisionMask(mask);
+    emitter->setCollisionRestitution(1.0f);
+    emitter->setCollisionFriction(0.0f);
+
+    Components::Particle particle;
+    particle.lifetime = 10.0f;
+    particle.position = Vec2(0.5f, 0.0f);
+    particle.velocity = Vec2(2.0f, 0.0f);
+    emitter->getParticles().push(particle);
+
+    Systems::SParticle system;
+    system.initialize(nullptr);
+    system.setPhysics(&physics);
+    system.update(0.5f, world);
+
+    std::vector<Components::Particle> alive;
+    for (std::size_t i = 0; i < emitter->getParticles().count(); ++i)
+    {
+        alive.push_back(emitter->getParticles().get(i));
+    }
+    return alive;
+}
+
+}  // namespace
+
+TEST(SParticleTest, CollidingParticlesRespondToPhysicsShapes)
+{
+    const auto bounced = fireAtWall(Components::ParticleCollision::Bounce);
+    ASSERT_EQ(bounced.size(), 1u);
+    EXPECT_NEAR(bounced[0].velocity.x, -2.0f, 1e-4f);
+    EXPECT_LT(bounced[0].position.x, 0.9f);
+
+    const auto stuck = fireAtWall(Components::ParticleCollision::Stick);
+    ASSERT_EQ(stuck.size(), 1u);
+    EXPECT_EQ(stuck[0].velocity.x, 0.0f);
+    EXPECT_NEAR(stuck[0].position.x, 0.9f, 1e-2f);
+
+    EXPECT_TRUE(fireAtWall(Components::ParticleCollision::Die).empty());
+
+    // Walls outside the collision mask (colliders default to category 1) are ignored.
+    const auto filtered = fireAtWall(Components::ParticleCollision::Die, ~0ull << 1);
+    ASSERT_EQ(filtered.size(), 1u);
+    EXPECT_NEAR(filtered[0].position.x, 1.5f, 1e-4f);
+}
+
+TEST(SParticleTest, RemoveExpiredKeepsAliveParticlesContiguous)
+{
+    Components::ParticleBuffer particles;
+    for (int i = 0; i < 6; ++i)
+    {
+        Components::Particle particle;
+        particle.lifetime   = 1.0f;
+        particle.age        = (i % 2 == 0) ? 1.0f : 0.5f;  // Even indices have expired
+        particle.position.x = static_cast<float>(i);
+        particles.push(particle);
+    }
+
+    EXPECT_EQ(particles.removeExpired(), 3u);
+    ASSERT_EQ(particles.count(), 3u);
+
+    // Survivors (odd x) fill the prefix, in swap-with-last order.
+    float sum = 0.0f;
+    for (std::size_t i = 0; i < particles.count(); ++i)
+    {
+        EXPECT_LT(particles.age[i], particles.lifetime[i]);
+        sum += particles.positionX[i];
+    }
+    EXPECT_FLOAT_EQ(sum, 1.0f + 3.0f + 5.0f);
+}
+
+TEST(SParticleTest, VectorKernelMatchesScalarKernel)
+{
+    // 37 is not a multiple of any vector width, so the scalar tail runs too.
+    Components::ParticleBuffer vectorized;
+    for (int i = 0; i < 37; ++i)
+    {
+        const float f = static_cast<float>(i);
+        Components::Particle particle;
+        particle.position      = Vec2(f, -f);
+        particle.velocity      = Vec2(0.5f * f, 1.0f);
+        particle.acceleration  = Vec2(0.0f, -9.8f);
+        particle.lifetime      = 1.0f + 0.1f * f;
+        particle.age           = 0.01f * f;
+        particle.initialSize   = 0.25f + 0.01f * f;
+        particle.size          = particle.initialSize;
+        particle.rotationSpeed = 0.2f * f;
+        vectorized.push(particle);
+    }
+    Components::ParticleBuffer scalar = vectorized;
+
+    Systems::ParticleUpdateParams params;
+    params.deltaTime      = 1.0f / 60.0f;
+    params.startColor     = Color(255, 0, 0);
+    params.endColor       = Color(0, 0, 255);
+    params.startAlpha     = 1.0f;
+    params.endAlpha       = 0.0f;
+    params.shrinkEndScale = 0.5f;
+    params.fadeOut        = true;
+    params.shrink         = true;
+
+    Systems::integrateParticles(vectorized, 0, vectorized.count(), params);
+    Systems::integrateParticlesScalar(scalar, 0, scalar.count(), params);
+
+    for (std::size_t i = 0; i < scalar.count(); ++i)
+    {
+        EXPECT_FLOAT_EQ(vectorized.positionX[i], scalar.positionX[i]);
+        EXPECT_FLOAT_EQ(vectorized.positionY[i], scalar.positionY[i]);
+        EXPECT_FLOAT_EQ(vectorized.velocityY[i], scalar.velocityY[i]);
+        EXPECT_FLOAT_EQ(vectorized.age[i], scalar.age[i]);
+        EXPECT_FLOAT_EQ(vectorized.rotation[i], scalar.rotation[i]);
+        EXPECT_FLOAT_EQ(vectorized.alpha[i], scalar.alpha[i]);
+        EXPECT_FLOAT_EQ(vectorized.size[i], scalar.size[i]);
+        EXPECT_EQ(vectorized.color[i], scalar.color[i]);
+    }
+}
+
+TEST(SParticleTest, CurveIndexClampsAgeAndSendsNaNToTheLastSample)
+{
+    using Components::ParticleCurveTables;
+    const std::size_t last = Components::kParticleCurveSamples - 1;
+
+    EXPECT_EQ(ParticleCurveTables::index(-0.5f), 0u);
+    EXPECT_EQ(ParticleCurveTables::index(0.0f), 0u);
+    EXPECT_EQ(ParticleCurveTables::index(1.0f), last);
+    EXPECT_EQ(ParticleCurveTables::index(3.0f), last);
+    EXPECT_EQ(ParticleCurveTables::index(std::nanf("")), last);
+}
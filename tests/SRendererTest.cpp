@@ -0,0 +1,428 @@
+#include <gtest/gtest.h>
+
+#include <CCamera.h>
+#include <CMaterial.h>
+#include <CParticleEmitter.h>
+#include <CRenderable.h>
+#include <CShader.h>
+#include <CTexture.h>
+#include <CTilemap.h>
+#include <CTransform.h>
+#include <World.h>
+
+#include <filesystem>
+#include <string>
+
+#define private public
+#include <SParticle.h>
+#include <SRenderer.h>
+#undef private
+
+namespace
+{
+
+// Renderer tests that draw need a GL context; machines without one skip them.
+bool initializeOffscreen(Systems::SRenderer& renderer)
+{
+    Systems::WindowConfig config;
+    config.width     = 64;
+    config.height    = 64;
+    config.offscreen = true;
+    return renderer.initialize(config);
+}
+
+Entity addCamera(World& world)
+{
+    Components::CCamera camera;
+    camera.worldHeight = 8.0f;
+    Entity entity      = world.createEntity();
+    world.components().add<Components::CCamera>(entity, camera);
+    return entity;
+}
+
+Entity addStaticRect(World& world, const Vec2& position, int zIndex)
+{
+    Entity entity = world.createEntity();
+    world.components().add<Components::CTransform>(entity, position, Vec2(1.0f, 1.0f), 0.0f);
+    world.components()
+        .add<Components::CRenderable>(entity, Components::VisualType::Rectangle, Color::White, zIndex)
+        ->setStatic(true);
+    return entity;
+}
+
+Entity addEmitter(World& world, const Vec2& position, const std::string& texturePath)
+{
+    Entity entity = world.createEntity();
+    world.components().add<Components::CTransform>(entity, position, Vec2(1.0f, 1.0f), 0.0f);
+    auto* emitter = world.components().add<Components::CParticleEmitter>(entity);
+    emitter->setEmissionRate(100.0f);
+    emitter->setMaxParticles(50);
+    emitter->setMinLifetime(5.0f);
+    emitter->setMaxLifetime(5.0f);
+    emitter->setTexturePath(texturePath);
+    return entity;
+}
+
+// Saves a small single-colour texture to the temp directory and loads it into the renderer's cache.
+std::string loadTestTexture(Systems::SRenderer& renderer, const char* name, const sf::Color& color)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / name).string();
+    if (!sf::Image(sf::Vector2u{4, 4}, color).saveToFile(path) || !renderer.loadTexture(path))
+    {
+        return {};
+    }
+    return path;
+}
+
+}  // namespace
+
+TEST(SRendererTest, TextureHandleIsStableForSamePath)
+{
+    Systems::SRenderer renderer;
+
+    const AssetHandle first  = renderer.resolveTextureHandle("assets/textures/does_not_exist.png");
+    const AssetHandle second = renderer.resolveTextureHandle("assets/textures/does_not_exist.png");
+    const AssetHandle other  = renderer.resolveTextureHandle("assets/textures/also_missing.png");
+
+    EXPECT_NE(first, kInvalidAssetHandle);
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+}
+
+TEST(SRendererTest, EmptyPathsResolveToInvalidHandle)
+{
+    Systems::SRenderer renderer;
+
+    EXPECT_EQ(renderer.resolveTextureHandle(""), kInvalidAssetHandle);
+    EXPECT_EQ(renderer.resolveShaderHandle("", ""), kInvalidAssetHandle);
+    EXPECT_EQ(renderer.getTexture(kInvalidAssetHandle), nullptr);
+    EXPECT_EQ(renderer.getShader(kInvalidAssetHandle), nullptr);
+}
+
+TEST(SRendererTest, UnloadedTextureIsNotReturnedWithoutWindow)
+{
+    Systems::SRenderer renderer;
+
+    const AssetHandle handle = renderer.resolveTextureHandle("assets/textures/does_not_exist.png");
+    EXPECT_EQ(renderer.getTexture(handle), nullptr);
+
+    // Handles survive a cache clear.
+    renderer.clearTextureCache();
+    EXPECT_EQ(renderer.resolveTextureHandle("assets/textures/does_not_exist.png"), handle);
+}
+
+TEST(SRendererTest, ChangingAssetPathInvalidatesComponentHandle)
+{
+    Components::CTexture texture("a.png");
+    texture.textureHandle = 3;
+    texture.setTexturePath("b.png");
+    EXPECT_EQ(texture.textureHandle, kInvalidAssetHandle);
+    EXPECT_EQ(texture.getTexturePath(), "b.png");
+
+    // Re-setting the same path keeps the resolved handle.
+    texture.textureHandle = 4;
+    texture.setTexturePath("b.png");
+    EXPECT_EQ(texture.textureHandle, 4u);
+
+    Components::CShader shader;
+    shader.shaderHandle = 5;
+    shader.setFragmentShaderPath("shaders/x.frag");
+    EXPECT_EQ(shader.shaderHandle, kInvalidAssetHandle);
+}
+
+TEST(SRendererTest, MaterialUniformHashTracksContent)
+{
+    Components::CMaterial a;
+    Components::CMaterial b;
+    EXPECT_EQ(a.getUniformsHash(), 0u);
+
+    a.setUniform("u_strength", 0.5f);
+    b.setUniform("u_strength", 0.5f);
+    EXPECT_NE(a.getUniformsHash(), 0u);
+    EXPECT_EQ(a.getUniformsHash(), b.getUniformsHash());
+
+    const std::uint64_t before = a.getUniformsHash();
+    a.setUniform("u_strength", 0.5f);
+    EXPECT_EQ(a.getUniformsHash(), before);
+
+    a.setUniform("u_strength", 0.75f);
+    EXPECT_NE(a.getUniformsHash(), before);
+    EXPECT_EQ(a.getUniforms().size(), 1u);
+
+    EXPECT_TRUE(a.removeUniform("u_strength"));
+    EXPECT_EQ(a.getUniformsHash(), 0u);
+}
+
+TEST(SRendererTest, RenderStatsCountsBindsAndSwitchesOnChange)
+{
+    Systems::RenderStats stats;
+    stats.reset(1);
+
+    const auto* textureA = reinterpret_cast<const sf::Texture*>(0x10);
+    const auto* textureB = reinterpret_cast<const sf::Texture*>(0x20);
+    const auto* shader   = reinterpret_cast<const sf::Shader*>(0x30);
+
+    stats.recordDraw(textureA, nullptr, 6);
+    stats.recordDraw(textureA, nullptr, 6);
+    stats.recordDraw(textureB, shader, 4);
+    stats.recordDraw(textureB, nullptr, 4);
+
+    EXPECT_EQ(stats.frame, 1u);
+    EXPECT_EQ(stats.drawCalls, 4u);
+    EXPECT_EQ(stats.vertices, 20u);
+    EXPECT_EQ(stats.textureBinds, 2u);
+    EXPECT_EQ(stats.shaderSwitches, 2u);
+
+    stats.reset(2);
+    EXPECT_EQ(stats.frame, 2u);
+    EXPECT_EQ(stats.drawCalls, 0u);
+
+    // The first draw of a frame always counts as a bind.
+    stats.recordDraw(textureA, nullptr, 6);
+    EXPECT_EQ(stats.textureBinds, 1u);
+    EXPECT_EQ(stats.shaderSwitches, 0u);
+}
+
+TEST(SRendererTest, RenderStatsStartEmpty)
+{
+    Systems::SRenderer renderer;
+
+    const Systems::RenderStats& stats = renderer.getRenderStats();
+    EXPECT_EQ(stats.drawCalls, 0u);
+    EXPECT_TRUE(stats.cameras.empty());
+}
+
+TEST(SRendererTest, NoRenderTargetBeforeInitialize)
+{
+    Systems::SRenderer renderer;
+
+    EXPECT_EQ(renderer.getRenderTarget(), nullptr);
+    EXPECT_EQ(renderer.getWindow(), nullptr);
+    EXPECT_FALSE(renderer.isOffscreen());
+    EXPECT_EQ(renderer.captureFrame().getSize(), sf::Vector2u(0, 0));
+}
+
+TEST(SRendererTest, AlphaBlendedStaticLayerIsCachedAndSurvivesBeingHidden)
+{
+    Systems::SRenderer renderer;
+    if (!initializeOffscreen(renderer))
+    {
+        GTEST_SKIP() << "no offscreen render target available";
+    }
+
+    World  world;
+    Entity camera = addCamera(world);
+    Entity wall   = addStaticRect(world, Vec2(0.0f, 0.0f), 0);
+
+    renderer.render(world);
+    EXPECT_EQ(renderer.getRenderStats().staticLayers, 1u);
+    EXPECT_EQ(renderer.getRenderStats().staticRebuilds, 1u);
+
+    renderer.render(world);
+    EXPECT_EQ(renderer.getRenderStats().staticLayers, 1u);
+    EXPECT_EQ(renderer.getRenderStats().staticRebuilds, 0u);
+
+    // A layer skipped for a frame keeps its texture instead of being rebuilt.
+    world.components().get<Components::CRenderable>(wall)->setVisible(false);
+    renderer.render(world);
+    EXPECT_EQ(renderer.getRenderStats().staticLayers, 0u);
+    world.components().get<Components::CRenderable>(wall)->setVisible(true);
+    renderer.render(world);
+    EXPECT_EQ(renderer.getRenderStats().staticLayers, 1u);
+    EXPECT_EQ(renderer.getRenderStats().staticRebuilds, 0u);
+    EXPECT_EQ(renderer.m_staticLayers.size(), 1u);
+
+    // Removing the camera drops its layers.
+    world.components().remove<Components::CCamera>(camera);
+    addCamera(world);
+    renderer.render(world);
+    EXPECT_EQ(renderer.m_staticLayers.size(), 1u);
+    EXPECT_EQ(renderer.getRenderStats().staticRebuilds, 1u);
+}
+
+TEST(SRendererTest, StaticsWithShaderOrNonAlphaBlendAreDrawnDirectly)
+{
+    Systems::SRenderer renderer;
+    if (!initializeOffscreen(renderer))
+    {
+        GTEST_SKIP() << "no offscreen render target available";
+    }
+
+    World world;
+    addCamera(world);
+    Entity additive = addStaticRect(world, Vec2(-1.0f, 0.0f), 0);
+    world.components().add<Components::CMaterial>(additive)->setBlendMode(Components::BlendMode::Add);
+    Entity shaded = addStaticRect(world, Vec2(1.0f, 0.0f), 1);
+    world.components().add<Components::CShader>(shaded, "", "shaders/does_not_exist.frag");
+
+    renderer.render(world);
+    EXPECT_EQ(renderer.getRenderStats().staticLayers, 0u);
+    EXPECT_EQ(renderer.getRenderStats().staticRebuilds, 0u);
+    EXPECT_GE(renderer.getRenderStats().drawCalls, 2u);
+}
+
+TEST(SRendererTest, ErasedTileStopsDrawingAndMeshSurvivesCulledFrames)
+{
+    Systems::SRenderer renderer;
+    if (!initializeOffscreen(renderer))
+    {
+        GTEST_SKIP() << "no offscreen render target available";
+    }
+
+    // A one-tile atlas of a single colour.
+    const sf::Color   kTileColor(255, 0, 0);
+    const std::string atlasPath = (std::filesystem::temp_directory_path() / "entityforge_test_tile.png").string();
+    ASSERT_TRUE(sf::Image(sf::Vector2u{16, 16}, kTileColor).saveToFile(atlasPath));
+    ASSERT_NE(renderer.loadTexture(atlasPath), nullptr);
+
+    // 8 pixels per world unit; the map's bottom-left sits at the camera centre.
+    World  world;
+    Entity camera = addCamera(world);
+    Entity map    = world.createEntity();
+    world.components().add<Components::CTransform>(map, Vec2(0.0f, 0.0f), Vec2(1.0f, 1.0f), 0.0f);
+    auto* tilemap = world.components().add<Components::CTilemap>(map, 2u, 1u, 1.0f, atlasPath);
+    tilemap->setTilePixelSize(16, 16);
+    tilemap->setTile(0, 0, 0);
+    tilemap->setTile(1, 0, 0);
+
+    const sf::Vector2u secondTilePixel{44, 28};
+    renderer.clear(Color::Black);
+    renderer.render(world);
+    EXPECT_EQ(renderer.getRenderStats().vertices, 12u);
+    EXPECT_EQ(renderer.captureFrame().getPixel(secondTilePixel), kTileColor);
+
+    world.components().get<Components::CTilemap>(map)->setTile(1, 0, -1);
+    renderer.clear(Color::Black);
+    renderer.render(world);
+    EXPECT_EQ(renderer.getRenderStats().tileChunkBuilds, 1u);
+    EXPECT_EQ(renderer.getRenderStats().vertices, 6u);
+    EXPECT_NE(renderer.captureFrame().getPixel(secondTilePixel), kTileColor);
+
+    // Off camera for a frame: the chunk mesh is kept and not rebuilt when the map returns.
+    world.components().get<Components::CCamera>(camera)->position = Vec2(100.0f, 100.0f);
+    renderer.render(world);
+    EXPECT_EQ(renderer.m_tilemaps.size(), 1u);
+    world.components().get<Components::CCamera>(camera)->position = Vec2(0.0f, 0.0f);
+    renderer.render(world);
+    EXPECT_EQ(renderer.getRenderStats().tileChunkBuilds, 0u);
+    EXPECT_EQ(renderer.getRenderStats().tileChunks, 1u);
+
+    world.components().remove<Components::CTilemap>(map);
+    renderer.render(world);
+    EXPECT_TRUE(renderer.m_tilemaps.empty());
+
+    std::filesystem::remove(atlasPath);
+}
+
+TEST(SRendererTest, AdjacentEmittersSharingATextureDrawTogether)
+{
+    Systems::SRenderer renderer;
+    if (!initializeOffscreen(renderer))
+    {
+        GTEST_SKIP() << "no offscreen render target available";
+    }
+
+    const std::string red  = loadTestTexture(renderer, "entityforge_test_particle_red.png", sf::Color(255, 0, 0));
+    const std::string blue = loadTestTexture(renderer, "entityforge_test_particle_blue.png", sf::Color(0, 0, 255));
+    ASSERT_FALSE(red.empty());
+    ASSERT_FALSE(blue.empty());
+
+    Systems::SParticle particles;
+    particles.initialize(renderer.getRenderTarget());
+    particles.setTextureLoader(&renderer.getTextureLoader());
+    renderer.setParticleSystem(&particles);
+
+    World world;
+    addCamera(world);
+    addEmitter(world, Vec2(-1.0f, 0.0f), red);
+    Entity second = addEmitter(world, Vec2(1.0f, 0.0f), red);
+    particles.update(0.1f, world);
+
+    renderer.render(world);
+    EXPECT_EQ(renderer.getRenderStats().particleEmitters, 2u);
+    EXPECT_EQ(renderer.getRenderStats().drawCalls, 1u);
+
+    // A different texture splits the run; each emitter keeps its own slice of the vertex array.
+    world.components().get<Components::CParticleEmitter>(second)->setTexturePath(blue);
+    renderer.render(world);
+    EXPECT_EQ(renderer.getRenderStats().particleEmitters, 2u);
+    EXPECT_EQ(renderer.getRenderStats().drawCalls, 2u);
+
+    ASSERT_EQ(particles.m_drawEmitters.size(), 2u);
+    std::size_t end = 0;
+    for (const auto& drawn : particles.m_drawEmitters)
+    {
+        EXPECT_GE(drawn.firstVertex, end);
+        EXPECT_GT(drawn.particles->count(), 0u);
+        end = drawn.firstVertex + drawn.particles->count() * 6;  // Two triangles per particle
+    }
+    EXPECT_EQ(end, particles.m_vertexArray.getVertexCount());
+    EXPECT_EQ(renderer.getRenderStats().vertices, end);
+
+    renderer.setParticleSystem(nullptr);
+    particles.shutdown();
+    std::filesystem::remove(red);
+    std::filesystem::remove(blue);
+}
+
+TEST(SRendererTest, CameraCullingMaskSkipsExcludedLayers)
+{
+    Systems::SRenderer renderer;
+    if (!initializeOffscreen(renderer))
+    {
+        GTEST_SKIP() << "no offscreen render target available";
+    }
+
+    const std::string texture = loadTestTexture(renderer, "entityforge_test_layer.png", sf::Color(0, 255, 0));
+    ASSERT_FALSE(texture.empty());
+
+    Systems::SParticle particles;
+    particles.initialize(renderer.getRenderTarget());
+    particles.setTextureLoader(&renderer.getTextureLoader());
+    renderer.setParticleSystem(&particles);
+
+    // The main camera draws every layer; the second only the default one.
+    constexpr std::uint32_t kEffectsLayer = 1u << 3;
+    World                   world;
+    addCamera(world);
+    Components::CCamera minimap;
+    minimap.name        = "Minimap";
+    minimap.renderOrder = 1;
+    minimap.worldHeight = 8.0f;
+    minimap.cullingMask = Components::kRenderLayerDefault;
+    world.components().add<Components::CCamera>(world.createEntity(), minimap);
+
+    Entity shared = world.createEntity();
+    world.components().add<Components::CTransform>(shared, Vec2(0.0f, 0.0f), Vec2(1.0f, 1.0f), 0.0f);
+    world.components().add<Components::CRenderable>(shared, Components::VisualType::Rectangle, Color::White, 0);
+
+    Entity emitter = addEmitter(world, Vec2(1.0f, 0.0f), texture);
+    world.components().get<Components::CParticleEmitter>(emitter)->setRenderLayers(kEffectsLayer);
+    particles.update(0.1f, world);
+
+    Entity map = world.createEntity();
+    world.components().add<Components::CTransform>(map, Vec2(-2.0f, -2.0f), Vec2(1.0f, 1.0f), 0.0f);
+    auto* tilemap = world.components().add<Components::CTilemap>(map, 1u, 1u, 1.0f, texture);
+    tilemap->setTilePixelSize(4, 4);
+    tilemap->setTile(0, 0, 0);
+    tilemap->renderLayers = kEffectsLayer;
+
+    renderer.render(world);
+    const Systems::RenderStats& stats = renderer.getRenderStats();
+    ASSERT_EQ(stats.cameras.size(), 2u);
+    EXPECT_EQ(stats.cameras[0].name, "Main");
+    EXPECT_EQ(stats.cameras[0].itemsSubmitted, 3u);
+    EXPECT_EQ(stats.cameras[0].itemsCulled, 0u);
+    EXPECT_EQ(stats.cameras[1].name, "Minimap");
+    EXPECT_EQ(stats.cameras[1].itemsSubmitted, 1u);
+    EXPECT_EQ(stats.cameras[1].itemsCulled, 2u);
+    EXPECT_EQ(stats.culledItems, 2u);
+
+    // The emitter and the tilemap are drawn for the main camera only.
+    EXPECT_EQ(stats.particleEmitters, 1u);
+    EXPECT_EQ(stats.tileChunks, 1u);
+
+    renderer.setParticleSystem(nullptr);
+    particles.shutdown();
+    std::filesystem::remove(texture);
+}
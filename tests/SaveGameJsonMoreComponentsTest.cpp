@@ -57,15 +57,38 @@ TEST(SaveGameJson, RoundTripMoreBuiltInComponents)
     r.lineStart     = Vec2(-1.0f, 2.0f);
     r.lineEnd       = Vec2(3.0f, -4.0f);
     r.lineThickness = 7.5f;
+    r.lineCap       = Components::LineCap::Round;
+    r.staticLayer   = true;
+    r.renderLayers  = 0x6u;
     world.add<Components::CRenderable>(e, r);
 
-    world.add<Components::CTexture>(e, Components::CTexture{"assets/textures/does_not_need_to_exist.png"});
+    Components::CTexture texture{"assets/textures/does_not_need_to_exist.png"};
+    texture.textureRect = Components::TextureRect{16, 32, 8, 24};
+    world.add<Components::CTexture>(e, texture);
+
+    Components::CSpriteAnimation animation;
+    animation.addGridFrames(8, 24, 4, 1, 2, 0.2f);
+    animation.frames[1].event = "step";
+    animation.speed           = 1.5f;
+    animation.loop            = false;
+    world.add<Components::CSpriteAnimation>(e, animation);
     world.add<Components::CShader>(e, Components::CShader{"assets/shaders/v.glsl", "assets/shaders/f.glsl"});
 
+    Components::CTilemap tilemap(40, 3, 0.5f, "assets/textures/tiles.png");
+    tilemap.setTilePixelSize(16, 24);
+    tilemap.zIndex       = -3;
+    tilemap.visible      = false;
+    tilemap.renderLayers = 0x2u;
+    tilemap.setTile(0, 0, 5);
+    tilemap.setTile(39, 2, 11);
+    world.add<Components::CTilemap>(e, tilemap);
+
     Components::CMaterial m;
     m.tint      = Color{9, 8, 7, 6};
     m.blendMode = Components::BlendMode::Multiply;
     m.opacity   = 0.42f;
+    m.setUniform("u_strength", 0.5f);
+    m.setUniform("u_glow", Color{255, 0, 51, 255});
     world.add<Components::CMaterial>(e, m);
 
     // Physics config component
@@ -80,13 +103,14 @@ TEST(SaveGameJson, RoundTripMoreBuiltInComponents)
     body.gravityScale  = 0.25f;
     world.add<Components::CPhysicsBody2D>(e, body);
 
-    // Audio source persists configuration only; runtime requests should be reset on load.
+    // Audio source persists configuration only.
     Components::CAudioSource audio;
-    audio.clipId        = "clip:menu_click";
-    audio.volume        = 0.66f;
-    audio.loop          = true;
-    audio.playRequested = true;
-    audio.stopRequested = true;
+    audio.clipId      = "clip:menu_click";
+    audio.volume      = 0.66f;
+    audio.priority    = 7;
+    audio.loop        = true;
+    audio.spatial     = true;
+    audio.maxDistance = 12.5f;
     world.add<Components::CAudioSource>(e, audio);
 
     ASSERT_TRUE(Systems::SaveGame::saveWorld(world, slot));
@@ -112,15 +136,45 @@ TEST(SaveGameJson, RoundTripMoreBuiltInComponents)
     EXPECT_FLOAT_EQ(loadedR->lineEnd.x, 3.0f);
     EXPECT_FLOAT_EQ(loadedR->lineEnd.y, -4.0f);
     EXPECT_FLOAT_EQ(loadedR->lineThickness, 7.5f);
+    EXPECT_EQ(loadedR->lineCap, Components::LineCap::Round);
+    EXPECT_TRUE(loadedR->isStatic());
+    EXPECT_EQ(loadedR->getRenderLayers(), 0x6u);
 
     const auto* loadedTex = loaded.get<Components::CTexture>(loadedE);
     ASSERT_NE(loadedTex, nullptr);
-    EXPECT_EQ(loadedTex->texturePath, "assets/textures/does_not_need_to_exist.png");
+    EXPECT_EQ(loadedTex->getTexturePath(), "assets/textures/does_not_need_to_exist.png");
+    EXPECT_EQ(loadedTex->textureRect, (Components::TextureRect{16, 32, 8, 24}));
+
+    const auto* loadedAnim = loaded.get<Components::CSpriteAnimation>(loadedE);
+    ASSERT_NE(loadedAnim, nullptr);
+    ASSERT_EQ(loadedAnim->frames.size(), 2u);
+    EXPECT_EQ(loadedAnim->frames[0].rect, (Components::TextureRect{8, 0, 8, 24}));
+    EXPECT_FLOAT_EQ(loadedAnim->frames[1].duration, 0.2f);
+    EXPECT_EQ(loadedAnim->frames[1].event, "step");
+    EXPECT_FLOAT_EQ(loadedAnim->speed, 1.5f);
+    EXPECT_FALSE(loadedAnim->loop);
+    EXPECT_EQ(loadedAnim->getCurrentFrame(), 0u);
 
     const auto* loadedShader = loaded.get<Components::CShader>(loadedE);
     ASSERT_NE(loadedShader, nullptr);
-    EXPECT_EQ(loadedShader->vertexShaderPath, "assets/shaders/v.glsl");
-    EXPECT_EQ(loadedShader->fragmentShaderPath, "assets/shaders/f.glsl");
+    EXPECT_EQ(loadedShader->getVertexShaderPath(), "assets/shaders/v.glsl");
+    EXPECT_EQ(loadedShader->getFragmentShaderPath(), "assets/shaders/f.glsl");
+
+    const auto* loadedMap = loaded.get<Components::CTilemap>(loadedE);
+    ASSERT_NE(loadedMap, nullptr);
+    EXPECT_EQ(loadedMap->getAtlasPath(), "assets/textures/tiles.png");
+    EXPECT_EQ(loadedMap->getTilePixelWidth(), 16u);
+    EXPECT_EQ(loadedMap->getTilePixelHeight(), 24u);
+    EXPECT_FLOAT_EQ(loadedMap->getTileSize(), 0.5f);
+    EXPECT_EQ(loadedMap->zIndex, -3);
+    EXPECT_FALSE(loadedMap->visible);
+    EXPECT_EQ(loadedMap->renderLayers, 0x2u);
+    EXPECT_EQ(loadedMap->getWidth(), 40u);
+    EXPECT_EQ(loadedMap->getHeight(), 3u);
+    EXPECT_EQ(loadedMap->getTile(0, 0), 5);
+    EXPECT_EQ(loadedMap->getTile(39, 2), 11);
+    EXPECT_EQ(loadedMap->getTile(1, 0), Components::CTilemap::kEmptyTile);
+    EXPECT_EQ(loadedMap->getChunksX(), 2u);
 
     const auto* loadedMat = loaded.get<Components::CMaterial>(loadedE);
     ASSERT_NE(loadedMat, nullptr);
@@ -130,6 +184,11 @@ TEST(SaveGameJson, RoundTripMoreBuiltInComponents)
     EXPECT_EQ(loadedMat->tint.a, 6);
     EXPECT_EQ(loadedMat->blendMode, Components::BlendMode::Multiply);
     EXPECT_FLOAT_EQ(loadedMat->opacity, 0.42f);
+    ASSERT_EQ(loadedMat->getUniforms().size(), 2u);
+    EXPECT_EQ(loadedMat->getUniforms()[0].name, "u_strength");
+    EXPECT_FLOAT_EQ(loadedMat->getUniforms()[0].x, 0.5f);
+    EXPECT_EQ(loadedMat->getUniforms()[1].type, Components::UniformType::Color);
+    EXPECT_EQ(loadedMat->getUniformsHash(), m.getUniformsHash());
 
     const auto* loadedBody = loaded.get<Components::CPhysicsBody2D>(loadedE);
     ASSERT_NE(loadedBody, nullptr);
@@ -146,9 +205,10 @@ TEST(SaveGameJson, RoundTripMoreBuiltInComponents)
     ASSERT_NE(loadedAudio, nullptr);
     EXPECT_EQ(loadedAudio->clipId, "clip:menu_click");
     EXPECT_FLOAT_EQ(loadedAudio->volume, 0.66f);
+    EXPECT_EQ(loadedAudio->priority, 7);
+    EXPECT_TRUE(loadedAudio->spatial);
+    EXPECT_FLOAT_EQ(loadedAudio->maxDistance, 12.5f);
     EXPECT_TRUE(loadedAudio->loop);
-    EXPECT_FALSE(loadedAudio->playRequested);
-    EXPECT_FALSE(loadedAudio->stopRequested);
 
     std::filesystem::remove(path, ec);
     std::filesystem::remove(path.parent_path(), ec);
@@ -66,6 +66,7 @@ TEST(SaveGameJson, RoundTripBuiltInComponents)
     cam.viewport.top  = 0.2f;
     cam.viewport.width = 0.7f;
     cam.viewport.height = 0.6f;
+    cam.cullingMask     = 0x5u;
     world.add<Components::CCamera>(cameraE, cam);
 
     // Collider with multiple fixtures
@@ -107,6 +108,7 @@ TEST(SaveGameJson, RoundTripBuiltInComponents)
     pe.setStartAlpha(0.9f);
     pe.setEndAlpha(0.1f);
     pe.setZIndex(5);
+    pe.setRenderLayers(0x4u);
     world.add<Components::CParticleEmitter>(particleE, pe);
 
     ASSERT_TRUE(Systems::SaveGame::saveWorld(world, slot));
@@ -134,6 +136,7 @@ TEST(SaveGameJson, RoundTripBuiltInComponents)
     EXPECT_EQ(loadedCam->followTarget, loadedTarget);
     EXPECT_FLOAT_EQ(loadedCam->followOffset.x, 1.0f);
     EXPECT_FLOAT_EQ(loadedCam->followOffset.y, -2.0f);
+    EXPECT_EQ(loadedCam->cullingMask, 0x5u);
 
     // Collider fixtures round-trip
     const auto* loadedCol = loaded.get<Components::CCollider2D>(loadedCollider);
@@ -160,6 +163,7 @@ TEST(SaveGameJson, RoundTripBuiltInComponents)
     EXPECT_EQ(loadedPe->getEmissionShape(), Components::EmissionShape::Circle);
     EXPECT_FLOAT_EQ(loadedPe->getShapeRadius(), 2.5f);
     EXPECT_EQ(loadedPe->getZIndex(), 5);
+    EXPECT_EQ(loadedPe->getRenderLayers(), 0x4u);
 
     // Persistent audio settings round-trip
     const auto* loadedSettings = loaded.get<Components::CAudioSettings>(loadedTarget);
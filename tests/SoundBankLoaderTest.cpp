@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "SoundBankLoader.h"
+
+namespace
+{
+
+// Collects worker results until nothing is pending.
+std::vector<Internal::SoundLoadResult> drain(Internal::SoundBankLoader& loader)
+{
+    std::vector<Internal::SoundLoadResult> results;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (loader.pendingCount() > 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        loader.collect(results);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return results;
+}
+
+}  // namespace
+
+TEST(SoundBankLoaderTest, MissingFilesFailOnWorkersWithTheirTickets)
+{
+    Internal::SoundBankLoader loader(2);
+
+    std::vector<Internal::SoundLoadResult> results;
+    EXPECT_EQ(loader.collect(results), 0u);
+
+    loader.request("sfx_a", "assets/audio/sound_bank_loader_test_missing_a.wav", 7);
+    loader.request("sfx_b", "assets/audio/sound_bank_loader_test_missing_b.wav", 9);
+    EXPECT_EQ(loader.pendingCount(), 2u);
+
+    results = drain(loader);
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(loader.pendingCount(), 0u);
+
+    for (const Internal::SoundLoadResult& result : results)
+    {
+        EXPECT_FALSE(result.ok);
+        EXPECT_FALSE(result.error.empty());
+        EXPECT_EQ(result.ticket, result.id == "sfx_a" ? 7u : 9u);
+    }
+}
+
+TEST(SoundBankLoaderTest, CancelAllDropsQueuedAndFinishedRequests)
+{
+    Internal::SoundBankLoader loader(1);
+
+    for (std::uint64_t i = 0; i < 16; ++i)
+    {
+        loader.request("sfx", "assets/audio/sound_bank_loader_test_missing.wav", i);
+    }
+    loader.cancelAll();
+    EXPECT_EQ(loader.pendingCount(), 0u);
+
+    // A decode that was already in flight is discarded when it finishes.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::vector<Internal::SoundLoadResult> results;
+    EXPECT_EQ(loader.collect(results), 0u);
+
+    loader.request("sfx", "assets/audio/sound_bank_loader_test_missing.wav", 99);
+    results = drain(loader);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].ticket, 99u);
+}
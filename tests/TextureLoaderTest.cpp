@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define private public
+#include "TextureLoader.h"
+#undef private
+
+namespace
+{
+
+// Collects worker results until nothing is pending (failed decodes need no GPU).
+bool drainFailures(Internal::TextureLoader& loader)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (loader.pendingCount() > 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        loader.uploadPending(0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return loader.pendingCount() == 0;
+}
+
+}  // namespace
+
+TEST(TextureLoaderTest, ResolveDeduplicatesPaths)
+{
+    Internal::TextureLoader loader(1);
+
+    const AssetHandle a = loader.resolve("assets/textures/missing_a.png");
+    EXPECT_NE(a, kInvalidAssetHandle);
+    EXPECT_EQ(loader.resolve("assets/textures/missing_a.png"), a);
+    EXPECT_NE(loader.resolve("assets/textures/missing_b.png"), a);
+    EXPECT_EQ(loader.resolve(""), kInvalidAssetHandle);
+}
+
+TEST(TextureLoaderTest, MissingFileFailsOnWorkerAndIsNotRequeued)
+{
+    Internal::TextureLoader loader(2);
+
+    const AssetHandle handle = loader.resolve("assets/textures/texture_loader_test_missing.png");
+    EXPECT_EQ(loader.get(handle), nullptr);
+    EXPECT_EQ(loader.pendingCount(), 1u);
+
+    // Requesting again while in flight does not queue a second decode.
+    EXPECT_EQ(loader.get(handle), nullptr);
+    EXPECT_EQ(loader.pendingCount(), 1u);
+
+    ASSERT_TRUE(drainFailures(loader));
+
+    EXPECT_EQ(loader.get(handle), nullptr);
+    EXPECT_EQ(loader.pendingCount(), 0u);
+
+    // clear() forgets the failure; the next request decodes again.
+    loader.clear();
+    EXPECT_EQ(loader.get(handle), nullptr);
+    EXPECT_EQ(loader.pendingCount(), 1u);
+}
+
+TEST(TextureLoaderTest, ResidencyStatsCountMissesAndBudget)
+{
+    Internal::TextureLoader loader(1);
+
+    EXPECT_EQ(loader.getStats().budgetBytes, 0u);
+    EXPECT_FALSE(loader.isOverBudget());
+
+    const AssetHandle handle = loader.resolve("assets/textures/texture_loader_stats_missing.png");
+    EXPECT_EQ(loader.get(handle), nullptr);
+    EXPECT_EQ(loader.get(handle), nullptr);
+    EXPECT_EQ(loader.getStats().misses, 2u);
+    EXPECT_EQ(loader.getStats().hits, 0u);
+
+    loader.setMemoryBudget(1024);
+    EXPECT_EQ(loader.getStats().budgetBytes, 1024u);
+    EXPECT_EQ(loader.getStats().residentBytes, 0u);
+    EXPECT_FALSE(loader.isOverBudget());
+    EXPECT_EQ(loader.trimToBudget(), 0u);
+}
+
+TEST(TextureLoaderTest, BudgetEvictsLeastRecentlyUsedOutsideWorkingSet)
+{
+    Internal::TextureLoader loader(1);
+
+    // Residency is faked (no GPU): four 100-byte textures, made resident in handle order.
+    std::vector<AssetHandle> handles;
+    for (int i = 0; i < 4; ++i)
+    {
+        const AssetHandle handle = loader.resolve("assets/textures/texture_loader_lru_" + std::to_string(i) + ".png");
+        auto&             slot   = loader.m_slots[handle];
+        slot.state               = Internal::TextureLoader::SlotState::Resident;
+        slot.bytes               = 100;
+        loader.m_stats.residentBytes += slot.bytes;
+        ++loader.m_stats.residentCount;
+        loader.lruLink(handle);
+        handles.push_back(handle);
+    }
+
+    auto isResident = [&](AssetHandle handle)
+    { return loader.m_slots[handle].state == Internal::TextureLoader::SlotState::Resident; };
+
+    // Use order becomes 0, 2, 1, 3 (least to most recent).
+    loader.beginFrame();
+    loader.get(handles[1]);
+    loader.beginFrame();
+    loader.get(handles[3]);
+    loader.beginFrame();
+    loader.beginFrame();
+
+    loader.setMemoryBudget(250);
+    EXPECT_EQ(loader.trimToBudget(), 2u);
+    EXPECT_FALSE(isResident(handles[0]));
+    EXPECT_FALSE(isResident(handles[2]));
+    EXPECT_TRUE(isResident(handles[1]));
+    EXPECT_TRUE(isResident(handles[3]));
+    EXPECT_EQ(loader.getStats().residentBytes, 200u);
+    EXPECT_EQ(loader.getStats().evictions, 2u);
+
+    // Textures used this frame are the working set: the budget overshoots instead of thrashing.
+    loader.get(handles[1]);
+    loader.get(handles[3]);
+    loader.setMemoryBudget(50);
+    EXPECT_EQ(loader.trimToBudget(), 0u);
+    EXPECT_TRUE(loader.isOverBudget());
+
+    // Once idle they go, oldest first.
+    loader.beginFrame();
+    loader.beginFrame();
+    loader.get(handles[3]);
+    EXPECT_EQ(loader.trimToBudget(), 1u);
+    EXPECT_FALSE(isResident(handles[1]));
+    EXPECT_TRUE(isResident(handles[3]));
+}
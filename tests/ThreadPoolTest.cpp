@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ThreadPool.h"
+
+TEST(ThreadPoolTest, ParallelForRunsEveryIndexOnce)
+{
+    Internal::ThreadPool pool(3);
+
+    std::vector<std::atomic<int>> hits(1000);
+    for (int batch = 0; batch < 20; ++batch)
+    {
+        pool.parallelFor(hits.size(), [&hits](std::size_t i) { hits[i].fetch_add(1, std::memory_order_relaxed); });
+    }
+
+    for (const std::atomic<int>& count : hits)
+    {
+        EXPECT_EQ(count.load(), 20);
+    }
+}
+
+TEST(ThreadPoolTest, ParallelForWaitsForAllTasks)
+{
+    Internal::ThreadPool pool(2);
+
+    // Plain writes: parallelFor() must publish them to the caller before returning.
+    std::vector<int> values(257, 0);
+    pool.parallelFor(values.size(), [&values](std::size_t i) { values[i] = static_cast<int>(i) * 2; });
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(values[i], static_cast<int>(i) * 2);
+    }
+}
+
+TEST(ThreadPoolTest, SingleTaskRunsOnCallingThread)
+{
+    Internal::ThreadPool pool(2);
+
+    std::thread::id ranOn;
+    pool.parallelFor(1, [&ranOn](std::size_t) { ranOn = std::this_thread::get_id(); });
+    EXPECT_EQ(ranOn, std::this_thread::get_id());
+}
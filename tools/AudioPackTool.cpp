@@ -0,0 +1,149 @@
+// Offline audio packer.
+//
+// Bundles sound and music files into one pack that SAudio::mountAudioPack() maps at runtime.
+// Entry names are the file paths relative to --root (default: the current directory), so
+// pass the same asset root the game loads from and the packed files are found under the
+// paths the game already uses. Directories are packed recursively. Entries are sorted by
+// name, so the same inputs always produce the same pack.
+//
+// Usage:
+//   audio_pack --out=<pack> [--root=<dir>] <file-or-dir>...
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <AudioPack.h>
+
+namespace
+{
+
+struct Options
+{
+    std::filesystem::path              out;
+    std::filesystem::path              root = ".";
+    std::vector<std::filesystem::path> inputs;
+};
+
+bool parsePath(const char* arg, const char* name, std::filesystem::path& out)
+{
+    const std::size_t length = std::strlen(name);
+    if (std::strncmp(arg, name, length) != 0 || arg[length] != '=')
+    {
+        return false;
+    }
+    out = arg + length + 1;
+    return true;
+}
+
+bool parseOptions(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if (parsePath(arg, "--out", options.out) || parsePath(arg, "--root", options.root))
+        {
+            continue;
+        }
+        if (arg[0] == '-')
+        {
+            options.inputs.clear();
+            break;
+        }
+        options.inputs.emplace_back(arg);
+    }
+
+    if (options.out.empty() || options.inputs.empty())
+    {
+        std::fprintf(stderr, "usage: %s --out=<pack> [--root=<dir>] <file-or-dir>...\n", argv[0]);
+        return false;
+    }
+    return true;
+}
+
+bool addSource(const std::filesystem::path&            file,
+               const std::filesystem::path&            root,
+               std::vector<Internal::AudioPackSource>& out)
+{
+    std::error_code             ec;
+    const std::filesystem::path relative = std::filesystem::relative(file, root, ec);
+    if (ec || relative.empty() || *relative.begin() == "..")
+    {
+        std::fprintf(stderr, "'%s' is not under root '%s'\n", file.string().c_str(), root.string().c_str());
+        return false;
+    }
+    out.push_back(Internal::AudioPackSource{relative.generic_string(), file});
+    return true;
+}
+
+bool collectSources(const Options& options, std::vector<Internal::AudioPackSource>& out)
+{
+    for (const std::filesystem::path& input : options.inputs)
+    {
+        std::error_code ec;
+        if (std::filesystem::is_directory(input, ec))
+        {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(input, ec))
+            {
+                if (entry.is_regular_file() && !addSource(entry.path(), options.root, out))
+                {
+                    return false;
+                }
+            }
+        }
+        else if (std::filesystem::is_regular_file(input, ec))
+        {
+            if (!addSource(input, options.root, out))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            std::fprintf(stderr, "'%s' does not exist\n", input.string().c_str());
+            return false;
+        }
+
+        if (ec)
+        {
+            std::fprintf(stderr, "could not read '%s': %s\n", input.string().c_str(), ec.message().c_str());
+            return false;
+        }
+    }
+
+    std::sort(out.begin(),
+              out.end(),
+              [](const Internal::AudioPackSource& a, const Internal::AudioPackSource& b) { return a.name < b.name; });
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 1;
+    }
+
+    std::vector<Internal::AudioPackSource> sources;
+    if (!collectSources(options, sources))
+    {
+        return 1;
+    }
+
+    std::string error;
+    if (!Internal::AudioPack::write(options.out, sources, &error))
+    {
+        std::fprintf(stderr, "failed to write '%s': %s\n", options.out.string().c_str(), error.c_str());
+        return 1;
+    }
+
+    std::printf("packed %zu files into %s\n", sources.size(), options.out.string().c_str());
+    return 0;
+}